@@ -2,6 +2,7 @@
 # adds the definitions
 #
 # fl_USE_RANDOM_SEED
+# fl_USE_STD_NORMAL_DISTRIBUTION
 # fl_USE_FLOAT  OR  fl_USE_DOUBLE  OR  fl_USE_LONG_DOUBLE
 ##########################################################
 
@@ -9,6 +10,10 @@ if(fl_USE_RANDOM_SEED)
     add_definitions(-Dfl_USE_RANDOM_SEED=1)
 endif(fl_USE_RANDOM_SEED)
 
+if(fl_USE_STD_NORMAL_DISTRIBUTION)
+    add_definitions(-Dfl_USE_STD_NORMAL_DISTRIBUTION=1)
+endif(fl_USE_STD_NORMAL_DISTRIBUTION)
+
 
 if(fl_FLOATING_POINT_TYPE STREQUAL "float")
     add_definitions(-Dfl_USE_FLOAT=1)
@@ -21,9 +21,11 @@
 
 #include <Eigen/Dense>
 
+#include <cstdint>
 #include <boost/math/distributions.hpp>
 
 #include <fl/util/meta.hpp>
+#include <fl/util/random.hpp>
 #include <fl/util/scalar_matrix.hpp>
 
 #include "uniform_distribution.hpp"
@@ -38,6 +40,12 @@ namespace fl
  *
  * \brief ChiSquared represents a univariate Chi-squared distribution
  * \f$\chi^2_k\f$, with \f$k \in \mathbb{N}^{*}\f$ degrees-of-freedom
+ *
+ * sample() and fill() draw \f$\chi^2_k = 2\,\Gamma(k/2, 1)\f$ directly
+ * using fl::StandardGammaDistribution which is orders of magnitude faster than
+ * mapping a standard normal variate through the inverse CDF. The
+ * map_standard_normal() interface remains available for deterministic
+ * transforms such as sigma point quadrature.
  */
 class ChiSquared
     : public Evaluation<ScalarMatrix>,
@@ -75,7 +83,9 @@ public:
      */
     explicit ChiSquared(Real degrees_of_freedom)
        : StdGaussianMappingBase(1),
-        chi2_(degrees_of_freedom)
+        chi2_(degrees_of_freedom),
+        gamma_(degrees_of_freedom / Real(2)),
+        generator_(fl::random_seed(), fl::next_stream_id())
     { }
 
     /**
@@ -109,6 +119,52 @@ public:
         return map_standard_uniform(uniform_.map_standard_normal(n));
     }
 
+    /**
+     * \brief Returns a \f$\chi^2_k\f$ sample drawn by gamma sampling
+     */
+    Variate sample() const override
+    {
+        return Real(2) * gamma_(generator_);
+    }
+
+    /**
+     * \brief Fills all coefficients of \a samples with independent
+     * \f$\chi^2_k\f$ samples
+     */
+    template <typename Derived>
+    void fill(Eigen::DenseBase<Derived>& samples) const
+    {
+        for (int j = 0; j < samples.cols(); ++j)
+        {
+            for (int i = 0; i < samples.rows(); ++i)
+            {
+                samples(i, j) = Real(2) * gamma_(generator_);
+            }
+        }
+    }
+
+    /**
+     * \brief Restarts the sampling on the stream \a stream_id of \a seed,
+     * see fl::Philox4x32. The standard normal variates are drawn from the
+     * substream 0 and the gamma variates from the substream 1.
+     */
+    void seed(std::uint64_t seed, std::uint64_t stream_id) override
+    {
+        this->seed(seed, stream_id, 0);
+    }
+
+    /**
+     * \brief Restarts the sampling on the substreams \a first_substream and
+     * \a first_substream + 1 of the stream \a stream_id of \a seed. This
+     * allows an owning sampler to keep its own substreams apart.
+     */
+    void seed(std::uint64_t seed, std::uint64_t stream_id, int first_substream)
+    {
+        standard_gaussian_.seed(seed, stream_id, first_substream);
+        generator_.seed(seed, stream_id, first_substream + 1);
+        gamma_.reset();
+    }
+
     /**
      * \brief Returns the log probability of the given sample \c variate
      *
@@ -149,12 +205,15 @@ public:
     void degrees_of_freedom(Real dof)
     {
         chi2_ = boost::math::chi_squared_distribution<Real>(dof);
+        gamma_.shape(dof / Real(2));
     }
 
 protected:
     /** \cond internal */
     UniformDistribution uniform_;
     boost::math::chi_squared_distribution<Real> chi2_;
+    mutable StandardGammaDistribution gamma_;
+    mutable fl::RandomEngine generator_;
     /** \endcond */
 };
 
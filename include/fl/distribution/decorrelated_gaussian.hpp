@@ -468,8 +468,8 @@ public:
     {
         mean_.resize(dimension());
         covariance_.resize(dimension());
-        precision_.resize(dimension());
-        square_root_.resize(dimension());
+        precision_.setIdentity(dimension());
+        square_root_.setIdentity(dimension());
 
         mean(Variate::Zero(dimension()));
 
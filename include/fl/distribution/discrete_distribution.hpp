@@ -23,8 +23,10 @@
 #include <Eigen/Core>
 
 #include <vector>
+#include <algorithm>
 
 #include <fl/util/types.hpp>
+#include <fl/util/math/general_functions.hpp>
 #include <fl/util/traits.hpp>
 #include <fl/util/assertions.hpp>
 #include <fl/distribution/interface/moments.hpp>
@@ -45,6 +47,7 @@ public:
 
     typedef Eigen::Array<Real,    Locations, 1> Function;
     typedef Eigen::Array<Variate, Locations, 1> LocationArray;
+    typedef Eigen::Array<int, Eigen::Dynamic, 1> IndexArray;
 
     typedef StandardGaussianMapping<Variate, 1> StdGaussianMapping;
     typedef typename StdGaussianMapping::StandardVariate StandardVariate;
@@ -122,6 +125,31 @@ public:
         locations_ = new_locations;
     }
 
+    /**
+     * \brief Resamples \a new_size locations from the discrete
+     * \a distribution. The standard normal variates of all samples are drawn
+     * and mapped onto location indices at once, see
+     * map_standard_normal(const Eigen::ArrayBase<Derived>&, IndexArray&)
+     */
+    void from_distribution(const DiscreteDistribution& distribution,
+                           const int& new_size)
+    {
+        Eigen::Array<Real, Eigen::Dynamic, 1> gaussian_samples(new_size);
+        distribution.standard_gaussian_.fill(gaussian_samples);
+
+        IndexArray indices;
+        distribution.map_standard_normal(gaussian_samples, indices);
+
+        // distribution may be this, hence the local array
+        LocationArray new_locations(new_size);
+        for(int i = 0; i < new_size; i++)
+        {
+            new_locations[i] = distribution.locations_[indices(i)];
+        }
+
+        set_uniform(new_size);
+        locations_ = new_locations;
+    }
 
 
     /// const functions ********************************************************
@@ -139,15 +167,40 @@ public:
     virtual Variate map_standard_uniform(const StandardVariate& uniform_sample,
                                          int& index) const
     {
-        index = 0;
-        for (index = 0; index < cumul_distr_.size(); ++index)
-        {
-            if (cumul_distr_[index] >= uniform_sample) break;
-        }
+        index = index_of(uniform_sample);
 
         return locations_[index];
     }
 
+    /**
+     * \brief Batch version of map_standard_normal(). Maps each standard
+     * normal variate of \a gaussian_samples onto the index of a location. The
+     * standard normal variates are mapped onto uniform variates at once using
+     * the vectorized fl::normal_to_uniform.
+     */
+    template <typename Derived>
+    void map_standard_normal(const Eigen::ArrayBase<Derived>& gaussian_samples,
+                             IndexArray& indices) const
+    {
+        map_standard_uniform(fl::normal_to_uniform(gaussian_samples), indices);
+    }
+
+    /**
+     * \brief Batch version of map_standard_uniform(). Maps each uniform
+     * variate of \a uniform_samples onto the index of a location.
+     */
+    template <typename Derived>
+    void map_standard_uniform(const Eigen::ArrayBase<Derived>& uniform_samples,
+                              IndexArray& indices) const
+    {
+        indices.resize(uniform_samples.size());
+
+        for (int i = 0; i < indices.size(); ++i)
+        {
+            indices(i) = index_of(uniform_samples(i));
+        }
+    }
+
     using StdGaussianMapping::sample;
 
     virtual Variate sample(int& index) const
@@ -259,6 +312,21 @@ public:
 
 
 protected:
+    /**
+     * \return Index of the first location whose cumulative probability mass
+     * is not less than \a uniform_sample
+     */
+    int index_of(Real uniform_sample) const
+    {
+        const Real* begin = cumul_distr_.data();
+        const Real* end = begin + cumul_distr_.size();
+
+        const int index = std::lower_bound(begin, end, uniform_sample) - begin;
+
+        // guards against the accumulated mass falling short of 1
+        return std::min(index, int(cumul_distr_.size()) - 1);
+    }
+
     /// member variables *******************************************************
     LocationArray locations_;
 
@@ -24,6 +24,7 @@
 #include <cmath>
 
 #include <fl/util/types.hpp>
+#include <fl/util/math/general_functions.hpp>
 #include <fl/distribution/interface/evaluation.hpp>
 #include <fl/distribution/interface/standard_gaussian_mapping.hpp>
 
@@ -78,6 +79,28 @@ public:
                             * uniform_sample) / lambda_;
     }
 
+    virtual Real map_standard_normal(
+        const StandardVariate& gaussian_sample) const override
+    {
+        return map_standard_normal(Real(gaussian_sample));
+    }
+
+    /**
+     * \brief Batch version of map_standard_normal(const Real&) using the
+     * vectorized fl::normal_to_uniform
+     */
+    template <typename Derived>
+    typename Derived::PlainObject
+    map_standard_normal(const Eigen::ArrayBase<Derived>& gaussian_samples) const
+    {
+        // map from a gaussian to a uniform distribution
+        typename Derived::PlainObject uniform_samples =
+            fl::normal_to_uniform(gaussian_samples);
+        // map from a uniform to an exponential distribution
+        return -(exp_lambda_min_ - (exp_lambda_min_ - exp_lambda_max_)
+                    * uniform_samples).log() / lambda_;
+    }
+
     virtual Real map_standard_normal(const Real& gaussian_sample,
                                        const Real& max) const
     {
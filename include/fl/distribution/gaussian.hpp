@@ -461,10 +461,10 @@ public:
 
         if(has_full_rank())
         {
-            return log_normalizer() - 0.5
-                    * (vector - mean()).transpose()
-                    * precision()
-                    * (vector - mean());
+            const Eigen::Matrix<Real, SizeOf<Variate>::Value, 1> delta =
+                vector - mean();
+
+            return log_normalizer() - 0.5 * delta.dot(precision() * delta);
         }
 
         return -std::numeric_limits<Real>::infinity();
@@ -491,8 +491,8 @@ public:
     {
         mean_.resize(dimension());
         covariance_.resize(dimension(), dimension());
-        precision_.resize(dimension(), dimension());
-        square_root_.resize(dimension(), dimension());
+        precision_.setIdentity(dimension(), dimension());
+        square_root_.setIdentity(dimension(), dimension());
 
         mean(Variate::Zero(dimension()));
         covariance(SecondMoment::Identity(dimension(), dimension()));
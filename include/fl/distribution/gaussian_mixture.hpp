@@ -0,0 +1,479 @@
+/*
+ * This is part of the fl library, a C++ Bayesian filtering library
+ * (https://github.com/filtering-library)
+ *
+ * Copyright (c) 2015 Max Planck Society,
+ * 				 Autonomous Motion Department,
+ * 			     Institute for Intelligent Systems
+ *
+ * This Source Code Form is subject to the terms of the MIT License (MIT).
+ * A copy of the license can be found in the LICENSE file distributed with this
+ * source code.
+ */
+
+/**
+ * \file gaussian_mixture.hpp
+ * \date October 2026
+ * \author agent (agent@local)
+ */
+
+#pragma once
+
+
+#include <Eigen/Dense>
+
+#include <cmath>
+#include <limits>
+#include <vector>
+#include <algorithm>
+
+#include <fl/util/meta.hpp>
+#include <fl/util/types.hpp>
+#include <fl/util/traits.hpp>
+#include <fl/exception/exception.hpp>
+#include <fl/util/math/general_functions.hpp>
+#include <fl/distribution/gaussian.hpp>
+#include <fl/distribution/interface/moments.hpp>
+#include <fl/distribution/interface/evaluation.hpp>
+#include <fl/distribution/interface/standard_gaussian_mapping.hpp>
+
+namespace fl
+{
+
+/**
+ * \ingroup distributions
+ *
+ * \brief GaussianMixture represents a weighted sum of Gaussians
+ * \f$p(x) = \sum_k w_k\, {\cal N}(x; \mu_k, \Sigma_k)\f$ with
+ * \f$\sum_k w_k = 1\f$.
+ *
+ * The components are plain Gaussian distributions. Each keeps its lazily
+ * computed precision matrix and log. normalizer which are shared by all
+ * evaluations until the component is replaced. The log. probability is
+ * evaluated as a log-sum-exp over the components. It does not underflow for
+ * points far from all components. log_probabilities() evaluates a whole set
+ * of points with one matrix product per component.
+ *
+ * A sample is drawn by selecting a component and mapping the first
+ * \f$n\f$ entries of the standard normal variate through it. The last entry
+ * of the variate is mapped onto a uniform variate which selects the component
+ * in constant time using Walker's alias table \cite walker1977efficient.
+ */
+template <typename Variate>
+class GaussianMixture
+    : public Moments<Variate>,
+      public Evaluation<Variate>,
+      public StandardGaussianMapping<
+                Variate,
+                JoinSizes<SizeOf<Variate>::Value, 1>::Value>
+{
+private:
+    typedef StandardGaussianMapping<
+                Variate,
+                JoinSizes<SizeOf<Variate>::Value, 1>::Value
+            > StdGaussianMappingBase;
+
+public:
+    /**
+     * \brief Second moment matrix type, i.e covariance matrix
+     */
+    typedef typename Moments<Variate>::SecondMoment SecondMoment;
+
+    /**
+     * \brief Standard normal variate type. It has one more dimension than
+     *        the \c Variate which is used to select the component.
+     */
+    typedef typename StdGaussianMappingBase::StandardVariate StandardVariate;
+
+    /**
+     * \brief Mixture component type
+     */
+    typedef Gaussian<Variate> Component;
+
+    /**
+     * \brief Component weight vector type
+     */
+    typedef Eigen::Array<Real, Eigen::Dynamic, 1> Weights;
+
+public:
+    /**
+     * \brief Creates an empty mixture of the specified dimension
+     *
+     * \param dim   Dimension of the mixture. The default is defined by the
+     *              dimension of the \c Variate.
+     */
+    explicit GaussianMixture(int dim = DimensionOf<Variate>())
+        : StdGaussianMappingBase(dim + 1),
+          dimension_(dim),
+          dirty_(true)
+    {
+        static_assert(Variate::SizeAtCompileTime != 0,
+                      "Illegal static dimension");
+    }
+
+    /**
+     * \brief Overridable default destructor
+     */
+    virtual ~GaussianMixture() noexcept { }
+
+    /**
+     * \return Dimension of the mixture
+     */
+    virtual int dimension() const
+    {
+        return dimension_;
+    }
+
+    /**
+     * \return Number of components
+     */
+    int count() const
+    {
+        return components_.size();
+    }
+
+    /**
+     * \return The i-th component
+     */
+    const Component& component(int i) const
+    {
+        return components_[i];
+    }
+
+    /**
+     * \return Normalized component weights
+     */
+    const Weights& weights() const
+    {
+        return weights_;
+    }
+
+    /**
+     * \brief Appends a \a component with the unnormalized \a weight. The
+     *        weight is relative to the unnormalized weights of the present
+     *        components. Afterwards all weights are renormalized.
+     *
+     * \throws WrongSizeException
+     * \throws Exception if the weights do not sum up to a positive number
+     */
+    void add_component(const Component& component, Real weight)
+    {
+        if (component.dimension() != dimension_)
+        {
+            fl_throw(WrongSizeException(component.dimension(), dimension_));
+        }
+
+        components_.push_back(component);
+
+        Weights new_weights(unnormalized_weights_.size() + 1);
+        new_weights << unnormalized_weights_, weight;
+        weights(new_weights);
+    }
+
+    /**
+     * \brief Replaces the i-th component
+     *
+     * \throws WrongSizeException
+     */
+    void component(int i, const Component& component)
+    {
+        if (component.dimension() != dimension_)
+        {
+            fl_throw(WrongSizeException(component.dimension(), dimension_));
+        }
+
+        components_[i] = component;
+        dirty_ = true;
+    }
+
+    /**
+     * \brief Sets the component weights. The weights are normalized to
+     *        sum up to one.
+     *
+     * \throws WrongSizeException
+     * \throws Exception if the weights are negative or do not sum up to a
+     *                   positive number
+     */
+    void weights(const Weights& new_weights)
+    {
+        if (new_weights.size() != count())
+        {
+            fl_throw(WrongSizeException(new_weights.size(), count()));
+        }
+
+        const Real sum = new_weights.sum();
+
+        if (!(sum > 0) || (new_weights < 0).any())
+        {
+            fl_throw(Exception("GaussianMixture weights must be non-negative "
+                               "with a positive sum"));
+        }
+
+        unnormalized_weights_ = new_weights;
+        weights_ = new_weights / sum;
+        log_weights_ = weights_.log();
+        build_alias_table();
+        dirty_ = true;
+    }
+
+    /**
+     * \brief Removes all components
+     */
+    void clear()
+    {
+        components_.clear();
+        unnormalized_weights_.resize(0);
+        weights_.resize(0);
+        log_weights_.resize(0);
+        alias_probability_.resize(0);
+        alias_.resize(0);
+        dirty_ = true;
+    }
+
+    /**
+     * \return Mixture mean \f$\mu = \sum_k w_k \mu_k\f$
+     *
+     * \throws Exception if the mixture is empty
+     */
+    const Variate& mean() const override
+    {
+        update_moments();
+        return mean_;
+    }
+
+    /**
+     * \return Mixture covariance
+     *         \f$\sum_k w_k (\Sigma_k + (\mu_k - \mu)(\mu_k - \mu)^T)\f$
+     *
+     * \throws Exception if the mixture is empty
+     */
+    const SecondMoment& covariance() const override
+    {
+        update_moments();
+        return covariance_;
+    }
+
+    /**
+     * \return Log. probability of \a variate evaluated by log-sum-exp over
+     *         the components. Components without full rank are skipped.
+     */
+    Real log_probability(const Variate& variate) const override
+    {
+        Real max_term = -std::numeric_limits<Real>::infinity();
+
+        Eigen::Array<Real, Eigen::Dynamic, 1> terms(count());
+        for (int k = 0; k < count(); ++k)
+        {
+            terms(k) = log_weights_(k) + components_[k].log_probability(variate);
+            max_term = std::max(max_term, terms(k));
+        }
+
+        if (!std::isfinite(max_term)) return max_term;
+
+        return max_term + std::log((terms - max_term).exp().sum());
+    }
+
+    /**
+     * \brief Batch version of log_probability(). Each column of \a points is
+     *        one variate.
+     *
+     * The component terms of all points are evaluated using one matrix
+     * product with the cached precision matrix of each component. The
+     * log-sum-exp over the components is then taken column-wise.
+     */
+    template <typename Points>
+    Eigen::Array<Real, Eigen::Dynamic, 1>
+    log_probabilities(const Eigen::MatrixBase<Points>& points) const
+    {
+        assert(points.rows() == dimension_);
+
+        const int point_count = points.cols();
+
+        Eigen::Array<Real, Eigen::Dynamic, 1> log_probs(point_count);
+
+        if (count() == 0)
+        {
+            log_probs.setConstant(-std::numeric_limits<Real>::infinity());
+            return log_probs;
+        }
+
+        // one column of terms per component such that the log-sum-exp
+        // runs over contiguous columns of all points at once
+        Eigen::Array<Real, Eigen::Dynamic, Eigen::Dynamic>
+            terms(point_count, count());
+
+        Eigen::Matrix<Real, SizeOf<Variate>::Value, Eigen::Dynamic>
+            delta(dimension_, point_count);
+        Eigen::Matrix<Real, SizeOf<Variate>::Value, Eigen::Dynamic>
+            weighted_delta(dimension_, point_count);
+
+        for (int k = 0; k < count(); ++k)
+        {
+            const Component& c = components_[k];
+
+            if (weights_(k) == Real(0) || !c.has_full_rank())
+            {
+                terms.col(k).setConstant(
+                    -std::numeric_limits<Real>::infinity());
+                continue;
+            }
+
+            delta = points.colwise() - c.mean();
+            weighted_delta.noalias() = c.precision() * delta;
+
+            terms.col(k) =
+                (log_weights_(k) + c.log_normalizer())
+                - 0.5 * weighted_delta.cwiseProduct(delta)
+                                      .colwise()
+                                      .sum()
+                                      .transpose()
+                                      .array();
+        }
+
+        // column-wise log-sum-exp over the components. Points with a zero
+        // probability under all components are not shifted since this would
+        // turn them into NaN
+        Eigen::Array<Real, Eigen::Dynamic, 1> shift = terms.col(0);
+        for (int k = 1; k < count(); ++k)
+        {
+            shift = shift.max(terms.col(k));
+        }
+        shift = shift.isFinite().select(shift, Real(0));
+
+        log_probs = (terms.col(0) - shift).exp();
+        for (int k = 1; k < count(); ++k)
+        {
+            log_probs += (terms.col(k) - shift).exp();
+        }
+        log_probs = shift + log_probs.log();
+
+        return log_probs;
+    }
+
+    /**
+     * \brief Maps a standard normal variate onto a mixture sample. The last
+     *        entry of \a sample selects the component using the alias table,
+     *        the remaining ones are mapped through the selected component.
+     *
+     * \throws Exception if the mixture is empty
+     */
+    Variate map_standard_normal(const StandardVariate& sample) const override
+    {
+        assert(sample.size() == dimension_ + 1);
+
+        const int k = select_component(sample(dimension_));
+
+        return components_[k].map_standard_normal(
+                    sample.topRows(dimension_));
+    }
+
+    /**
+     * \return Component index selected by the standard normal variate
+     *         \a selector
+     *
+     * \throws Exception if the mixture is empty
+     */
+    int select_component(Real selector) const
+    {
+        if (count() == 0)
+        {
+            fl_throw(Exception("GaussianMixture has no components"));
+        }
+
+        const Real u = fl::normal_to_uniform(selector) * count();
+        const int i = std::min(int(u), count() - 1);
+
+        return (u - i) < alias_probability_(i) ? i : alias_(i);
+    }
+
+protected:
+    /** \cond internal */
+
+    /**
+     * \brief Builds the alias table of the current weights using Vose's
+     *        method \cite vose1991linear in O(count())
+     */
+    void build_alias_table()
+    {
+        const int n = count();
+
+        alias_probability_.resize(n);
+        alias_.resize(n);
+
+        std::vector<int> small;
+        std::vector<int> large;
+        Weights scaled = weights_ * Real(n);
+
+        for (int i = 0; i < n; ++i)
+        {
+            (scaled(i) < Real(1) ? small : large).push_back(i);
+        }
+
+        while (!small.empty() && !large.empty())
+        {
+            const int s = small.back(); small.pop_back();
+            const int l = large.back();
+
+            alias_probability_(s) = scaled(s);
+            alias_(s) = l;
+
+            scaled(l) = (scaled(l) + scaled(s)) - Real(1);
+
+            if (scaled(l) < Real(1))
+            {
+                large.pop_back();
+                small.push_back(l);
+            }
+        }
+
+        // remaining entries are one up to round-off
+        for (int i: large) { alias_probability_(i) = Real(1); alias_(i) = i; }
+        for (int i: small) { alias_probability_(i) = Real(1); alias_(i) = i; }
+    }
+
+    /**
+     * \brief Recomputes the mixture moments if a component or weight changed
+     */
+    void update_moments() const
+    {
+        if (!dirty_) return;
+
+        if (count() == 0)
+        {
+            fl_throw(Exception("GaussianMixture has no components"));
+        }
+
+        mean_ = Variate::Zero(dimension_);
+        for (int k = 0; k < count(); ++k)
+        {
+            mean_ += weights_(k) * components_[k].mean();
+        }
+
+        covariance_ = SecondMoment::Zero(dimension_, dimension_);
+        for (int k = 0; k < count(); ++k)
+        {
+            const Variate delta = components_[k].mean() - mean_;
+            covariance_ += weights_(k) * (components_[k].covariance()
+                                          + delta * delta.transpose());
+        }
+
+        dirty_ = false;
+    }
+
+    int dimension_;
+    std::vector<Component, Eigen::aligned_allocator<Component>> components_;
+    Weights unnormalized_weights_;
+    Weights weights_;
+    Weights log_weights_;
+
+    Weights alias_probability_;
+    Eigen::Array<int, Eigen::Dynamic, 1> alias_;
+
+    mutable bool dirty_;
+    mutable Variate mean_;
+    mutable SecondMoment covariance_;
+
+    /** \endcond */
+};
+
+}
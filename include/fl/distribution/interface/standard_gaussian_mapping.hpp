@@ -23,6 +23,7 @@
 
 #include <Eigen/Dense>
 
+#include <cstdint>
 #include <type_traits>
 
 #include <fl/util/traits.hpp>
@@ -105,6 +106,16 @@ public:
         standard_gaussian_.dimension(snv_dimension);
     }
 
+    /**
+     * \brief Restarts the underlying SNV generator on the random stream
+     *        \a stream_id of \a seed. Samples of two mappers seeded with the
+     *        same pair are identical.
+     */
+    virtual void seed(std::uint64_t seed, std::uint64_t stream_id)
+    {
+        standard_gaussian_.seed(seed, stream_id);
+    }
+
 protected:
     /**
      * \brief SNV generator
@@ -172,6 +183,16 @@ public:
     {
     }
 
+    /**
+     * \brief Restarts the underlying SNV generator on the random stream
+     *        \a stream_id of \a seed. Samples of two mappers seeded with the
+     *        same pair are identical.
+     */
+    virtual void seed(std::uint64_t seed, std::uint64_t stream_id)
+    {
+        standard_gaussian_.seed(seed, stream_id);
+    }
+
 protected:
     /**
      * \brief One dimensional SNV generator
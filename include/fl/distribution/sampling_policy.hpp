@@ -0,0 +1,153 @@
+/*
+ * This is part of the fl library, a C++ Bayesian filtering library
+ * (https://github.com/filtering-library)
+ *
+ * Copyright (c) 2015 Max Planck Society,
+ * 				 Autonomous Motion Department,
+ * 			     Institute for Intelligent Systems
+ *
+ * This Source Code Form is subject to the terms of the MIT License (MIT).
+ * A copy of the license can be found in the LICENSE file distributed with this
+ * source code.
+ */
+
+/**
+ * \file sampling_policy.hpp
+ * \date October 2026
+ * \author agent (agent@local)
+ */
+
+#pragma once
+
+
+#include <vector>
+#include <numeric>
+#include <algorithm>
+
+#include <Eigen/Dense>
+
+#include <fl/util/types.hpp>
+#include <fl/util/math/general_functions.hpp>
+
+namespace fl
+{
+
+/**
+ * \defgroup sampling_policy Sampling Policy
+ * \ingroup distributions
+ * \brief Policies which determine how a set of standard normal variates is
+ *        drawn at once.
+ *
+ * \details
+ * A sampling policy fills a matrix with standard normal variates where each
+ * column is one sample. Every column is marginally \f${\cal N}(0, I)\f$
+ * distributed, hence, any Monte Carlo estimate built from the columns remains
+ * unbiased. The policies differ in the dependence between the columns which
+ * is used for variance reduction. All policies draw their randomness from a
+ * standard normal source providing
+ * \code
+ * template <typename Derived>
+ * void fill(Eigen::DenseBase<Derived>& samples) const;
+ * \endcode
+ * such as fl::StandardGaussian.
+ */
+
+/**
+ * \ingroup sampling_policy
+ *
+ * \brief Draws independent samples. This is plain Monte Carlo sampling.
+ */
+struct IidSamplingPolicy
+{
+    template <typename StandardGaussian, typename Derived>
+    static void fill(const StandardGaussian& standard_gaussian,
+                     Eigen::DenseBase<Derived>& samples)
+    {
+        standard_gaussian.fill(samples);
+    }
+};
+
+/**
+ * \ingroup sampling_policy
+ *
+ * \brief Draws antithetic pairs of samples, i.e. column \f$2k+1\f$ is the
+ *        negation of column \f$2k\f$.
+ *
+ * Antithetic pairs cancel all odd moments exactly. In particular the sample
+ * mean of the standard normal variates is zero. Estimates of functions which
+ * are monotone in the noise have a lower variance than with independent
+ * samples for the same number of model evaluations. For an odd number of
+ * samples the last column is an independent sample.
+ */
+struct AntitheticSamplingPolicy
+{
+    template <typename StandardGaussian, typename Derived>
+    static void fill(const StandardGaussian& standard_gaussian,
+                     Eigen::DenseBase<Derived>& samples)
+    {
+        standard_gaussian.fill(samples);
+
+        const int pairs = samples.cols() / 2;
+        for (int k = 0; k < pairs; ++k)
+        {
+            samples.col(2 * k + 1) = -samples.col(2 * k);
+        }
+    }
+};
+
+/**
+ * \ingroup sampling_policy
+ *
+ * \brief Latin hypercube sampling. Each dimension of the unit cube is divided
+ *        into as many strata of equal probability as there are samples, and
+ *        each stratum is hit exactly once.
+ *
+ * The \f$i\f$-th coordinate of the \f$k\f$-th dimension is
+ * \f$\Phi^{-1}((\pi_k(i) + u_{ik}) / N)\f$ with an independent random
+ * permutation \f$\pi_k\f$ per dimension and uniform jitter \f$u_{ik}\f$. The
+ * marginal distributions of the sample set are matched far better than with
+ * independent samples which mainly reduces the variance of estimates of
+ * additive functions.
+ */
+struct LatinHypercubeSamplingPolicy
+{
+    template <typename StandardGaussian, typename Derived>
+    static void fill(const StandardGaussian& standard_gaussian,
+                     Eigen::DenseBase<Derived>& samples)
+    {
+        const int dimension = samples.rows();
+        const int count = samples.cols();
+
+        if (count == 0) return;
+
+        // the permutation keys and the jitter of a dimension are taken from
+        // two rows of standard normal variates. The jitter is obtained by
+        // mapping the normal variate onto a uniform one.
+        Eigen::Matrix<Real, 2, Eigen::Dynamic> randomness(2, count);
+        std::vector<int> permutation(count);
+
+        for (int k = 0; k < dimension; ++k)
+        {
+            standard_gaussian.fill(randomness);
+
+            std::iota(permutation.begin(), permutation.end(), 0);
+            std::sort(permutation.begin(), permutation.end(),
+                      [&](int a, int b)
+                      {
+                          return randomness(0, a) < randomness(0, b);
+                      });
+
+            for (int i = 0; i < count; ++i)
+            {
+                const Real u = (permutation[i]
+                                + fl::normal_to_uniform(randomness(1, i)))
+                               / Real(count);
+
+                samples(k, i) = fl::uniform_to_normal(
+                    std::min(std::max(u, Real(1.e-12)), Real(1) - Real(1.e-12)));
+            }
+        }
+    }
+};
+
+}
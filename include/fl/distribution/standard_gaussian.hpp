@@ -64,8 +64,7 @@ public:
         : dimension_ (dim),
           mu_(Variate::Zero(dim, 1)),
           cov_(DiagonalSecondMoment(dim)),
-          generator_(fl::seed()),
-          gaussian_distribution_(0.0, 1.0)
+          generator_(fl::random_seed(), fl::next_stream_id())
     {
         cov_.setIdentity();
     }
@@ -76,12 +75,54 @@ public:
     {
         StandardVariate gaussian_sample(dimension(), 1);
 
-        for (int i = 0; i < dimension_; i++)
+        fill(gaussian_sample);
+
+        return gaussian_sample;
+    }
+
+    /**
+     * \brief Fills every coefficient of the given matrix with an independent
+     * standard normal variate.
+     *
+     * This is the bulk counterpart of sample(). Filling an entire matrix of
+     * samples, e.g. one column per sample, avoids the per-sample virtual call
+     * and the temporary returned by sample(). The matrix may have any shape
+     * and is not required to match dimension(). Blocks of a matrix, e.g.
+     * \c m.col(i), may be passed directly.
+     */
+    template <typename Derived>
+    void fill(const Eigen::DenseBase<Derived>& samples) const
+    {
+        // samples is taken by const reference to accept temporary
+        // expressions such as m.col(i) and is written through a cast, see
+        // Eigen's "Writing Functions Taking Eigen Types as Parameters"
+        auto& out = const_cast<Eigen::DenseBase<Derived>&>(samples);
+
+        const int rows = out.rows();
+        const int cols = out.cols();
+
+        for (int j = 0; j < cols; ++j)
         {
-            gaussian_sample(i, 0) = gaussian_distribution_(generator_);
+            for (int i = 0; i < rows; ++i)
+            {
+                out(i, j) = gaussian_distribution_(generator_);
+            }
         }
+    }
 
-        return gaussian_sample;
+    /**
+     * \brief Restarts the sampler on the stream \a stream_id of \a seed.
+     *
+     * Two samplers seeded with the same pair produce identical sequences.
+     * Assign distinct stream ids to samplers used in parallel to obtain
+     * results which do not depend on the scheduling. Samplers which own
+     * further generators draw them from other substreams of \a stream_id,
+     * see fl::Philox4x32.
+     */
+    void seed(std::uint64_t seed, std::uint64_t stream_id, int substream = 0)
+    {
+        generator_.seed(seed, stream_id, substream);
+        gaussian_distribution_.reset();
     }
 
     virtual int dimension() const
@@ -119,8 +160,8 @@ protected:
     int dimension_;
     Variate mu_;
     DiagonalSecondMoment cov_;
-    mutable fl::mt11213b generator_;
-    mutable std::normal_distribution<Real> gaussian_distribution_;
+    mutable fl::RandomEngine generator_;
+    mutable fl::StandardNormalDistribution gaussian_distribution_;
     /** \endcond */
 };
 
@@ -136,15 +177,47 @@ public:
     StandardGaussian()
         : mu_(0.),
           var_(1.),
-          generator_(fl::seed()),
-          gaussian_distribution_(mu_, var_)
+          generator_(fl::random_seed(), fl::next_stream_id())
     { }
 
+    /**
+     * \copydoc StandardGaussian::seed
+     */
+    void seed(std::uint64_t seed, std::uint64_t stream_id, int substream = 0)
+    {
+        generator_.seed(seed, stream_id, substream);
+        gaussian_distribution_.reset();
+    }
+
     Real sample() const
     {
         return gaussian_distribution_(generator_);
     }
 
+    /**
+     * \brief Fills every coefficient of the given matrix with an independent
+     * standard normal variate.
+     */
+    template <typename Derived>
+    void fill(const Eigen::DenseBase<Derived>& samples) const
+    {
+        // samples is taken by const reference to accept temporary
+        // expressions such as m.col(i) and is written through a cast, see
+        // Eigen's "Writing Functions Taking Eigen Types as Parameters"
+        auto& out = const_cast<Eigen::DenseBase<Derived>&>(samples);
+
+        const int rows = out.rows();
+        const int cols = out.cols();
+
+        for (int j = 0; j < cols; ++j)
+        {
+            for (int i = 0; i < rows; ++i)
+            {
+                out(i, j) = gaussian_distribution_(generator_);
+            }
+        }
+    }
+
     virtual const Real& mean() const
     {
         return mu_;
@@ -159,8 +232,8 @@ protected:
     /** \cond internal */
     Real mu_;
     Real var_;
-    mutable fl::mt11213b generator_;
-    mutable std::normal_distribution<Real> gaussian_distribution_;
+    mutable fl::RandomEngine generator_;
+    mutable fl::StandardNormalDistribution gaussian_distribution_;
     /** \endcond */
 };
 
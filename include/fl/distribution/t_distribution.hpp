@@ -24,6 +24,8 @@
 #include <Eigen/Dense>
 
 #include <random>
+#include <limits>
+#include <cstdint>
 #include <boost/math/distributions.hpp>
 
 #include <fl/util/meta.hpp>
@@ -45,6 +47,12 @@ namespace fl
  * \f$t_\nu(\mu, \Sigma)\f$, where \f$\nu \in \mathbb{R} \f$ is the
  * degree-of-freedom, \f$\mu\in \mathbb{R}^n\f$ the distribution location and
  * \f$\Sigma \in \mathbb{R}^{n\times n} \f$ the scaling or covariance matrix.
+ *
+ * A sample is given by \f$\mu + \sqrt{\nu / u}\, L z\f$ with
+ * \f$z \sim {\cal N}(0, I)\f$, \f$u \sim \chi^2_\nu\f$ and
+ * \f$LL^T = \Sigma\f$. sample() and fill() draw \f$u\f$ directly using
+ * ChiSquared::sample() whereas map_standard_normal() maps the last component
+ * of the standard normal variate through the \f$\chi^2_\nu\f$ inverse CDF.
  */
 template <typename Variate>
 class TDistribution
@@ -116,13 +124,65 @@ public:
         assert(sample.size() == dimension() + 1);
 
         Real u = chi2_.map_standard_normal(sample.bottomRows(1)(0));
-        Variate n = normal_.map_standard_normal(sample.topRows(dimension()));
+        Variate n = normal_.square_root() * sample.topRows(dimension());
 
         // rvo
         Variate v = location() + std::sqrt(degrees_of_freedom() / u) * n;
         return v;
     }
 
+    /**
+     * \brief Returns a t-distribution sample. The \f$\chi^2_\nu\f$ variate is
+     * drawn by gamma sampling instead of the inverse CDF mapping used by
+     * map_standard_normal().
+     */
+    Variate sample() const override
+    {
+        Variate z = Variate::Zero(dimension());
+        this->standard_gaussian_.fill(z);
+
+        const Real u = chi2_.sample();
+
+        // rvo
+        Variate v = location()
+                    + std::sqrt(degrees_of_freedom() / u)
+                      * (normal_.square_root() * z);
+        return v;
+    }
+
+    /**
+     * \brief Fills each column of \a samples with an independent
+     * t-distribution sample. \a samples must have dimension() rows.
+     */
+    template <typename Derived>
+    void fill(Eigen::MatrixBase<Derived>& samples) const
+    {
+        assert(samples.rows() == dimension());
+
+        this->standard_gaussian_.fill(samples);
+        samples = normal_.square_root() * samples;
+
+        const Real dof = degrees_of_freedom();
+        for (int i = 0; i < samples.cols(); ++i)
+        {
+            samples.col(i) *= std::sqrt(dof / Real(chi2_.sample()));
+        }
+
+        samples.colwise() += location();
+    }
+
+    /**
+     * \brief Restarts the sampling on the stream \a stream_id of \a seed,
+     * see fl::Philox4x32. The normal variates are drawn from the substream 0
+     * and the \f$\chi^2_\nu\f$ variates from the substreams 2 and 3 such
+     * that they are independent of each other.
+     */
+    void seed(std::uint64_t seed, std::uint64_t stream_id) override
+    {
+        StdGaussianMappingBase::seed(seed, stream_id);
+        chi2_.seed(seed, stream_id, 2);
+    }
+
     /**
      * \brief Returns the log. probability of the given sample \c variate
      *
@@ -150,6 +210,23 @@ public:
         return cached_log_pdf_.log_probability(*this, x);
     }
 
+    /**
+     * \brief Returns the log. probabilities of all columns of \a points
+     *
+     * This is the batch version of log_probability(). The quadratic forms of
+     * all points are obtained from a single triangular solve with the cached
+     * Cholesky factor of the scaling matrix, hence the cost per point is the
+     * same as for a Gaussian log. density.
+     *
+     * \param points   Matrix with one point per column and dimension() rows
+     */
+    template <typename Points>
+    Eigen::Array<Real, Eigen::Dynamic, 1>
+    log_probabilities(const Eigen::MatrixBase<Points>& points) const
+    {
+        return cached_log_pdf_.log_probabilities(*this, points);
+    }
+
     /**
      * \brief Returns the Gaussian variate dimension
      */
@@ -219,7 +296,6 @@ public:
     virtual void location(const Variate& new_location) noexcept
     {
         normal_.mean(new_location);
-        cached_log_pdf_.flag_dirty();
     }
 
     /**
@@ -264,9 +340,21 @@ protected:
 
 
 private:
+    /**
+     * \brief Caches the Cholesky factor \f$L\f$ of the scaling matrix and the
+     * normalization constant of the log. density. The quadratic form
+     * \f$(x-\mu)^T\Sigma^{-1}(x-\mu) = \|L^{-1}(x-\mu)\|^2\f$ is evaluated
+     * by a triangular solve instead of a dense inverse. The cache depends on
+     * the scaling matrix and the degree-of-freedom only. Changing the
+     * location does not invalidate it.
+     */
     class CachedLogPdf
     {
     public:
+        typedef Eigen::Matrix<
+                    Real, SizeOf<Variate>::Value, SizeOf<Variate>::Value
+                > CholeskyFactor;
+
         CachedLogPdf()
             : dirty_(true)
         { }
@@ -279,28 +367,83 @@ private:
         {
             if (dirty_) update(t_distr);
 
-            Variate z = x - t_distr.location();
-            Real dof = t_distr.degrees_of_freedom();
+            if (!full_rank_) return -std::numeric_limits<Real>::infinity();
 
-            Real quad_term = (z.transpose() * t_distr.normal_.precision() * z);
-            Real ln_term = std::log(Real(1) + quad_term  / dof);
+            Eigen::Matrix<Real, SizeOf<Variate>::Value, 1> z =
+                x - t_distr.location();
 
-            return const_term_ - const_factor_ * ln_term;
+            cholesky_factor_.template triangularView<Eigen::Lower>()
+                .solveInPlace(z);
+
+            return log_probability_of_quad_term(t_distr, z.squaredNorm());
+        }
+
+        /**
+         * Evaluates the t-distribution pdf at each column of \c points using
+         * a single triangular solve for all columns
+         */
+        template <typename Points>
+        Eigen::Array<Real, Eigen::Dynamic, 1> log_probabilities(
+                const TDistribution<Variate>& t_distr,
+                const Eigen::MatrixBase<Points>& points)
+        {
+            assert(points.rows() == t_distr.dimension());
+
+            if (dirty_) update(t_distr);
+
+            if (!full_rank_)
+            {
+                return Eigen::Array<Real, Eigen::Dynamic, 1>::Constant(
+                    points.cols(), -std::numeric_limits<Real>::infinity());
+            }
+
+            Eigen::Matrix<Real, SizeOf<Variate>::Value, Eigen::Dynamic> z =
+                points.colwise() - t_distr.location();
+
+            cholesky_factor_.template triangularView<Eigen::Lower>()
+                .solveInPlace(z);
+
+            const Real dof = t_distr.degrees_of_freedom();
+
+            return const_term_
+                   - const_factor_
+                     * (z.colwise().squaredNorm().transpose().array() / dof)
+                           .log1p();
         }
 
         void flag_dirty() { dirty_ = true; }
 
     private:
+        Real log_probability_of_quad_term(
+                const TDistribution<Variate>& t_distr, Real quad_term) const
+        {
+            Real dof = t_distr.degrees_of_freedom();
+            Real ln_term = std::log1p(quad_term / dof);
+
+            return const_term_ - const_factor_ * ln_term;
+        }
+
         void update(const TDistribution<Variate>& t_distr)
         {
             Real half = Real(1)/Real(2);
             Real dim = t_distr.dimension();
             Real dof = t_distr.degrees_of_freedom();
+
+            Eigen::LLT<CholeskyFactor> llt(
+                CholeskyFactor(t_distr.normal_.covariance()));
+
+            full_rank_ = (llt.info() == Eigen::Success);
+            cholesky_factor_ = llt.matrixL();
+
+            // log |Sigma| = 2 sum_i log L_ii
+            Real log_determinant =
+                2 * cholesky_factor_.diagonal().array().log().sum();
+
             const_term_ =
                 boost::math::lgamma(half * (dof + dim))
                 - boost::math::lgamma(half * dof)
                 - half * (dim * std::log(M_PI * dof))
-                - half * (std::log(t_distr.normal_.covariance_determinant()));
+                - half * log_determinant;
 
             const_factor_ = half * (dof + dim);
 
@@ -308,8 +451,10 @@ private:
         }
 
         bool dirty_;
+        bool full_rank_;
         Real const_factor_;
         Real const_term_;
+        CholeskyFactor cholesky_factor_;
     };
 
     friend class CachedLogPdf;
@@ -91,6 +91,29 @@ public:
                   fl::erfinv(2.0 * truncated_uniform_sample - 1.0);
     }
 
+    virtual Real map_standard_normal(
+        const StandardVariate& gaussian_sample) const override
+    {
+        return map_standard_normal(Real(gaussian_sample));
+    }
+
+    /**
+     * \brief Batch version of map_standard_normal(const Real&) using the
+     * vectorized fl::normal_to_uniform and fl::uniform_to_normal
+     */
+    template <typename Derived>
+    typename Derived::PlainObject
+    map_standard_normal(const Eigen::ArrayBase<Derived>& gaussian_samples) const
+    {
+        // map from a gaussian onto a truncated uniform distribution
+        typename Derived::PlainObject truncated_uniform_samples =
+            cumulative_min_ + (cumulative_max_ - cumulative_min_)
+                              * fl::normal_to_uniform(gaussian_samples);
+
+        // map onto truncated gaussian
+        return mean_ + sigma_ * fl::uniform_to_normal(truncated_uniform_samples);
+    }
+
 private:
     virtual void ComputeAuxiliaryParameters()
     {
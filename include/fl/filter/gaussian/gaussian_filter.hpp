@@ -21,6 +21,9 @@
 
 
 #include "transform/unscented_transform.hpp"
+#include "transform/cubature_transform.hpp"
+#include "transform/spherical_simplex_transform.hpp"
+#include "transform/sparse_grid_gauss_hermite_transform.hpp"
 #include "transform/monte_carlo_transform.hpp"
 
 #include "quadrature/sigma_point_quadrature.hpp"
@@ -29,3 +32,4 @@
 #include "gaussian_filter_linear.hpp"
 #include "gaussian_filter_nonlinear.hpp"
 #include "gaussian_filter_nonlinear_generic.hpp"
+#include "gaussian_filter_extended.hpp"
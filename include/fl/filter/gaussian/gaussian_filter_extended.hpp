@@ -0,0 +1,106 @@
+/*
+ * This is part of the fl library, a C++ Bayesian filtering library
+ * (https://github.com/filtering-library)
+ *
+ * Copyright (c) 2015 Max Planck Society,
+ * 				 Autonomous Motion Department,
+ * 			     Institute for Intelligent Systems
+ *
+ * This Source Code Form is subject to the terms of the MIT License (MIT).
+ * A copy of the license can be found in the LICENSE file distributed with this
+ * source code.
+ */
+
+/**
+ * \file gaussian_filter_extended.hpp
+ * \date October 2026
+ * \author agent (agent@local)
+ */
+
+#pragma once
+
+
+#include <fl/util/meta.hpp>
+#include <fl/util/traits.hpp>
+#include <fl/filter/gaussian/gaussian_filter_nonlinear_generic.hpp>
+#include <fl/filter/gaussian/linearization/auto_diff_linearization.hpp>
+#include <fl/filter/gaussian/update_policy/extended_update_policy.hpp>
+#include <fl/filter/gaussian/prediction_policy/extended_prediction_policy.hpp>
+
+namespace fl
+{
+
+/**
+ * \ingroup nonlinear_gaussian_filter
+ *
+ * Extended Kalman Filter. The models are linearized at the mean of the belief
+ * by means of the AutoDiffLinearization which takes the place of the
+ * quadrature of the sigma point filters, i.e.
+ *
+ * \code
+ * GaussianFilter<StateTransitionFunction,
+ *                ObservationFunction,
+ *                AutoDiffLinearization>
+ * \endcode
+ *
+ * As in the sigma point filters, the policies are selected by the type of
+ * the models. Linear models marked as Linear<Model>, see IsLinear, are
+ * predicted and updated in closed form and all other models according to
+ * their additivity, see AdditivityOf. The ExtendedPredictPolicy and ExtendedUpdatePolicy may also
+ * be combined with other policies by means of the generic GaussianFilter.
+ *
+ * \tparam StateTransitionFunction
+ * \tparam ObservationFunction
+ */
+template<
+    typename StateTransitionFunction,
+    typename ObservationFunction
+>
+class GaussianFilter<
+          StateTransitionFunction,
+          ObservationFunction,
+          AutoDiffLinearization>
+    :
+    /* Implement the filter interface */
+#ifndef GENERATING_DOCUMENTATION
+    public GaussianFilter<
+               typename RemoveAdditivityOf<StateTransitionFunction>::Type,
+               typename RemoveAdditivityOf<ObservationFunction>::Type,
+               AutoDiffLinearization,
+               ExtendedPredictPolicy<
+                   AutoDiffLinearization,
+                   typename LinearityOf<StateTransitionFunction>::Type>,
+               ExtendedUpdatePolicy<
+                   AutoDiffLinearization,
+                   typename LinearityOf<ObservationFunction>::Type>>
+#else
+    public GaussianFilter<
+               StateTransitionFunction,
+               ObservationFunction,
+               AutoDiffLinearization,
+               PredictionPolicy,
+               UpdatePolicy>
+#endif
+{
+public:
+    GaussianFilter(
+        const typename RemoveAdditivityOf<StateTransitionFunction>::Type&
+            process_model,
+        const typename RemoveAdditivityOf<ObservationFunction>::Type&
+            obsrv_model,
+        const AutoDiffLinearization& linearization = AutoDiffLinearization())
+        : GaussianFilter<
+              typename RemoveAdditivityOf<StateTransitionFunction>::Type,
+              typename RemoveAdditivityOf<ObservationFunction>::Type,
+              AutoDiffLinearization,
+              ExtendedPredictPolicy<
+                  AutoDiffLinearization,
+                  typename LinearityOf<StateTransitionFunction>::Type>,
+              ExtendedUpdatePolicy<
+                  AutoDiffLinearization,
+                  typename LinearityOf<ObservationFunction>::Type>>
+          (process_model, obsrv_model, linearization)
+    { }
+};
+
+}
@@ -25,6 +25,7 @@
 #include <fl/util/meta.hpp>
 #include <fl/util/traits.hpp>
 #include <fl/util/profiling.hpp>
+#include <fl/util/math/linear_algebra.hpp>
 
 #include <fl/exception/exception.hpp>
 #include <fl/filter/filter_interface.hpp>
@@ -143,15 +144,21 @@ public:
                          const Input& input,
                          Belief& predicted_belief)
     {
-        auto A = process_model_.dynamics_matrix();
-        auto B = process_model_.input_matrix();
-        auto Q = process_model_.noise_covariance();
+        auto&& A = process_model_.dynamics_matrix();
+        auto&& B = process_model_.input_matrix();
+        auto&& Q = process_model_.noise_covariance();
 
-        predicted_belief.mean(
-            A * prior_belief.mean() + B * input);
+        // the moments are evaluated into the workspaces first since
+        // prior_belief and predicted_belief may be the same object
+        mean_.noalias() = A * prior_belief.mean();
+        mean_.noalias() += B * input;
 
-        predicted_belief.covariance(
-            A * prior_belief.covariance() * A.transpose() + Q);
+        transition_cov_.noalias() = A * prior_belief.covariance();
+        cov_.noalias() = transition_cov_ * A.transpose();
+        cov_ += Q;
+
+        predicted_belief.mean(mean_);
+        predicted_belief.covariance(cov_);
     }
 
     /**
@@ -174,22 +181,42 @@ public:
      * with the KalmanGain
      *
      * \f$ K = \bar{\Sigma}_{t}H^T (H\bar{\Sigma}_{t}H^T+R)^{-1}\f$.
+     *
+     * Instead of inverting the innovation covariance \f$S = H\bar{\Sigma}_{t}
+     * H^T+R\f$, the transposed gain \f$K^T = S^{-1}H\bar{\Sigma}_{t}\f$ is
+     * obtained from a single factorization of \f$S\f$ (see
+     * SymmetricFactorization). All intermediate results
+     * are kept in workspaces which are sized during the first update.
      */
     virtual void update(const Belief& predicted_belief,
                         const Obsrv& y,
                         Belief& posterior_belief)
     {
-        auto H = obsrv_model_.sensor_matrix();
-        auto R = obsrv_model_.noise_covariance();
+        auto&& H = obsrv_model_.sensor_matrix();
+        auto&& R = obsrv_model_.noise_density().covariance();
+
+        auto&& mean = predicted_belief.mean();
+        auto&& cov_xx = predicted_belief.covariance();
+
+        obsrv_state_cov_.noalias() = H * cov_xx;
+        innovation_cov_.noalias() = obsrv_state_cov_ * H.transpose();
+        innovation_cov_ += R;
 
-        auto mean = predicted_belief.mean();
-        auto cov_xx = predicted_belief.covariance();
+        innovation_cov_factor_.compute(innovation_cov_);
+        gain_transpose_ = obsrv_state_cov_;
+        innovation_cov_factor_.solve_in_place(gain_transpose_);
 
-        auto S = (H * cov_xx * H.transpose() + R).eval();
-        auto K = (cov_xx * H.transpose() * S.inverse()).eval();
+        innovation_ = y;
+        innovation_.noalias() -= H * mean;
 
-        posterior_belief.mean(mean + K * (y - H * mean));
-        posterior_belief.covariance(cov_xx - K * H * cov_xx);
+        mean_ = mean;
+        mean_.noalias() += gain_transpose_.transpose() * innovation_;
+
+        cov_ = cov_xx;
+        cov_.noalias() -= gain_transpose_.transpose() * obsrv_state_cov_;
+
+        posterior_belief.mean(mean_);
+        posterior_belief.covariance(cov_);
     }
 
     virtual Belief create_belief() const
@@ -237,8 +264,24 @@ public:
 
 protected:
     /** \cond internal */
+    typedef typename Belief::SecondMoment StateCovariance;
+    typedef typename Gaussian<Obsrv>::SecondMoment ObsrvCovariance;
+    typedef Eigen::Matrix<
+                Real, SizeOf<Obsrv>::Value, SizeOf<State>::Value
+            > ObsrvStateMatrix;
+
     LinearStateTransitionModel process_model_;
     LinearObservationModel obsrv_model_;
+
+    /* workspaces which keep their storage between the filter steps */
+    State mean_;
+    StateCovariance cov_;
+    StateCovariance transition_cov_;
+    Obsrv innovation_;
+    ObsrvCovariance innovation_cov_;
+    ObsrvStateMatrix obsrv_state_cov_;
+    ObsrvStateMatrix gain_transpose_;
+    SymmetricFactorization<ObsrvCovariance> innovation_cov_factor_;
     /** \endcond */
 };
 
@@ -26,8 +26,12 @@
 #include <fl/filter/gaussian/update_policy/sigma_point_update_policy.hpp>
 #include <fl/filter/gaussian/update_policy/sigma_point_additive_update_policy.hpp>
 #include <fl/filter/gaussian/update_policy/sigma_point_additive_uncorrelated_update_policy.hpp>
+#include <fl/filter/gaussian/update_policy/sigma_point_linear_update_policy.hpp>
+#include <fl/filter/gaussian/update_policy/sigma_point_conditionally_linear_update_policy.hpp>
 #include <fl/filter/gaussian/prediction_policy/sigma_point_additive_prediction_policy.hpp>
 #include <fl/filter/gaussian/prediction_policy/sigma_point_prediction_policy.hpp>
+#include <fl/filter/gaussian/prediction_policy/sigma_point_linear_prediction_policy.hpp>
+#include <fl/filter/gaussian/prediction_policy/sigma_point_conditionally_linear_prediction_policy.hpp>
 
 namespace fl
 {
@@ -45,6 +49,18 @@ namespace fl
  * This includes the Kalman Filter and filters using non-linear models such as
  * Sigma Point Kalman Filter family.
  *
+ * The policies are selected by the type of the models. Linear models which
+ * are marked as Linear<Model>, see IsLinear, are predicted and updated in
+ * closed form. Hence, a filter of a linear and a nonlinear model only
+ * integrates the nonlinear half by means of the quadrature. Models which
+ * are linear in a substate given the remaining substate, see
+ * IsConditionallyLinear, are Rao-Blackwellized, i.e. the quadrature is
+ * applied to the nonlinear substate only while the linear substate is
+ * integrated in closed form. All other models, including unmarked linear
+ * models, are integrated according to their additivity, see AdditivityOf. A
+ * conditionally linear model may be marked explicitly, e.g. as
+ * Additive<Model>, in order to integrate it numerically as well.
+ *
  * \tparam StateTransitionFunction
  * \tparam ObservationFunction
  * \tparam Quadrature
@@ -65,10 +81,10 @@ class GaussianFilter<StateTransitionFunction, ObservationFunction, Quadrature>
                Quadrature,
                SigmaPointPredictPolicy<
                    Quadrature,
-                   typename AdditivityOf<StateTransitionFunction>::Type>,
+                   typename LinearityOf<StateTransitionFunction>::Type>,
                SigmaPointUpdatePolicy<
                    Quadrature,
-                   typename AdditivityOf<ObservationFunction>::Type>>
+                   typename LinearityOf<ObservationFunction>::Type>>
 #else
     public GaussianFilter<
                StateTransitionFunction,
@@ -79,19 +95,22 @@ class GaussianFilter<StateTransitionFunction, ObservationFunction, Quadrature>
 #endif
 {
 public:
-    GaussianFilter(const StateTransitionFunction& process_model,
-                   const ObservationFunction& obsrv_model,
-                   const Quadrature& quadrature)
+    GaussianFilter(
+        const typename RemoveAdditivityOf<StateTransitionFunction>::Type&
+            process_model,
+        const typename RemoveAdditivityOf<ObservationFunction>::Type&
+            obsrv_model,
+        const Quadrature& quadrature)
         : GaussianFilter<
               typename RemoveAdditivityOf<StateTransitionFunction>::Type,
               typename RemoveAdditivityOf<ObservationFunction>::Type,
               Quadrature,
               SigmaPointPredictPolicy<
                   Quadrature,
-                  typename AdditivityOf<StateTransitionFunction>::Type>,
+                  typename LinearityOf<StateTransitionFunction>::Type>,
               SigmaPointUpdatePolicy<
                   Quadrature,
-                  typename AdditivityOf<ObservationFunction>::Type>>
+                  typename LinearityOf<ObservationFunction>::Type>>
           (process_model, obsrv_model, quadrature)
     { }
 };
@@ -20,6 +20,8 @@
 #pragma once
 
 
+#include <type_traits>
+
 #include <Eigen/Dense>
 
 #include <fl/util/meta.hpp>
@@ -57,9 +59,13 @@ struct Traits<
            GaussianFilter<
                StateTransitionModel, ObservationModel, Quadrature, Policies...>>
 {
-    typedef typename StateTransitionModel::State State;
-    typedef typename StateTransitionModel::Input Input;
-    typedef typename ObservationModel::Obsrv Obsrv;
+    // the models may be marked explicitly, e.g. as Additive<Model>
+    typedef typename RemoveAdditivityOf<StateTransitionModel>::Type Transition;
+    typedef typename RemoveAdditivityOf<ObservationModel>::Type Sensor;
+
+    typedef typename Transition::State State;
+    typedef typename Transition::Input Input;
+    typedef typename Sensor::Obsrv Obsrv;
     typedef Gaussian<State> Belief;
 };
 
@@ -120,7 +126,8 @@ public:
                    const Quadrature& quadrature)
         : process_model_(process_model),
           obsrv_model_(obsrv_model),
-          quadrature_(quadrature)
+          quadrature_(quadrature),
+          reuse_predicted_points_(false)
     { }
 
     /**
@@ -156,6 +163,72 @@ public:
                        posterior_belief);
     }
 
+    /**
+     * \return Log. likelihood \f$\log {\cal N}(y; \hat{y}, S)\f$ of the
+     *         observation of the last update under the predicted observation
+     *         moments \f$\hat{y}, S\f$ computed by the update policy
+     */
+    Real log_likelihood() const
+    {
+        return update_policy_.log_likelihood();
+    }
+
+    /**
+     * \brief Predicts and updates the belief in one step.
+     *
+     * By default this is identical to predict() followed by update(). If
+     * reuse_predicted_points() is enabled, the points propagated by the
+     * prediction are passed on to the update instead of points generated from
+     * the predicted belief. This saves one factorization of the predicted
+     * covariance and one point generation per step. However, the update then
+     * integrates over the predicted points rather than a Gaussian, which
+     * changes the approximation slightly. Update policies of non-additive
+     * observation noise always regenerate their points. Predictions in closed
+     * form or by linearization, e.g. of linear models or by the
+     * AutoDiffLinearization, provide no points.
+     *
+     * \param prior_belief        Prior state distribution
+     * \param input               Control input argument
+     * \param obsrv               Latest observation
+     * \param posterior_belief    Updated posterior state distribution
+     */
+    void predict_and_update(const Belief& prior_belief,
+                            const Input& input,
+                            const Obsrv& obsrv,
+                            Belief& posterior_belief)
+    {
+        predict(prior_belief, input, posterior_belief);
+
+        if (!reuse_predicted_points_)
+        {
+            update(posterior_belief, obsrv, posterior_belief);
+            return;
+        }
+
+        update_predicted_points(
+            obsrv,
+            posterior_belief,
+            std::is_base_of<
+                internal::MomentPredictionPolicyType, PredictionPolicy>());
+    }
+
+    /**
+     * \brief Enables or disables passing the predicted points on to the
+     *        update within predict_and_update()
+     */
+    void reuse_predicted_points(bool enabled)
+    {
+        reuse_predicted_points_ = enabled;
+    }
+
+    /**
+     * \brief Returns whether predict_and_update() reuses the predicted points
+     */
+    bool reuse_predicted_points() const
+    {
+        return reuse_predicted_points_;
+    }
+
 public: /* factory functions */
     virtual Belief create_belief() const
     {
@@ -219,11 +292,42 @@ public: /* accessors & mutators */
 
 protected:
     /** \cond internal */
+
+    /**
+     * \brief Updates the \a predicted_belief given the points of the last
+     *        prediction
+     */
+    void update_predicted_points(const Obsrv& obsrv,
+                                 Belief& predicted_belief,
+                                 std::false_type)
+    {
+        update_policy_.update_points(
+            obsrv_model(),
+            quadrature(),
+            predicted_belief,
+            prediction_policy_.predicted_points(process_model()),
+            obsrv,
+            predicted_belief);
+    }
+
+    /**
+     * \brief Predictions of the moments, e.g. in closed form or by
+     *        linearization, create no points and the update falls back to
+     *        the predicted belief
+     */
+    void update_predicted_points(const Obsrv& obsrv,
+                                 Belief& predicted_belief,
+                                 std::true_type)
+    {
+        update(predicted_belief, obsrv, predicted_belief);
+    }
+
     StateTransitionFunction process_model_;
     ObservationFunction obsrv_model_;
     Quadrature quadrature_;
     PredictionPolicy prediction_policy_;
     UpdatePolicy update_policy_;
+    bool reuse_predicted_points_;
     /** \endcond */
 };
 
@@ -0,0 +1,480 @@
+/*
+ * This is part of the fl library, a C++ Bayesian filtering library
+ * (https://github.com/filtering-library)
+ *
+ * Copyright (c) 2015 Max Planck Society,
+ * 				 Autonomous Motion Department,
+ * 			     Institute for Intelligent Systems
+ *
+ * This Source Code Form is subject to the terms of the MIT License (MIT).
+ * A copy of the license can be found in the LICENSE file distributed with this
+ * source code.
+ */
+
+/**
+ * \file gaussian_sum_filter.hpp
+ * \date October 2026
+ * \author agent (agent@local)
+ */
+
+#pragma once
+
+
+#include <Eigen/Dense>
+
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <vector>
+#include <algorithm>
+#include <exception>
+
+#include <fl/util/meta.hpp>
+#include <fl/util/types.hpp>
+#include <fl/util/traits.hpp>
+#include <fl/util/random.hpp>
+#include <fl/exception/exception.hpp>
+#include <fl/filter/filter_interface.hpp>
+#include <fl/distribution/gaussian.hpp>
+#include <fl/distribution/gaussian_mixture.hpp>
+
+namespace fl
+{
+
+// Forward delcaration
+template <typename GaussianFilter> class GaussianSumFilter;
+
+/**
+ * \internal
+ * \ingroup nonlinear_gaussian_filter
+ *
+ * GaussianSumFilter traits
+ */
+template <typename GaussianFilter>
+struct Traits<GaussianSumFilter<GaussianFilter>>
+{
+    typedef typename GaussianFilter::State State;
+    typedef typename GaussianFilter::Input Input;
+    typedef typename GaussianFilter::Obsrv Obsrv;
+    typedef GaussianMixture<State> Belief;
+};
+
+/**
+ * \ingroup nonlinear_gaussian_filter
+ *
+ * \brief Gaussian sum filter \cite alspach1972nonlinear. The belief is a
+ * GaussianMixture and each component is predicted and updated by its own
+ * copy of a sigma point GaussianFilter.
+ *
+ * The prediction leaves the component weights unchanged. The update scales
+ * each weight by the marginal likelihood of the observation under its
+ * component, \f$w_k \propto w_k\, {\cal N}(y; \hat{y}_k, S_k)\f$. The
+ * predicted observation moments \f$\hat{y}_k, S_k\f$ are those of the
+ * update of the component filter, see GaussianFilter::log_likelihood(), such
+ * that the observation model is evaluated only once per sigma point.
+ *
+ * Components are independent of each other. If the library is built with
+ * OpenMP (fl_USE_OPENMP) the components are processed in parallel. Component
+ * filters with a random point set transform, e.g. the MonteCarloTransform,
+ * sample on a stream of their own, see fl::next_stream_id().
+ *
+ * After every update the mixture is reduced, see reduce():
+ *  - components with a weight below prune_weight() are removed,
+ *  - pairs of components are merged while there are more than
+ *    max_components() components or while the cheapest merge costs less
+ *    than merge_threshold(). The cost of a merge is Runnalls' upper bound on
+ *    the Kullback-Leibler divergence it introduces
+ *    \cite runnalls2007kullback. The merged component preserves the mean
+ *    and covariance of the merged pair.
+ *
+ * \tparam GaussianFilter   GaussianFilter providing \c log_likelihood() of
+ *                          its last update
+ */
+template <typename GaussianFilter>
+class GaussianSumFilter
+    : public FilterInterface<GaussianSumFilter<GaussianFilter>>
+{
+public:
+    typedef typename Traits<GaussianSumFilter>::State State;
+    typedef typename Traits<GaussianSumFilter>::Input Input;
+    typedef typename Traits<GaussianSumFilter>::Obsrv Obsrv;
+    typedef typename Traits<GaussianSumFilter>::Belief Belief;
+
+    /**
+     * \brief Belief type of the component filter
+     */
+    typedef Gaussian<State> Component;
+
+    /**
+     * \brief Creates a GaussianSumFilter
+     *
+     * \param filter            Component filter prototype
+     * \param max_components    Component budget after each update
+     * \param prune_weight      Components with a lower weight are removed
+     * \param merge_threshold   Pairs of components with a lower merge cost
+     *                          are merged even within the budget
+     */
+    explicit GaussianSumFilter(const GaussianFilter& filter,
+                               int max_components = 8,
+                               Real prune_weight = 1.e-4,
+                               Real merge_threshold = 1.e-3)
+        : filter_(filter),
+          max_components_(max_components),
+          prune_weight_(prune_weight),
+          merge_threshold_(merge_threshold),
+          prototype_modified_(false)
+    {
+        if (max_components_ < 1)
+        {
+            fl_throw(Exception("GaussianSumFilter requires a component budget "
+                               "of at least one"));
+        }
+    }
+
+    /**
+     * \brief Overridable default destructor
+     */
+    virtual ~GaussianSumFilter() noexcept { }
+
+    /**
+     * \copydoc FilterInterface::predict
+     *
+     * Each component is predicted by its component filter. The weights are
+     * carried over.
+     */
+    virtual void predict(const Belief& prior_belief,
+                         const Input& input,
+                         Belief& predicted_belief)
+    {
+        const int count = prior_belief.count();
+        allocate(count, prior_belief.dimension());
+
+        for_each_component(count, [&](int k)
+        {
+            filters_[k].predict(prior_belief.component(k),
+                                input,
+                                components_[k]);
+        });
+
+        assign(prior_belief.weights(), predicted_belief);
+    }
+
+    /**
+     * \copydoc FilterInterface::update
+     *
+     * Each component is updated by its component filter and its weight is
+     * scaled by the marginal observation likelihood. Finally the mixture is
+     * reduced.
+     */
+    virtual void update(const Belief& predicted_belief,
+                        const Obsrv& obsrv,
+                        Belief& posterior_belief)
+    {
+        const int count = predicted_belief.count();
+        allocate(count, predicted_belief.dimension());
+
+        log_likelihoods_.resize(count);
+
+        for_each_component(count, [&](int k)
+        {
+            filters_[k].update(predicted_belief.component(k),
+                               obsrv,
+                               components_[k]);
+
+            log_likelihoods_(k) = filters_[k].log_likelihood();
+        });
+
+        typename Belief::Weights log_weights =
+            predicted_belief.weights().log() + log_likelihoods_;
+
+        const Real max_log_weight = log_weights.maxCoeff();
+
+        // if the observation is impossible under all components, e.g. due to
+        // an underflow, the prior weights are kept
+        if (std::isfinite(max_log_weight))
+        {
+            assign((log_weights - max_log_weight).exp(), posterior_belief);
+        }
+        else
+        {
+            assign(predicted_belief.weights(), posterior_belief);
+        }
+
+        reduce(posterior_belief);
+    }
+
+    /**
+     * \brief Prunes and merges the components of \a mixture in place
+     */
+    void reduce(Belief& mixture) const
+    {
+        const int count = mixture.count();
+        if (count == 0) return;
+
+        std::vector<Component, Eigen::aligned_allocator<Component>>
+            components;
+        std::vector<Real> weights;
+
+        // prune, but always keep the heaviest component
+        int heaviest;
+        mixture.weights().maxCoeff(&heaviest);
+        for (int k = 0; k < count; ++k)
+        {
+            if (k == heaviest || mixture.weights()(k) >= prune_weight_)
+            {
+                components.push_back(mixture.component(k));
+                weights.push_back(mixture.weights()(k));
+            }
+        }
+
+        // greedily merge the cheapest pair
+        while (components.size() > 1)
+        {
+            Real min_cost = std::numeric_limits<Real>::infinity();
+            int min_i = 0, min_j = 1;
+
+            for (int i = 0; i < int(components.size()); ++i)
+            {
+                for (int j = i + 1; j < int(components.size()); ++j)
+                {
+                    const Real cost = merge_cost(components[i], weights[i],
+                                                 components[j], weights[j]);
+                    if (cost < min_cost)
+                    {
+                        min_cost = cost;
+                        min_i = i;
+                        min_j = j;
+                    }
+                }
+            }
+
+            if (int(components.size()) <= max_components_ &&
+                !(min_cost < merge_threshold_))
+            {
+                break;
+            }
+
+            components[min_i] = merge(components[min_i], weights[min_i],
+                                      components[min_j], weights[min_j]);
+            weights[min_i] += weights[min_j];
+            components.erase(components.begin() + min_j);
+            weights.erase(weights.begin() + min_j);
+        }
+
+        if (int(components.size()) == count) return;
+
+        Belief reduced(mixture.dimension());
+        for (int k = 0; k < int(components.size()); ++k)
+        {
+            reduced.add_component(components[k], weights[k]);
+        }
+        mixture = reduced;
+    }
+
+public: /* factory functions */
+    virtual Belief create_belief() const
+    {
+        Belief belief(filter_.create_belief().dimension());
+        belief.add_component(filter_.create_belief(), Real(1));
+        return belief; // RVO
+    }
+
+public: /* accessors & mutators */
+    /**
+     * \brief Component filter prototype. The component filters are created
+     *        from it. Obtaining the mutable prototype reassigns all
+     *        component filters from it on the next filter step such that
+     *        changes apply to all components.
+     */
+    GaussianFilter& filter()
+    {
+        prototype_modified_ = true;
+        return filter_;
+    }
+
+    const GaussianFilter& filter() const
+    {
+        return filter_;
+    }
+
+    int max_components() const { return max_components_; }
+    Real prune_weight() const { return prune_weight_; }
+    Real merge_threshold() const { return merge_threshold_; }
+
+    void max_components(int max_components)
+    {
+        max_components_ = std::max(max_components, 1);
+    }
+
+    void prune_weight(Real prune_weight) { prune_weight_ = prune_weight; }
+
+    void merge_threshold(Real merge_threshold)
+    {
+        merge_threshold_ = merge_threshold;
+    }
+
+    virtual std::string name() const
+    {
+        return "GaussianSumFilter<"
+                + this->list_arguments(filter_.name())
+                + ">";
+    }
+
+    virtual std::string description() const
+    {
+        return "Gaussian sum filter with component filter "
+                + this->list_descriptions(filter_.description());
+    }
+
+protected:
+    /** \cond internal */
+
+    /**
+     * \brief Ensures that there is one component filter and one result
+     *        component per mixture component. Component filters are copied
+     *        from the prototype when they are created and after the
+     *        prototype was modified. Otherwise they keep their state, such as
+     *        the position of their random stream.
+     */
+    void allocate(int count, int dimension)
+    {
+        if (prototype_modified_)
+        {
+            for (auto& filter : filters_)
+            {
+                filter = filter_;
+                reseed(filter, 0);
+            }
+            prototype_modified_ = false;
+        }
+
+        while (int(filters_.size()) < count)
+        {
+            filters_.push_back(filter_);
+            reseed(filters_.back(), 0);
+        }
+
+        components_.resize(count, Component(dimension));
+    }
+
+    /**
+     * \brief Moves the point set transform of \a filter onto a new random
+     *        stream if the transform is random
+     */
+    template <typename Filter>
+    static auto reseed(Filter& filter, int)
+        -> decltype(filter.quadrature().transform().seed(std::uint64_t(),
+                                                         std::uint64_t()))
+    {
+        filter.quadrature().transform().seed(random_seed(), next_stream_id());
+    }
+
+    template <typename Filter>
+    static void reseed(Filter&, long) { }
+
+    /**
+     * \brief Invokes \a f for each component index. The invocations are
+     *        independent and run in parallel if OpenMP is enabled. The first
+     *        exception thrown is rethrown after all invocations finished.
+     */
+    template <typename F>
+    void for_each_component(int count, F&& f)
+    {
+        std::exception_ptr error;
+
+#ifdef _OPENMP
+        #pragma omp parallel for schedule(dynamic)
+#endif
+        for (int k = 0; k < count; ++k)
+        {
+            try
+            {
+                f(k);
+            }
+            catch (...)
+            {
+#ifdef _OPENMP
+                #pragma omp critical
+#endif
+                if (!error) error = std::current_exception();
+            }
+        }
+
+        if (error) std::rethrow_exception(error);
+    }
+
+    /**
+     * \brief Stores the filtered components along with the unnormalized
+     *        \a weights in \a mixture
+     */
+    template <typename Weights>
+    void assign(const Weights& weights, Belief& mixture) const
+    {
+        Belief result(components_.empty() ? mixture.dimension()
+                                          : components_[0].dimension());
+
+        for (int k = 0; k < weights.size(); ++k)
+        {
+            result.add_component(components_[k], weights(k));
+        }
+
+        mixture = result;
+    }
+
+    /**
+     * \return Moment preserving merge of two weighted components
+     */
+    static Component merge(const Component& a, Real w_a,
+                           const Component& b, Real w_b)
+    {
+        const Real w = w_a + w_b;
+        const Real alpha = w > 0 ? w_a / w : Real(0.5);
+        const Real beta = Real(1) - alpha;
+
+        const State delta = a.mean() - b.mean();
+
+        Component merged(a.dimension());
+        merged.mean(alpha * a.mean() + beta * b.mean());
+        merged.covariance(alpha * a.covariance()
+                          + beta * b.covariance()
+                          + alpha * beta * delta * delta.transpose());
+
+        return merged;
+    }
+
+    /**
+     * \return Runnalls' bound on the KL divergence caused by merging two
+     *         weighted components
+     */
+    static Real merge_cost(const Component& a, Real w_a,
+                           const Component& b, Real w_b)
+    {
+        const Component merged = merge(a, w_a, b, w_b);
+
+        return Real(0.5) * ((w_a + w_b) * log_det(merged.covariance())
+                            - w_a * log_det(a.covariance())
+                            - w_b * log_det(b.covariance()));
+    }
+
+    template <typename Matrix>
+    static Real log_det(const Matrix& covariance)
+    {
+        return Real(2) * covariance.llt().matrixLLT()
+                                   .diagonal().array().log().sum();
+    }
+
+    GaussianFilter filter_;
+    int max_components_;
+    Real prune_weight_;
+    Real merge_threshold_;
+    bool prototype_modified_;
+
+    std::vector<GaussianFilter, Eigen::aligned_allocator<GaussianFilter>>
+        filters_;
+    std::vector<Component, Eigen::aligned_allocator<Component>> components_;
+    typename Belief::Weights log_likelihoods_;
+
+    /** \endcond */
+};
+
+}
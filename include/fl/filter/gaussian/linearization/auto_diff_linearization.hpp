@@ -0,0 +1,80 @@
+/*
+ * This is part of the fl library, a C++ Bayesian filtering library
+ * (https://github.com/filtering-library)
+ *
+ * Copyright (c) 2015 Max Planck Society,
+ * 				 Autonomous Motion Department,
+ * 			     Institute for Intelligent Systems
+ *
+ * This Source Code Form is subject to the terms of the MIT License (MIT).
+ * A copy of the license can be found in the LICENSE file distributed with this
+ * source code.
+ */
+
+/**
+ * \file auto_diff_linearization.hpp
+ * \date October 2026
+ * \author agent (agent@local)
+ */
+
+#pragma once
+
+
+#include <string>
+
+#include <fl/util/types.hpp>
+#include <fl/util/descriptor.hpp>
+#include <fl/util/math/dual.hpp>
+
+namespace fl
+{
+
+/**
+ * \ingroup nonlinear_gaussian_filter
+ *
+ * \brief First order linearization of the models of a GaussianFilter by
+ * means of forward-mode automatic differentiation, i.e. the Extended Kalman
+ * Filter. It takes the place of the quadrature of a sigma point filter,
+ * e.g. \c GaussianFilter<Transition, Sensor, AutoDiffLinearization>.
+ *
+ * The Jacobians of the models are obtained by evaluating the model once on
+ * the mean with Dual scalars which carry the derivatives with respect to all
+ * state (and noise) dimensions at once. This replaces the \f$2n+1\f$ model
+ * evaluations of the unscented transform by a single pass which propagates
+ * \f$n\f$ derivatives per operation. The models must therefore be written
+ * generically in their scalar type. In addition to their interface, the
+ * models implement the member function templates
+ *
+ * - Additive state transition:
+ *   <tt>expected_state(const DualState& x, const Input& u)</tt>
+ * - Non-additive state transition:
+ *   <tt>state(const DualState& x, const DualNoise& v, const Input& u)</tt>
+ * - Additive observation:
+ *   <tt>expected_observation(const DualState& x)</tt>
+ * - Non-additive observation:
+ *   <tt>observation(const DualState& x, const DualNoise& w)</tt>
+ *
+ * where \c DualState and \c DualNoise are Eigen vectors of the sizes of
+ * \c State and \c Noise whose scalar is a Dual. The return value is the
+ * corresponding vector of Dual scalars. The virtual interface functions
+ * typically forward to these templates. Linear models marked as
+ * Linear<Model> are predicted and updated in closed form as in the sigma
+ * point filters and require no such templates.
+ */
+class AutoDiffLinearization
+    : public Descriptor
+{
+public:
+    virtual std::string name() const
+    {
+        return "AutoDiffLinearization";
+    }
+
+    virtual std::string description() const
+    {
+        return "First order linearization by forward-mode automatic "
+               "differentiation";
+    }
+};
+
+}
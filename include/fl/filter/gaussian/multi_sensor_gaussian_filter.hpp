@@ -37,6 +37,73 @@ namespace fl
 // Forward declarations
 template <typename...> class MultiSensorGaussianFilter;
 
+namespace internal
+{
+
+/**
+ * \internal
+ * \ingroup nonlinear_gaussian_filter
+ *
+ * Determines whether the local model of a joint observation model embeds a
+ * body-tail model, i.e. whether it is a RobustFeatureObsrvModel
+ */
+template <typename JointObservationFunction>
+struct HasEmbeddedObsrvModel
+{
+private:
+    template <typename M>
+    static std::true_type test(typename M::LocalModel::EmbeddedObsrvModel*);
+
+    template <typename M>
+    static std::false_type test(...);
+
+public:
+    enum : bool
+    {
+        Value = decltype(test<JointObservationFunction>(nullptr))::value
+    };
+};
+
+/**
+ * \internal
+ * \ingroup nonlinear_gaussian_filter
+ *
+ * Selects the MultiSensorSigmaPointUpdatePolicy for joint models of plain
+ * local models and the MultiSensorSigmaPointUpdatePolizzle for joint models
+ * of robust feature models
+ */
+template <
+    typename Quadrature,
+    typename JointObservationFunction,
+    bool Robust = HasEmbeddedObsrvModel<
+                      typename RemoveAdditivityOf<
+                          JointObservationFunction
+                      >::Type
+                  >::Value
+>
+struct MultiSensorUpdatePolicyOf
+{
+    typedef MultiSensorSigmaPointUpdatePolicy<
+                Quadrature,
+                typename AdditivityOf<JointObservationFunction>::Type
+            > Type;
+};
+
+/**
+ * \internal
+ * \ingroup nonlinear_gaussian_filter
+ */
+template <typename Quadrature, typename JointObservationFunction>
+struct MultiSensorUpdatePolicyOf<Quadrature, JointObservationFunction, true>
+{
+    typedef MultiSensorSigmaPointUpdatePolizzle<
+                Quadrature,
+                typename AdditivityOf<JointObservationFunction>::Type
+            > Type;
+};
+
+}
+
 /**
  * \internal
  * \ingroup nonlinear_gaussian_filter
@@ -83,9 +150,8 @@ class MultiSensorGaussianFilter<
                SigmaPointPredictPolicy<
                    Quadrature,
                    typename AdditivityOf<StateTransitionFunction>::Type>,
-               MultiSensorSigmaPointUpdatePolizzle<
-                   Quadrature,
-                   typename AdditivityOf<JointObservationFunction>::Type>>
+               typename internal::MultiSensorUpdatePolicyOf<
+                   Quadrature, JointObservationFunction>::Type>
 #else
     public GaussianFilter<
                StateTransitionFunction,
@@ -103,9 +169,8 @@ public:
                 SigmaPointPredictPolicy<
                     Quadrature,
                     typename AdditivityOf<StateTransitionFunction>::Type>,
-                MultiSensorSigmaPointUpdatePolizzle<
-                    Quadrature,
-                    typename AdditivityOf<JointObservationFunction>::Type>
+                typename internal::MultiSensorUpdatePolicyOf<
+                    Quadrature, JointObservationFunction>::Type
             > Base;
 
     MultiSensorGaussianFilter(
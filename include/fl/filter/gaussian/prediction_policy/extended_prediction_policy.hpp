@@ -0,0 +1,296 @@
+/*
+ * This is part of the fl library, a C++ Bayesian filtering library
+ * (https://github.com/filtering-library)
+ *
+ * Copyright (c) 2015 Max Planck Society,
+ * 				 Autonomous Motion Department,
+ * 			     Institute for Intelligent Systems
+ *
+ * This Source Code Form is subject to the terms of the MIT License (MIT).
+ * A copy of the license can be found in the LICENSE file distributed with this
+ * source code.
+ */
+
+/**
+ * \file extended_prediction_policy.hpp
+ * \date October 2026
+ * \author agent (agent@local)
+ */
+
+#pragma once
+
+
+#include <string>
+
+#include <Eigen/Dense>
+
+#include <fl/util/meta.hpp>
+#include <fl/util/traits.hpp>
+#include <fl/util/descriptor.hpp>
+#include <fl/util/math/dual.hpp>
+#include <fl/filter/gaussian/prediction_policy/sigma_point_linear_prediction_policy.hpp>
+
+namespace fl
+{
+
+// Forward declarations
+template <typename...> class ExtendedPredictPolicy;
+
+template <
+    typename Linearization,
+    typename StateTransitionFunction
+>
+class ExtendedPredictPolicy<
+          Linearization,
+          StateTransitionFunction>
+    : public ExtendedPredictPolicy<
+                Linearization,
+                NonAdditive<StateTransitionFunction>>
+{ };
+
+/**
+ * \ingroup nonlinear_gaussian_filter
+ *
+ * \brief Extended Kalman filter prediction of state transition models with
+ * additive noise \f$x_{t+1} = f(x_t, u_t) + v_t\f$.
+ *
+ * The model is linearized at the prior mean by a single evaluation of
+ * \c expected_state() on Dual scalars, see AutoDiffLinearization, which
+ * yields \f$f(\mu_t, u_t)\f$ and the Jacobian \f$F\f$. The prediction is
+ *
+ * \f$ \mu_{t+1} = f(\mu_t, u_t), \quad \Sigma_{t+1} = F\Sigma_tF^T + Q \f$
+ */
+template <
+    typename Linearization,
+    typename AdditiveStateTransitionFunction
+>
+class ExtendedPredictPolicy<
+          Linearization,
+          Additive<AdditiveStateTransitionFunction>>
+    : public Descriptor,
+      private internal::MomentPredictionPolicyType
+{
+public:
+    typedef typename AdditiveStateTransitionFunction::State State;
+    typedef typename AdditiveStateTransitionFunction::Input Input;
+
+    typedef Dual<Real, SizeOf<State>::Value> DualScalar;
+    typedef Eigen::Matrix<DualScalar, SizeOf<State>::Value, 1> DualState;
+
+    template <
+        typename Belief
+    >
+    void operator()(const AdditiveStateTransitionFunction&
+                              additive_state_transition_function,
+                    const Linearization& linearization,
+                    const Belief& prior_belief,
+                    const Input& u,
+                    Belief& predicted_belief)
+    {
+        const int dim = prior_belief.dimension();
+
+        dual_variables(prior_belief.mean(), 0, dim, dual_state_);
+        dual_predicted_state_ =
+            additive_state_transition_function.expected_state(dual_state_, u);
+
+        dual_value(dual_predicted_state_, mean_);
+        dual_jacobian(dual_predicted_state_, 0, dim, jacobian_);
+
+        transition_cov_.noalias() = jacobian_ * prior_belief.covariance();
+        cov_.noalias() = transition_cov_ * jacobian_.transpose();
+        cov_ += additive_state_transition_function.noise_covariance();
+
+        // changing the dimension resets the belief which creates temporaries
+        if (predicted_belief.dimension() != dim)
+        {
+            predicted_belief.dimension(dim);
+        }
+
+        predicted_belief.mean(mean_);
+        predicted_belief.covariance(cov_);
+    }
+
+    virtual std::string name() const
+    {
+        return "ExtendedPredictPolicy<"
+                + this->list_arguments(
+                       "Linearization",
+                       "Additive<AdditiveStateTransitionFunction>")
+                + ">";
+    }
+
+    virtual std::string description() const
+    {
+        return "Extended Kalman filter prediction policy for state "
+               "transition model with additive noise";
+    }
+
+protected:
+    /** \cond internal */
+    typedef typename SecondMomentOf<State>::Type StateCovariance;
+    typedef Eigen::Matrix<
+                Real, SizeOf<State>::Value, SizeOf<State>::Value
+            > StateJacobian;
+
+    DualState dual_state_;
+    DualState dual_predicted_state_;
+    State mean_;
+    StateJacobian jacobian_;
+    StateCovariance cov_;
+    StateCovariance transition_cov_;
+    /** \endcond */
+};
+
+/**
+ * \ingroup nonlinear_gaussian_filter
+ *
+ * \brief Extended Kalman filter prediction of state transition models with
+ * non-additive standard normal noise \f$x_{t+1} = f(x_t, v_t, u_t)\f$.
+ *
+ * The model is linearized at the prior mean and the noise mean \f$v = 0\f$
+ * by a single evaluation of \c state() on Dual scalars, see
+ * AutoDiffLinearization. The state and the noise are differentiated jointly
+ * which yields both Jacobians \f$F = \partial f / \partial x\f$ and
+ * \f$G = \partial f / \partial v\f$ at once. The prediction is
+ *
+ * \f$ \mu_{t+1} = f(\mu_t, 0, u_t), \quad
+ *     \Sigma_{t+1} = F\Sigma_tF^T + GG^T \f$
+ */
+template <
+    typename Linearization,
+    typename StateTransitionFunction
+>
+class ExtendedPredictPolicy<
+          Linearization,
+          NonAdditive<StateTransitionFunction>>
+    : public Descriptor,
+      private internal::MomentPredictionPolicyType
+{
+public:
+    typedef typename StateTransitionFunction::State State;
+    typedef typename StateTransitionFunction::Input Input;
+    typedef typename StateTransitionFunction::Noise Noise;
+
+    enum : signed int
+    {
+        Directions = JoinSizes<
+                         SizeOf<State>::Value,
+                         SizeOf<Noise>::Value
+                     >::Size
+    };
+
+    typedef Dual<Real, Directions> DualScalar;
+    typedef Eigen::Matrix<DualScalar, SizeOf<State>::Value, 1> DualState;
+    typedef Eigen::Matrix<DualScalar, SizeOf<Noise>::Value, 1> DualNoise;
+
+    template <
+        typename Belief
+    >
+    void operator()(const StateTransitionFunction& state_transition_function,
+                    const Linearization& linearization,
+                    const Belief& prior_belief,
+                    const Input& u,
+                    Belief& predicted_belief)
+    {
+        const int dim = prior_belief.dimension();
+        const int noise_dim = state_transition_function.noise_dimension();
+
+        noise_mean_.setZero(noise_dim);
+
+        dual_variables(prior_belief.mean(), 0, dim + noise_dim, dual_state_);
+        dual_variables(noise_mean_, dim, dim + noise_dim, dual_noise_);
+        dual_predicted_state_ =
+            state_transition_function.state(dual_state_, dual_noise_, u);
+
+        dual_value(dual_predicted_state_, mean_);
+        dual_jacobian(dual_predicted_state_, 0, dim, jacobian_);
+        dual_jacobian(dual_predicted_state_, dim, noise_dim, noise_jacobian_);
+
+        transition_cov_.noalias() = jacobian_ * prior_belief.covariance();
+        cov_.noalias() = transition_cov_ * jacobian_.transpose();
+        cov_.noalias() += noise_jacobian_ * noise_jacobian_.transpose();
+
+        // changing the dimension resets the belief which creates temporaries
+        if (predicted_belief.dimension() != dim)
+        {
+            predicted_belief.dimension(dim);
+        }
+
+        predicted_belief.mean(mean_);
+        predicted_belief.covariance(cov_);
+    }
+
+    virtual std::string name() const
+    {
+        return "ExtendedPredictPolicy<"
+                + this->list_arguments(
+                       "Linearization",
+                       "NonAdditive<StateTransitionFunction>")
+                + ">";
+    }
+
+    virtual std::string description() const
+    {
+        return "Extended Kalman filter prediction policy for state "
+               "transition model with non-additive noise";
+    }
+
+protected:
+    /** \cond internal */
+    typedef typename SecondMomentOf<State>::Type StateCovariance;
+    typedef Eigen::Matrix<
+                Real, SizeOf<State>::Value, SizeOf<State>::Value
+            > StateJacobian;
+    typedef Eigen::Matrix<
+                Real, SizeOf<State>::Value, SizeOf<Noise>::Value
+            > NoiseJacobian;
+
+    DualState dual_state_;
+    DualNoise dual_noise_;
+    DualState dual_predicted_state_;
+    Noise noise_mean_;
+    State mean_;
+    StateJacobian jacobian_;
+    NoiseJacobian noise_jacobian_;
+    StateCovariance cov_;
+    StateCovariance transition_cov_;
+    /** \endcond */
+};
+
+/**
+ * \ingroup nonlinear_gaussian_filter
+ *
+ * \brief Linear state transition models marked as Linear<Model> are
+ * predicted in closed form as in the sigma point filters
+ */
+template <
+    typename Linearization,
+    typename LinearStateTransitionFunction
+>
+class ExtendedPredictPolicy<
+          Linearization,
+          Linear<LinearStateTransitionFunction>>
+    : public SigmaPointPredictPolicy<
+                Linearization,
+                Linear<LinearStateTransitionFunction>>
+{ };
+
+/**
+ * \ingroup nonlinear_gaussian_filter
+ *
+ * \brief Conditionally linear state transition models are linearized as any
+ * other model with additive noise
+ */
+template <
+    typename Linearization,
+    typename ConditionallyLinearStateTransitionFunction
+>
+class ExtendedPredictPolicy<
+          Linearization,
+          ConditionallyLinear<ConditionallyLinearStateTransitionFunction>>
+    : public ExtendedPredictPolicy<
+                Linearization,
+                Additive<ConditionallyLinearStateTransitionFunction>>
+{ };
+
+}
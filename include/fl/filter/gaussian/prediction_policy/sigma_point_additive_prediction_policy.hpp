@@ -26,6 +26,7 @@
 #include <fl/util/traits.hpp>
 #include <fl/util/descriptor.hpp>
 #include <fl/filter/gaussian/transform/point_set.hpp>
+#include <fl/filter/gaussian/transform/point_set_moments.hpp>
 #include <fl/filter/gaussian/quadrature/sigma_point_quadrature.hpp>
 
 namespace fl
@@ -54,6 +55,7 @@ public:
     };
 
     typedef PointSet<State, NumberOfPoints> StatePointSet;
+    typedef PointSet<State, Eigen::Dynamic> PredictedPointSet;
 
     template <
         typename Belief
@@ -72,28 +74,6 @@ public:
 
         quadrature.propergate_gaussian(f, prior_belief, Y, Z);
 
-        /*
-         * Obtain the centered points matrix of the prediction. The columns of
-         * this matrix are the predicted points with zero mean. That is, the
-         * sum of the columns in P is zero.
-         *
-         * P = [X_r[1]-mu_r  X_r[2]-mu_r  ... X_r[n]-mu_r]
-         *
-         * with weighted mean
-         *
-         * mu_r = Sum w_mean[i] X_r[i]
-         */
-        auto X_c = Z.centered_points();
-
-        /*
-         * Obtain the weights of point as a vector
-         *
-         * W = [w_cov[1]  w_cov[2]  ... w_cov[n]]
-         *
-         * Note that the covariance weights are used.
-         */
-        auto W = Z.covariance_weights_vector();
-
         /*
          * Compute and set the moments
          *
@@ -103,13 +83,71 @@ public:
          * C = Sum W[i,i] * (X_r[i]-mu_r)(X_r[i]-mu_r)^T
          *   = P * W * P^T
          *
-         * given that W is the diagonal matrix
+         * given the centered points matrix P and the diagonal matrix W of
+         * the covariance weights. Both moments are computed in place by
+         * PointSetMoments.
          */
-        predicted_belief.dimension(prior_belief.dimension());
-        predicted_belief.mean(Z.mean());
-        predicted_belief.covariance(
-            X_c * W.asDiagonal() * X_c.transpose()
-            + additive_state_transition_function.noise_covariance());
+        moments_.compute(Z);
+
+        mean_ = moments_.mean_x();
+        cov_ = moments_.cov_xx();
+        cov_ += additive_state_transition_function.noise_covariance();
+
+        // changing the dimension resets the belief which creates temporaries
+        if (predicted_belief.dimension() != prior_belief.dimension())
+        {
+            predicted_belief.dimension(prior_belief.dimension());
+        }
+
+        predicted_belief.mean(mean_);
+        predicted_belief.covariance(cov_);
+    }
+
+    /**
+     * \return Points representing the predicted belief of the last
+     *         prediction which may be passed on to the update instead of
+     *         regenerating points from the predicted belief.
+     *
+     * The propagated points lack the additive noise. They are therefore
+     * extended by the pairs \f$\mu \pm n_j\f$ of the columns \f$n_j\f$ of
+     * the noise matrix \f$N\f$ with \f$Q = NN^T\f$. With a mean weight of
+     * \f$0\f$ and a covariance weight of \f$1/2\f$ the moments of the
+     * extended points equal the predicted belief without factorizing its
+     * covariance.
+     */
+    const PredictedPointSet& predicted_points(
+        const AdditiveStateTransitionFunction&
+            additive_state_transition_function)
+    {
+        auto&& noise_matrix =
+            additive_state_transition_function.noise_matrix();
+
+        const int point_count = Z.count_points();
+        const int noise_dim = noise_matrix.cols();
+
+        predicted_points_.resize(
+            Z.dimension(), point_count + 2 * noise_dim);
+
+        auto&& mean = moments_.mean_x();
+
+        for (int i = 0; i < point_count; ++i)
+        {
+            predicted_points_.point(i,
+                                    Z.points().col(i),
+                                    Z.weights(i).w_mean,
+                                    Z.weights(i).w_cov);
+        }
+
+        for (int j = 0; j < noise_dim; ++j)
+        {
+            const int i = point_count + 2 * j;
+            predicted_points_.point(
+                i, mean + noise_matrix.col(j), Real(0), Real(0.5));
+            predicted_points_.point(
+                i + 1, mean - noise_matrix.col(j), Real(0), Real(0.5));
+        }
+
+        return predicted_points_;
     }
 
     virtual std::string name() const
@@ -130,6 +168,10 @@ public:
 protected:
     StatePointSet Y;
     StatePointSet Z;
+    PredictedPointSet predicted_points_;
+    PointSetMoments moments_;
+    State mean_;
+    typename SecondMomentOf<State>::Type cov_;
 };
 
 }
@@ -0,0 +1,158 @@
+/*
+ * This is part of the fl library, a C++ Bayesian filtering library
+ * (https://github.com/filtering-library)
+ *
+ * Copyright (c) 2015 Max Planck Society,
+ * 				 Autonomous Motion Department,
+ * 			     Institute for Intelligent Systems
+ *
+ * This Source Code Form is subject to the terms of the MIT License (MIT).
+ * A copy of the license can be found in the LICENSE file distributed with this
+ * source code.
+ */
+
+/**
+ * \file sigma_point_conditionally_linear_prediction_policy.hpp
+ * \date October 2026
+ * \author agent (agent@local)
+ */
+
+#pragma once
+
+
+#include <Eigen/Dense>
+
+#include <fl/util/meta.hpp>
+#include <fl/util/traits.hpp>
+#include <fl/util/descriptor.hpp>
+#include <fl/filter/gaussian/transform/point_set.hpp>
+#include <fl/filter/gaussian/transform/point_set_moments.hpp>
+#include <fl/filter/gaussian/transform/rao_blackwellized_point_set.hpp>
+#include <fl/filter/gaussian/quadrature/sigma_point_quadrature.hpp>
+
+namespace fl
+{
+
+// Forward declarations
+template <typename...> class SigmaPointPredictPolicy;
+
+/**
+ * \ingroup nonlinear_gaussian_filter
+ *
+ * \brief Rao-Blackwellized sigma point prediction of state transition models
+ * which are linear in a substate, see
+ * ConditionallyLinearStateTransitionFunction.
+ *
+ * The quadrature is applied to the nonlinear substate \f$x_n\f$ only, see
+ * RaoBlackwellizedPointSet. Given the points \f$X_i\f$ and
+ * \f$B_i = B(X_i, u)\f$ the predicted moments are
+ *
+ * \f$ \mu_{t+1} = \sum_i w_i f(X_i, u), \quad
+ *     \Sigma_{t+1} = \sum_i w_i (f(X_i, u) - \mu_{t+1})(\cdot)^T
+ *                  + \sum_i w_i B_i\Sigma_{l|n}B_i^T + Q \f$
+ *
+ * where the second sum integrates the linear substate in closed form. The
+ * number of points and model evaluations scales with \f$\dim(x_n)\f$
+ * instead of the full state dimension. The policy is selected for all
+ * models derived from ConditionallyLinearStateTransitionFunction, see
+ * IsConditionallyLinear. Models explicitly marked as Additive are propagated
+ * by means of the full state quadrature.
+ */
+template <
+    typename SigmaPointQuadrature,
+    typename ConditionallyLinearStateTransitionFunction
+>
+class SigmaPointPredictPolicy<
+          SigmaPointQuadrature,
+          ConditionallyLinear<ConditionallyLinearStateTransitionFunction>>
+    : public Descriptor,
+      private internal::MomentPredictionPolicyType
+{
+public:
+    typedef typename ConditionallyLinearStateTransitionFunction::State State;
+    typedef typename ConditionallyLinearStateTransitionFunction::Input Input;
+
+    template <
+        typename Belief
+    >
+    void operator()(const ConditionallyLinearStateTransitionFunction&
+                              state_transition_function,
+                    const SigmaPointQuadrature& quadrature,
+                    const Belief& prior_belief,
+                    const Input& u,
+                    Belief& predicted_belief)
+    {
+        auto f = [&](const State& x)
+        {
+            return state_transition_function.expected_state(x, u);
+        };
+
+        X.compute(quadrature,
+                  prior_belief,
+                  state_transition_function.nonlinear_dimension());
+
+        quadrature.propagate_points(f, X.points(), Z);
+
+        moments_.compute(Z);
+
+        mean_ = moments_.mean_x();
+        cov_ = moments_.cov_xx();
+
+        // expected covariance of the linear substate given the points
+        auto&& points = X.points();
+        auto&& conditional_cov = X.conditional_covariance();
+        for (int i = 0; i < points.count_points(); ++i)
+        {
+            state_ = points.points().col(i);
+            linear_matrix_ =
+                state_transition_function.linear_matrix(state_, u);
+            linear_cov_.noalias() = linear_matrix_ * conditional_cov;
+            cov_.noalias() += Real(points.weights(i).w_mean) *
+                              linear_cov_ * linear_matrix_.transpose();
+        }
+
+        cov_ += state_transition_function.noise_covariance();
+
+        // changing the dimension resets the belief which creates temporaries
+        if (predicted_belief.dimension() != prior_belief.dimension())
+        {
+            predicted_belief.dimension(prior_belief.dimension());
+        }
+
+        predicted_belief.mean(mean_);
+        predicted_belief.covariance(cov_);
+    }
+
+    virtual std::string name() const
+    {
+        return "SigmaPointPredictPolicy<"
+                + this->list_arguments(
+                       "SigmaPointQuadrature",
+                       "ConditionallyLinear<"
+                       "ConditionallyLinearStateTransitionFunction>")
+                + ">";
+    }
+
+    virtual std::string description() const
+    {
+        return "Rao-Blackwellized sigma point prediction policy for "
+               "conditionally linear state transition models";
+    }
+
+protected:
+    /** \cond internal */
+    typedef typename ConditionallyLinearStateTransitionFunction
+                ::LinearMatrix LinearMatrix;
+
+    RaoBlackwellizedPointSet<State> X;
+    PointSet<State, Eigen::Dynamic> Z;
+    PointSetMoments moments_;
+    State state_;
+    State mean_;
+    LinearMatrix linear_matrix_;
+    LinearMatrix linear_cov_;
+    typename SecondMomentOf<State>::Type cov_;
+    /** \endcond */
+};
+
+}
@@ -0,0 +1,124 @@
+/*
+ * This is part of the fl library, a C++ Bayesian filtering library
+ * (https://github.com/filtering-library)
+ *
+ * Copyright (c) 2015 Max Planck Society,
+ * 				 Autonomous Motion Department,
+ * 			     Institute for Intelligent Systems
+ *
+ * This Source Code Form is subject to the terms of the MIT License (MIT).
+ * A copy of the license can be found in the LICENSE file distributed with this
+ * source code.
+ */
+
+/**
+ * \file sigma_point_linear_prediction_policy.hpp
+ * \date October 2026
+ * \author agent (agent@local)
+ */
+
+#pragma once
+
+
+#include <Eigen/Dense>
+
+#include <fl/util/meta.hpp>
+#include <fl/util/traits.hpp>
+#include <fl/util/descriptor.hpp>
+#include <fl/filter/gaussian/quadrature/sigma_point_quadrature.hpp>
+
+namespace fl
+{
+
+// Forward declarations
+template <typename...> class SigmaPointPredictPolicy;
+
+/**
+ * \ingroup nonlinear_gaussian_filter
+ *
+ * \brief Prediction policy of linear state transition models within a sigma
+ * point GaussianFilter.
+ *
+ * Propagating sigma points through the linear map
+ * \f$x_{t+1} = Ax_t + Bu_t + v_t\f$ reproduces the Kalman filter prediction
+ *
+ * \f$ \mu_{t+1} = A\mu_t + Bu_t, \quad \Sigma_{t+1} = A\Sigma_tA^T + Q \f$
+ *
+ * which is therefore evaluated in closed form instead. Neither the square root
+ * of the prior covariance nor any model evaluation is required. The policy is
+ * selected for linear models marked as Linear<Model>, see IsLinear and
+ * LinearityOf. Unmarked linear models are propagated by means of the
+ * quadrature.
+ */
+template <
+    typename SigmaPointQuadrature,
+    typename LinearStateTransitionFunction
+>
+class SigmaPointPredictPolicy<
+          SigmaPointQuadrature,
+          Linear<LinearStateTransitionFunction>>
+    : public Descriptor,
+      private internal::MomentPredictionPolicyType
+{
+public:
+    typedef typename LinearStateTransitionFunction::State State;
+    typedef typename LinearStateTransitionFunction::Input Input;
+
+    template <
+        typename Belief
+    >
+    void operator()(const LinearStateTransitionFunction&
+                              linear_state_transition_function,
+                    const SigmaPointQuadrature& quadrature,
+                    const Belief& prior_belief,
+                    const Input& u,
+                    Belief& predicted_belief)
+    {
+        auto&& A = linear_state_transition_function.dynamics_matrix();
+        auto&& B = linear_state_transition_function.input_matrix();
+        auto&& Q = linear_state_transition_function.noise_covariance();
+
+        // prior_belief and predicted_belief may be the same object
+        mean_.noalias() = A * prior_belief.mean();
+        mean_.noalias() += B * u;
+
+        transition_cov_.noalias() = A * prior_belief.covariance();
+        cov_.noalias() = transition_cov_ * A.transpose();
+        cov_ += Q;
+
+        // changing the dimension resets the belief which creates temporaries
+        if (predicted_belief.dimension() != prior_belief.dimension())
+        {
+            predicted_belief.dimension(prior_belief.dimension());
+        }
+
+        predicted_belief.mean(mean_);
+        predicted_belief.covariance(cov_);
+    }
+
+    virtual std::string name() const
+    {
+        return "SigmaPointPredictPolicy<"
+                + this->list_arguments(
+                       "SigmaPointQuadrature",
+                       "Linear<LinearStateTransitionFunction>")
+                + ">";
+    }
+
+    virtual std::string description() const
+    {
+        return "Closed form prediction policy for linear state transition "
+               "models within a sigma point based filter";
+    }
+
+protected:
+    /** \cond internal */
+    typedef typename SecondMomentOf<State>::Type StateCovariance;
+
+    State mean_;
+    StateCovariance cov_;
+    StateCovariance transition_cov_;
+    /** \endcond */
+};
+
+}
@@ -27,7 +27,10 @@
 #include <fl/util/meta.hpp>
 #include <fl/util/traits.hpp>
 #include <fl/util/descriptor.hpp>
+#include <fl/model/process/joint_process_model_iid.hpp>
+#include <fl/model/process/interface/state_transition_function.hpp>
 #include <fl/filter/gaussian/transform/point_set.hpp>
+#include <fl/filter/gaussian/transform/point_set_moments.hpp>
 #include <fl/filter/gaussian/quadrature/sigma_point_quadrature.hpp>
 
 namespace fl
@@ -62,6 +65,12 @@ public:
     typedef typename StateTransitionFunction::Input Input;
     typedef typename StateTransitionFunction::Noise Noise;
 
+    /**
+     * \brief Point matrices holding one variate per column
+     */
+    typedef Eigen::Matrix<Real, SizeOf<State>::Value, Eigen::Dynamic> States;
+    typedef Eigen::Matrix<Real, SizeOf<Noise>::Value, Eigen::Dynamic> Noises;
+
     enum : signed int
     {
         NumberOfPoints = SigmaPointQuadrature::number_of_points(
@@ -87,34 +96,15 @@ public:
 
         noise_distr_.dimension(state_transition_funtion.noise_dimension());
 
-        auto f = [&](const State& x, const Noise& v)
+        // all points are passed to the model at once
+        auto f = [&](const Eigen::Ref<const States>& x,
+                     const Eigen::Ref<const Noises>& v)
         {
-            return state_transition_funtion.state(x, v, u);
+            return batch_states(state_transition_funtion, x, v, u);
         };
 
-        quadrature.propergate_gaussian(f, prior_belief, noise_distr_, X, Y, Z);
-
-        /*
-         * Obtain the centered points matrix of the prediction. The columns of
-         * this matrix are the predicted points with zero mean. That is, the
-         * sum of the columns in P is zero.
-         *
-         * P = [X_r[1]-mu_r  X_r[2]-mu_r  ... X_r[n]-mu_r]
-         *
-         * with weighted mean
-         *
-         * mu_r = Sum w_mean[i] X_r[i]
-         */
-        auto X_c = Z.centered_points();
-
-        /*
-         * Obtain the weights of point as a vector
-         *
-         * W = [w_cov[1]  w_cov[2]  ... w_cov[n]]
-         *
-         * Note that the covariance weights are used.
-         */
-        auto W = Z.covariance_weights_vector();
+        quadrature.transform_to_points(prior_belief, noise_distr_, X, Y);
+        quadrature.propagate_point_matrices(f, X, Y, Z);
 
         /*
          * Compute and set the moments
@@ -125,13 +115,27 @@ public:
          * C = Sum W[i,i] * (X_r[i]-mu_r)(X_r[i]-mu_r)^T
          *   = P * W * P^T
          *
-         * given that W is the diagonal matrix
+         * given the centered points matrix P and the diagonal matrix W of
+         * the covariance weights. Both moments are computed in place by
+         * PointSetMoments.
          */
+        moments_.compute(Z);
+
         predicted_belief.dimension(prior_belief.dimension());
-        predicted_belief.mean(Z.mean());
-        predicted_belief.covariance(X_c * W.asDiagonal() * X_c.transpose());
+        predicted_belief.mean(moments_.mean_x());
+        predicted_belief.covariance(moments_.cov_xx());
     }
 
+    /**
+     * \return Points representing the predicted belief of the last
+     *         prediction which may be passed on to the update instead of
+     *         regenerating points from the predicted belief. The noise is
+     *         part of the propagated points, hence, they are used as they are.
+     */
+    const StatePointSet& predicted_points(const StateTransitionFunction&) const
+    {
+        return Z;
+    }
 
     virtual std::string name() const
     {
@@ -153,6 +157,179 @@ protected:
     StatePointSet Y;
     StatePointSet Z;
     Gaussian<Noise> noise_distr_;
+    PointSetMoments moments_;
+};
+
+
+/**
+ * \ingroup nonlinear_gaussian_filter
+ *
+ * \brief Structure-aware prediction policy of a
+ * JointProcessModel<MultipleOf<LocalProcessModel, Count>>.
+ *
+ * The \f$k\f$-th block of the joint prediction depends only on the
+ * \f$k\f$-th blocks of the state and the noise. A sigma point which
+ * coincides with the mean in these blocks yields the same local prediction as
+ * the mean. Therefore, the local models are evaluated on the mean once and
+ * each sigma point reevaluates only the local models of the blocks it
+ * perturbs.
+ *
+ * For the unscented transform each point perturbs a single column of the
+ * square root of the joint (state, noise) covariance. The noise is standard
+ * normal and, given a block-diagonal state covariance, so is every column
+ * within a single block. This reduces the number of local model evaluations
+ * from \f$ n(2n d + 1) \f$ to \f$ n + 2n d\f$ with \f$n\f$ local models of
+ * joint state and noise dimension \f$d\f$. Correlations between the state
+ * blocks and transforms without a point at the mean, e.g. the Monte Carlo
+ * transform, only reduce the savings. The predicted moments are identical to
+ * the ones of the generic policy in either case.
+ */
+template <
+    typename SigmaPointQuadrature,
+    typename LocalProcessModel,
+    int Count
+>
+class SigmaPointPredictPolicy<
+          SigmaPointQuadrature,
+          NonAdditive<JointProcessModel<MultipleOf<LocalProcessModel, Count>>>>
+    : public Descriptor
+{
+public:
+    typedef JointProcessModel<
+                MultipleOf<LocalProcessModel, Count>
+            > StateTransitionFunction;
+
+    typedef typename StateTransitionFunction::State State;
+    typedef typename StateTransitionFunction::Input Input;
+    typedef typename StateTransitionFunction::Noise Noise;
+
+    enum : signed int
+    {
+        NumberOfPoints = SigmaPointQuadrature::number_of_points(
+                             JoinSizes<
+                                 SizeOf<State>::Value,
+                                 SizeOf<Noise>::Value
+                             >::Size)
+    };
+
+    typedef PointSet<State, NumberOfPoints> StatePointSet;
+    typedef PointSet<Noise, NumberOfPoints> NoisePointSet;
+
+    template <
+        typename Belief
+    >
+    void operator()(const StateTransitionFunction& state_transition_funtion,
+                    const SigmaPointQuadrature& quadrature,
+                    const Belief& prior_belief,
+                    const Input& u,
+                    Belief& predicted_belief)
+    {
+        const auto& local_model = state_transition_funtion.local_process_model();
+
+        const int count = state_transition_funtion.count_local_models();
+        const int state_dim = local_model.state_dimension();
+        const int noise_dim = local_model.noise_dimension();
+        const int input_dim = local_model.input_dimension();
+
+        noise_distr_.dimension(state_transition_funtion.noise_dimension());
+
+        quadrature.transform_to_points(prior_belief, noise_distr_, X, Y);
+
+        const State& mean = prior_belief.mean();
+        const Noise& noise_mean = noise_distr_.mean();
+
+        /*
+         * Predict each block of the mean once. The result is shared by all
+         * points which leave the block unperturbed.
+         */
+        State mean_prediction(state_transition_funtion.state_dimension());
+        for (int k = 0; k < count; ++k)
+        {
+            mean_prediction.middleRows(k * state_dim, state_dim) =
+                local_model.state(
+                    mean.middleRows(k * state_dim, state_dim),
+                    noise_mean.middleRows(k * noise_dim, noise_dim),
+                    u.middleRows(k * input_dim, input_dim));
+        }
+
+        const int point_count = X.count_points();
+        Z.resize(mean_prediction.rows(), point_count);
+
+        auto& x = X.points();
+        auto& v = Y.points();
+        auto& z = Z.points();
+
+        for (int i = 0; i < point_count; ++i)
+        {
+            for (int k = 0; k < count; ++k)
+            {
+                const int s = k * state_dim;
+                const int n = k * noise_dim;
+
+                if (x.col(i).middleRows(s, state_dim) ==
+                        mean.middleRows(s, state_dim) &&
+                    v.col(i).middleRows(n, noise_dim) ==
+                        noise_mean.middleRows(n, noise_dim))
+                {
+                    z.col(i).middleRows(s, state_dim) =
+                        mean_prediction.middleRows(s, state_dim);
+                }
+                else
+                {
+                    z.col(i).middleRows(s, state_dim) =
+                        local_model.state(
+                            x.col(i).middleRows(s, state_dim),
+                            v.col(i).middleRows(n, noise_dim),
+                            u.middleRows(k * input_dim, input_dim));
+                }
+            }
+
+            Z.weight(i, X.weights(i));
+        }
+
+        /*
+         * Compute and set the moments as in the generic policy
+         */
+        moments_.compute(Z);
+
+        predicted_belief.dimension(prior_belief.dimension());
+        predicted_belief.mean(moments_.mean_x());
+        predicted_belief.covariance(moments_.cov_xx());
+    }
+
+    /**
+     * \return Points representing the predicted belief of the last
+     *         prediction. Unperturbed blocks share the prediction of the
+     *         mean but the points are complete.
+     */
+    const StatePointSet& predicted_points(const StateTransitionFunction&) const
+    {
+        return Z;
+    }
+
+    virtual std::string name() const
+    {
+        return "SigmaPointPredictPolicy<"
+                + this->list_arguments(
+                       "SigmaPointQuadrature",
+                       "NonAdditive<JointProcessModel<MultipleOf<"
+                       "LocalProcessModel, Count>>>")
+                + ">";
+    }
+
+    virtual std::string description() const
+    {
+        return "Sigma Point based filter prediction policy for joint state "
+               "transition models of independent local models which "
+               "reevaluates only the perturbed local models";
+    }
+
+protected:
+    StatePointSet X;
+    NoisePointSet Y;
+    StatePointSet Z;
+    Gaussian<Noise> noise_distr_;
+    PointSetMoments moments_;
 };
 
 }
@@ -19,6 +19,14 @@
 
 #pragma once
 
+#include <vector>
+#include <algorithm>
+#include <exception>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
 #include <fl/util/meta.hpp>
 #include <fl/util/traits.hpp>
 #include <fl/util/descriptor.hpp>
@@ -82,6 +90,22 @@ namespace fl
  *
  *
  * \endcode
+ *
+ * ## Parallel propagation ##
+ *
+ * The integrand is evaluated once for every point. For expensive integrands,
+ * e.g. an observation model rendering a depth image, the evaluations may be
+ * distributed over multiple threads by means of
+ *
+ * \code
+ * quadrature.parallel_propagation(true, min_points_per_chunk);
+ * \endcode
+ *
+ * The points are split into contiguous chunks of at least
+ * \a min_points_per_chunk points, at most one chunk per OpenMP thread, and
+ * each chunk is propagated by a single thread. The integrand must then be
+ * safe to be called concurrently. Without OpenMP (fl_USE_OPENMP) the points
+ * are propagated sequentially.
  */
 template <typename Transform>
 class SigmaPointQuadrature : Descriptor
@@ -92,7 +116,9 @@ class SigmaPointQuadrature : Descriptor
      */
     template <typename... Args>
     SigmaPointQuadrature(Args... args)
-        : transform_(args...)
+        : transform_(args...),
+          parallel_propagation_(false),
+          min_points_per_chunk_(1)
     {
     }
 
@@ -104,8 +130,53 @@ class SigmaPointQuadrature : Descriptor
      *              MonteCarloTransform
      */
     explicit SigmaPointQuadrature(const Transform& transform)
-        : transform_(transform)
+        : transform_(transform),
+          parallel_propagation_(false),
+          min_points_per_chunk_(1)
+    {
+    }
+
+    /**
+     * \brief Enables or disables the parallel evaluation of the integrand
+     *
+     * \param enabled
+     *              Propagates the points in parallel if OpenMP is available.
+     *              The integrand must be safe to be called concurrently.
+     * \param min_points_per_chunk
+     *              Minimum number of points propagated by a single thread.
+     *              Cheap integrands require large chunks to amortize the
+     *              threading overhead.
+     */
+    void parallel_propagation(bool enabled, int min_points_per_chunk = 1)
     {
+        parallel_propagation_ = enabled;
+        min_points_per_chunk_ = std::max(min_points_per_chunk, 1);
+    }
+
+    /**
+     * \brief Returns whether the integrand is evaluated in parallel
+     */
+    bool parallel_propagation() const
+    {
+        return parallel_propagation_;
+    }
+
+    /**
+     * \brief Returns the number of chunks \a point_count points are split
+     *        into. This is one if the propagation is sequential.
+     */
+    int count_chunks(int point_count) const
+    {
+#ifdef _OPENMP
+        if (parallel_propagation_)
+        {
+            return std::max(
+                1,
+                std::min(omp_get_max_threads(),
+                         point_count / min_points_per_chunk_));
+        }
+#endif
+        return 1;
     }
 
     /**
@@ -363,14 +434,7 @@ class SigmaPointQuadrature : Descriptor
 
         transform_(distr, X);
 
-        auto p0 = f(X[0]);
-        Z.resize(p0.size(), point_count);
-        Z.point(0, p0, X.weights(0).w_mean, X.weights(0).w_cov);
-
-        for (int i = 1; i < point_count; ++i)
-        {
-            Z.point(i, f(X[i]), X.weights(i).w_mean, X.weights(i).w_cov);
-        }
+        propagate_points(f, X, Z);
     }
 
     /**
@@ -514,25 +578,178 @@ class SigmaPointQuadrature : Descriptor
         transform_(marginal_gaussian_b, augmented_dim, dim_a, Y);
     }
 
+    /**
+     * \brief Propagates the given points \a X through \f$f\f$ into \a Z
+     *        which takes over the weights of \a X. In contrast to
+     *        propergate_gaussian() the points are not generated from a
+     *        Gaussian, e.g. in order to reuse points of a preceding
+     *        propagation.
+     */
+    template <typename Integrand, typename PointSetX, typename PointSetZ>
+    void propagate_points(Integrand&& f, const PointSetX& X, PointSetZ& Z) const
+    {
+        const int point_count = X.count_points();
+
+        auto&& points_x = X.points();
+
+        auto p0 = f(points_x.col(0));
+        Z.resize(p0.size(), point_count);
+        Z.point(0, p0, X.weights(0).w_mean, X.weights(0).w_cov);
+
+        for_each_chunk(
+            1, point_count,
+            [&](int chunk, int begin, int end)
+            {
+                for (int i = begin; i < end; ++i)
+                {
+                    Z.point(i,
+                            f(points_x.col(i)),
+                            X.weights(i).w_mean,
+                            X.weights(i).w_cov);
+                }
+            });
+    }
+
+    /**
+     * \brief Propagates the joint points of \a X and \a Y through
+     *        \f$f\f$ into \a Z which takes over the weights of \a X
+     */
     template <typename Integrand,
               typename PointSetX,
               typename PointSetY,
               typename PointSetZ>
     void propagate_points(Integrand&& f,
-                          PointSetX& X,
-                          PointSetY& Y,
+                          const PointSetX& X,
+                          const PointSetY& Y,
                           PointSetZ& Z) const
     {
         const int point_count = X.count_points();
 
-        auto p0 = f(X[0], Y[0]);
+        auto&& points_x = X.points();
+        auto&& points_y = Y.points();
+
+        auto p0 = f(points_x.col(0), points_y.col(0));
         Z.resize(p0.size(), point_count);
         Z.point(0, p0, X.weights(0).w_mean, X.weights(0).w_cov);
 
-        for (int i = 1; i < point_count; ++i)
+        for_each_chunk(
+            1, point_count,
+            [&](int chunk, int begin, int end)
+            {
+                for (int i = begin; i < end; ++i)
+                {
+                    auto y = f(points_x.col(i), points_y.col(i));
+                    Z.point(i, y, X.weights(i).w_mean, X.weights(i).w_cov);
+                }
+            });
+    }
+
+    /**
+     * \brief Propagates the joint points of \a X and \a Y through
+     *        \f$f(i, x_i, y_i)\f$ into \a Z which takes over the weights of
+     *        \a X. Unlike propagate_points(), the integrand receives the
+     *        point index \f$i\f$, e.g. to select a precomputation of the
+     *        point.
+     */
+    template <typename Integrand,
+              typename PointSetX,
+              typename PointSetY,
+              typename PointSetZ>
+    void propagate_indexed_points(Integrand&& f,
+                                  const PointSetX& X,
+                                  const PointSetY& Y,
+                                  PointSetZ& Z) const
+    {
+        const int point_count = X.count_points();
+
+        auto&& points_x = X.points();
+        auto&& points_y = Y.points();
+
+        auto p0 = f(0, points_x.col(0), points_y.col(0));
+        Z.resize(p0.size(), point_count);
+        Z.point(0, p0, X.weights(0).w_mean, X.weights(0).w_cov);
+
+        for_each_chunk(
+            1, point_count,
+            [&](int chunk, int begin, int end)
+            {
+                for (int i = begin; i < end; ++i)
+                {
+                    auto y = f(i, points_x.col(i), points_y.col(i));
+                    Z.point(i, y, X.weights(i).w_mean, X.weights(i).w_cov);
+                }
+            });
+    }
+
+    /**
+     * \brief Batch version of propagate_points(). The integrand maps the
+     *        point matrices of \a X and \a Y onto the point matrix of \a Z
+     *        at once, e.g.
+     *
+     * \code
+     * auto h = [&](const Eigen::Ref<const States>& x,
+     *              const Eigen::Ref<const Noises>& w)
+     * {
+     *     return batch_observations(obsrv_function, x, w);
+     * };
+     * \endcode
+     *
+     * This replaces one call of the integrand per point by a single call
+     * for all points which models may implement by means of matrix
+     * products. If the propagation is parallel, the integrand is called
+     * once per chunk with the corresponding columns of the point matrices.
+     */
+    template <typename BatchIntegrand,
+              typename PointSetX,
+              typename PointSetY,
+              typename PointSetZ>
+    void propagate_point_matrices(BatchIntegrand&& f,
+                                  PointSetX& X,
+                                  PointSetY& Y,
+                                  PointSetZ& Z) const
+    {
+        const int point_count = X.count_points();
+        const int chunks = count_chunks(point_count);
+
+        if (chunks == 1)
         {
-            auto y = f(X[i], Y[i]);
-            Z.point(i, y, X.weights(i).w_mean, X.weights(i).w_cov);
+            auto&& points = f(X.points(), Y.points());
+            assert(points.cols() == point_count);
+
+            Z.resize(points.rows(), point_count);
+            Z.points(points);
+        }
+        else
+        {
+            // the chunk buffers are kept between calls
+            if (int(chunk_points_.size()) < chunks)
+            {
+                chunk_points_.resize(chunks);
+            }
+
+            for_each_chunk(
+                0, point_count,
+                [&](int chunk, int begin, int end)
+                {
+                    chunk_points_[chunk] =
+                        f(X.points().middleCols(begin, end - begin),
+                          Y.points().middleCols(begin, end - begin));
+                });
+
+            Z.resize(chunk_points_[0].rows(), point_count);
+            for (int c = 0, begin = 0; c < chunks; ++c)
+            {
+                assert(chunk_points_[c].rows() == chunk_points_[0].rows());
+
+                Z.points().middleCols(begin, chunk_points_[c].cols()) =
+                    chunk_points_[c];
+                begin += chunk_points_[c].cols();
+            }
+        }
+
+        for (int i = 0; i < point_count; ++i)
+        {
+            Z.weight(i, X.weights(i).w_mean, X.weights(i).w_cov);
         }
     }
 
@@ -691,6 +908,64 @@ class SigmaPointQuadrature : Descriptor
     /** @} */
 
    protected:
+    /** \cond internal */
+
+    /**
+     * \brief Invokes \a f(chunk, begin, end) for each chunk of the point index range
+     *        [\a first, \a last). The chunks are processed in parallel if the
+     *        parallel propagation is enabled. The first exception thrown is
+     *        rethrown after all chunks finished.
+     */
+    template <typename F>
+    void for_each_chunk(int first, int last, F&& f) const
+    {
+        const int count = last - first;
+        const int chunks = count_chunks(count);
+
+        if (chunks <= 1)
+        {
+            if (count > 0) f(0, first, last);
+            return;
+        }
+
+        std::exception_ptr error;
+
+#ifdef _OPENMP
+        #pragma omp parallel for schedule(static) num_threads(chunks)
+#endif
+        for (int c = 0; c < chunks; ++c)
+        {
+            try
+            {
+                f(c,
+                  first + (c * count) / chunks,
+                  first + ((c + 1) * count) / chunks);
+            }
+            catch (...)
+            {
+#ifdef _OPENMP
+                #pragma omp critical
+#endif
+                if (!error) error = std::current_exception();
+            }
+        }
+
+        if (error) std::rethrow_exception(error);
+    }
+
+    /** \endcond */
+
     Transform transform_;
+    bool parallel_propagation_;
+    int min_points_per_chunk_;
+
+    /**
+     * \brief Per-chunk results of the parallel propagate_point_matrices().
+     *        Reused by subsequent calls, hence, a quadrature must not
+     *        propagate concurrently from multiple threads.
+     */
+    mutable std::vector<
+        Eigen::Matrix<Real, Eigen::Dynamic, Eigen::Dynamic>
+    > chunk_points_;
 };
 }
@@ -0,0 +1,216 @@
+/*
+ * This is part of the fl library, a C++ Bayesian filtering library
+ * (https://github.com/filtering-library)
+ *
+ * Copyright (c) 2015 Max Planck Society,
+ * 				 Autonomous Motion Department,
+ * 			     Institute for Intelligent Systems
+ *
+ * This Source Code Form is subject to the terms of the MIT License (MIT).
+ * A copy of the license can be found in the LICENSE file distributed with this
+ * source code.
+ */
+
+/**
+ * \file cubature_transform.hpp
+ * \date October 2026
+ * \author agent (agent@local)
+ */
+
+#pragma once
+
+
+#include <cmath>
+
+#include <fl/util/traits.hpp>
+#include <fl/util/descriptor.hpp>
+#include <fl/distribution/gaussian.hpp>
+#include <fl/filter/gaussian/transform/point_set_transform.hpp>
+
+namespace fl
+{
+
+/**
+ * \ingroup point_set_transform
+ *
+ * Third-degree spherical-radial cubature transform used in the Cubature
+ * Kalman Filter \cite arasaratnam2009cubature . It implements the
+ * PointSetTransform interface.
+ *
+ * The \f$2n\f$ points of an \f$n\f$-dimensional Gaussian are
+ *
+ * \f$ x_{i} = \mu + \sqrt{n}\, L e_i, \quad
+ *     x_{n + i} = \mu - \sqrt{n}\, L e_i \f$
+ *
+ * with \f$\Sigma = LL^T\f$ and equal weights \f$1/(2n)\f$. In contrast to the
+ * UnscentedTransform there is no center point and all weights are positive,
+ * hence, the propagated covariance is always positive semi-definite. The rule
+ * integrates all polynomials up to degree three exactly.
+ */
+class CubatureTransform
+    : public PointSetTransform<CubatureTransform>,
+      public Descriptor
+{
+public:
+    /**
+     * Creates a CubatureTransform
+     */
+    CubatureTransform()
+        : PointSetTransform<CubatureTransform>(this)
+    { }
+
+    /**
+     * \copydoc PointSetTransform::forward(const Gaussian&,
+     *                                     PointSet&) const
+     *
+     * \throws WrongSizeException
+     * \throws ResizingFixedSizeEntityException
+     */
+    template <typename Gaussian_, typename PointSet_>
+    void forward(const Gaussian_& gaussian,
+                 PointSet_& point_set) const
+    {
+        forward(gaussian, gaussian.dimension(), 0, point_set);
+    }
+
+    /**
+     * \copydoc PointSetTransform::forward(const Gaussian&,
+     *                                     PointSet&) const
+     *
+     * \throws WrongSizeException
+     * \throws ResizingFixedSizeEntityException
+     */
+    template <typename Gaussian_, typename PointSet_>
+    void operator()(const Gaussian_& gaussian,
+                    PointSet_& point_set) const
+    {
+        forward(gaussian, gaussian.dimension(), 0, point_set);
+    }
+
+    /**
+     * \copydoc PointSetTransform::forward(const Gaussian&,
+     *                                     int global_dimension,
+     *                                     int dimension_offset,
+     *                                     PointSet&) const
+     *
+     * \throws WrongSizeException
+     * \throws ResizingFixedSizeEntityException
+     */
+    template <typename Gaussian_, typename PointSet_>
+    void forward(const Gaussian_& gaussian,
+                 int global_dimension,
+                 int dimension_offset,
+                 PointSet_& point_set) const
+    {
+        typedef typename Traits<PointSet_>::Point  Point;
+        typedef typename Traits<PointSet_>::Weight Weight;
+
+        const Real dim = Real(global_dimension);
+        const int point_count = number_of_points(global_dimension);
+
+        assert(point_count > 0);
+
+        /**
+         * \internal
+         *
+         * \remark
+         * A PointSet with a fixed number of points must have the
+         * correct number of points which is required by this transform
+         */
+        if (IsFixed<Traits<PointSet_>::NumberOfPoints>() &&
+            Traits<PointSet_>::NumberOfPoints != point_count)
+        {
+            fl_throw(
+                WrongSizeException("Incompatible number of points of the"
+                                   " specified fixed-size PointSet"));
+        }
+
+        // will resize of transform size is different from point count.
+        point_set.resize(point_count);
+
+        auto&& covariance_sqrt = gaussian.square_root() * std::sqrt(dim);
+
+        const Point& mean = gaussian.mean();
+
+        const Weight weight{weight_i(dim), weight_i(dim)};
+
+        // the points along the dimensions of the joint Gaussian which do not
+        // belong to this marginal collapse onto the mean
+        const int limit_1 = dimension_offset;
+        const int limit_2 = limit_1 + gaussian.dimension();
+        const int limit_3 = global_dimension;
+
+        for (int i = 0; i < limit_1; ++i)
+        {
+            point_set.point(i, mean, weight);
+            point_set.point(global_dimension + i, mean, weight);
+        }
+
+        for (int i = limit_1; i < limit_2; ++i)
+        {
+            auto&& point_shift = covariance_sqrt.col(i - dimension_offset);
+            point_set.point(i, mean + point_shift, weight);
+            point_set.point(global_dimension + i, mean - point_shift, weight);
+        }
+
+        for (int i = limit_2; i < limit_3; ++i)
+        {
+            point_set.point(i, mean, weight);
+            point_set.point(global_dimension + i, mean, weight);
+        }
+    }
+
+    /**
+     * \copydoc PointSetTransform::forward(const Gaussian&,
+     *                                     int global_dimension,
+     *                                     int dimension_offset,
+     *                                     PointSet&) const
+     *
+     * \throws WrongSizeException
+     * \throws ResizingFixedSizeEntityException
+     */
+    template <typename Gaussian_, typename PointSet_>
+    void operator()(const Gaussian_& gaussian,
+                    int global_dimension,
+                    int dimension_offset,
+                    PointSet_& point_set) const
+    {
+        forward(gaussian, global_dimension, dimension_offset, point_set);
+    }
+
+    /**
+     * \return Number of points generated by this transform
+     *
+     * \param dimension Dimension of the Gaussian
+     */
+    static constexpr int number_of_points(int dimension)
+    {
+        return (dimension != Eigen::Dynamic) ? 2 * dimension : Eigen::Dynamic;
+    }
+
+public:
+    /** \cond INTERNAL */
+
+    /**
+     * \return Mean and covariance weight of each point
+     *
+     * \param dim Dimension of the Gaussian
+     */
+    Real weight_i(Real dim) const
+    {
+        return Real(1) / (Real(2) * dim);
+    }
+    /** \endcond */
+
+    virtual std::string name() const
+    {
+        return "CubatureTransform";
+    }
+
+    virtual std::string description() const
+    {
+        return "Third-degree spherical-radial cubature transform";
+    }
+};
+
+}
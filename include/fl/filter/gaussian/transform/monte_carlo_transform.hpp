@@ -22,6 +22,8 @@
 
 #include <fl/util/traits.hpp>
 #include <fl/distribution/gaussian.hpp>
+#include <fl/distribution/sampling_policy.hpp>
+#include <fl/distribution/standard_gaussian.hpp>
 #include <fl/filter/gaussian/transform/point_set_transform.hpp>
 
 namespace fl
@@ -147,26 +149,43 @@ struct ConstantPointCountPolicy
  * \c ConstantPointCountPolicy, and \c LinearPointCountPolicy. The latter two
  * are a special case of the \c MonomialPointCountPolicy.
  *
+ * The points are drawn according to the SamplingPolicy. Besides independent
+ * sampling (\c IidSamplingPolicy) the variance reducing
+ * \c AntitheticSamplingPolicy and \c LatinHypercubeSamplingPolicy are
+ * available. These reach the same moment accuracy with fewer points, that is
+ * fewer model evaluations.
+ *
  * \tparam PointCountPolicy     The number of points policy. Default is a linear
  *                              policy LinearPointCountPolicy<>
+ * \tparam SamplingPolicy       The sampling policy. Default is independent
+ *                              sampling IidSamplingPolicy
  */
 template <
-    typename PointCountPolicy = LinearPointCountPolicy<>
+    typename PointCountPolicy = LinearPointCountPolicy<>,
+    typename SamplingPolicy = IidSamplingPolicy
 >
 class MonteCarloTransform
-        : public PointSetTransform<MonteCarloTransform<PointCountPolicy>>
+        : public PointSetTransform<
+                    MonteCarloTransform<PointCountPolicy, SamplingPolicy>>
 {
+private:
+    /** \cond internal */
+    typedef PointSetTransform<
+                MonteCarloTransform<PointCountPolicy, SamplingPolicy>
+            > Base;
+    /** \endcond */
+
 public:
     /**
      * Creates a MonteCarloTransform
      */
     MonteCarloTransform()
-        : PointSetTransform<MonteCarloTransform<PointCountPolicy>>(this)
+        : Base(this)
     { }
 
     template <typename ... Args>
     MonteCarloTransform(Args...args)
-        : PointSetTransform<MonteCarloTransform<PointCountPolicy>>(this)
+        : Base(this)
     { }
 
     /**
@@ -236,10 +255,12 @@ public:
 
         point_set.resize(gaussian.dimension(), point_count);
 
-        for (int i = 0; i < point_count; ++i)
-        {
-            point_set[i] = gaussian.sample();
-        }
+        auto& points = point_set.points();
+
+        SamplingPolicy::fill(standard_gaussian_, points);
+
+        points = (gaussian.square_root() * points).colwise()
+                    + gaussian.mean();
     }
 
     /**
@@ -261,6 +282,20 @@ public:
     {
         return name();
     }
+
+    /**
+     * \brief Restarts the sampling on the random stream \a stream_id of
+     * \a seed, see fl::Philox4x32
+     */
+    void seed(std::uint64_t seed, std::uint64_t stream_id)
+    {
+        standard_gaussian_.seed(seed, stream_id);
+    }
+
+protected:
+    /** \cond internal */
+    StandardGaussian<Eigen::Matrix<Real, Eigen::Dynamic, 1>> standard_gaussian_;
+    /** \endcond */
 };
 
 }
@@ -414,7 +414,8 @@ public:
      * \throws OutOfBoundsException
      * \throws ZeroDimensionException
      */
-    void point(int i, Point p)
+    template <typename Derived>
+    void point(int i, const Eigen::MatrixBase<Derived>& p)
     {
         INLINE_CHECK_POINT_SET_BOUNDS(i);
 
@@ -432,7 +433,8 @@ public:
      * \throws OutOfBoundsException
      * \throws ZeroDimensionException
      */
-    void point(int i, Point p, double w)
+    template <typename Derived>
+    void point(int i, const Eigen::MatrixBase<Derived>& p, double w)
     {
         point(i, p, Weight{w, w});
     }
@@ -448,7 +450,11 @@ public:
      * \throws OutOfBoundsException
      * \throws ZeroDimensionException
      */
-    void point(int i, Point p, double w_mean , double w_cov)
+    template <typename Derived>
+    void point(int i,
+               const Eigen::MatrixBase<Derived>& p,
+               double w_mean,
+               double w_cov)
     {
         point(i, p, Weight{w_mean, w_cov});
     }
@@ -457,13 +463,15 @@ public:
      * \brief Sets a given point at given position i along with its weights
      *
      * \param i         Index of point
-     * \param p         The new point
+     * \param p         The new point. Expressions are evaluated directly into
+     *                  the point matrix without creating a temporary point.
      * \param weights   point weights
      *
      * \throws OutOfBoundsException
      * \throws ZeroDimensionException
      */
-    void point(int i, Point p, Weight weights)
+    template <typename Derived>
+    void point(int i, const Eigen::MatrixBase<Derived>& p, Weight weights)
     {
         INLINE_CHECK_POINT_SET_BOUNDS(i);
 
@@ -0,0 +1,282 @@
+/*
+ * This is part of the fl library, a C++ Bayesian filtering library
+ * (https://github.com/filtering-library)
+ *
+ * Copyright (c) 2015 Max Planck Society,
+ * 				 Autonomous Motion Department,
+ * 			     Institute for Intelligent Systems
+ *
+ * This Source Code Form is subject to the terms of the MIT License (MIT).
+ * A copy of the license can be found in the LICENSE file distributed with this
+ * source code.
+ */
+
+/**
+ * \file point_set_moments.hpp
+ * \date October 2026
+ * \author agent (agent@local)
+ */
+
+#pragma once
+
+
+#include <cassert>
+
+#include <Eigen/Dense>
+
+#include <fl/util/types.hpp>
+
+namespace fl
+{
+
+/**
+ * \ingroup nonlinear_gaussian_filter
+ *
+ * \brief Computes the weighted mean and the weighted auto- and
+ * cross-covariances of one or two PointSets sharing the same weights, e.g.
+ * the sigma points \f$X\f$ of a state and their propagated observations
+ * \f$Y\f$.
+ *
+ * The points of both sets are treated as the joint points
+ * \f$[X; Y]\f$. compute() takes one pass over the points accumulating the
+ * weighted mean and a second pass writing the centered points \f$P\f$ along
+ * with the weighted centered points \f$PW\f$. The joint covariance
+ *
+ * \f$ \begin{pmatrix} \Sigma_{xx} & \Sigma_{xy} \\ \Sigma_{yx} & \Sigma_{yy}
+ *     \end{pmatrix} = P W P^T \f$
+ *
+ * is then obtained by a single matrix product of which only the lower
+ * triangle is evaluated. In contrast to
+ * PointSet::mean(), PointSet::centered_points() and
+ * PointSet::covariance_weights_vector() no temporaries are created. All
+ * buffers are kept between calls and reallocated only if the dimensions or
+ * the number of points change.
+ *
+ * The mean weights and the covariance weights are taken from the first set.
+ */
+class PointSetMoments
+{
+public:
+    typedef Eigen::Matrix<Real, Eigen::Dynamic, Eigen::Dynamic> Matrix;
+    typedef Eigen::Matrix<Real, Eigen::Dynamic, 1> Vector;
+
+    typedef Eigen::Block<const Matrix> MatrixBlock;
+    typedef Eigen::VectorBlock<const Vector> VectorBlock;
+
+public:
+    /**
+     * \brief Creates empty moments
+     */
+    PointSetMoments()
+        : dim_x_(0)
+    { }
+
+    /**
+     * \brief Computes the moments of the point set \a X
+     */
+    template <typename PointSetX>
+    void compute(const PointSetX& X)
+    {
+        const auto& points_x = X.points();
+        const auto& weights = X.weights();
+
+        const int dim_x = points_x.rows();
+        const int point_count = points_x.cols();
+
+        resize(dim_x, point_count);
+
+        mean_.setZero();
+        for (int i = 0; i < point_count; ++i)
+        {
+            mean_.noalias() += Real(weights(i).w_mean) * points_x.col(i);
+        }
+
+        for (int i = 0; i < point_count; ++i)
+        {
+            centered_.col(i).noalias() = points_x.col(i) - mean_;
+            weighted_.col(i).noalias() =
+                Real(weights(i).w_cov) * centered_.col(i);
+        }
+
+        dim_x_ = dim_x;
+        covariance();
+    }
+
+    /**
+     * \brief Computes the joint moments of the point sets \a X and \a Y
+     *        which must contain the same number of points
+     */
+    template <typename PointSetX, typename PointSetY>
+    void compute(const PointSetX& X, const PointSetY& Y)
+    {
+        center(X, Y);
+        covariance();
+    }
+
+    /**
+     * \brief Computes the means and the (weighted) centered points of \a X
+     *        and \a Y without the joint covariance. The covariance accessors
+     *        must not be used afterwards.
+     *
+     * This is sufficient for updates which never form the covariance of the
+     * observation points \a Y explicitly, e.g. for large observations.
+     */
+    template <typename PointSetX, typename PointSetY>
+    void center(const PointSetX& X, const PointSetY& Y)
+    {
+        const auto& points_x = X.points();
+        const auto& points_y = Y.points();
+        const auto& weights = X.weights();
+
+        const int dim_x = points_x.rows();
+        const int dim_y = points_y.rows();
+        const int point_count = points_x.cols();
+
+        assert(points_y.cols() == point_count);
+
+        resize(dim_x + dim_y, point_count);
+
+        auto mean_x = mean_.head(dim_x);
+        auto mean_y = mean_.tail(dim_y);
+
+        mean_.setZero();
+        for (int i = 0; i < point_count; ++i)
+        {
+            mean_x.noalias() += Real(weights(i).w_mean) * points_x.col(i);
+            mean_y.noalias() += Real(weights(i).w_mean) * points_y.col(i);
+        }
+
+        for (int i = 0; i < point_count; ++i)
+        {
+            centered_.col(i).head(dim_x).noalias() = points_x.col(i) - mean_x;
+            centered_.col(i).tail(dim_y).noalias() = points_y.col(i) - mean_y;
+            weighted_.col(i).noalias() =
+                Real(weights(i).w_cov) * centered_.col(i);
+        }
+
+        dim_x_ = dim_x;
+    }
+
+    /**
+     * \brief Weighted mean of \f$X\f$
+     */
+    VectorBlock mean_x() const
+    {
+        return VectorBlock(mean_, 0, dim_x_);
+    }
+
+    /**
+     * \brief Weighted mean of \f$Y\f$
+     */
+    VectorBlock mean_y() const
+    {
+        return VectorBlock(mean_, dim_x_, dim_y());
+    }
+
+    /**
+     * \brief Centered points of \f$X\f$, one point per column
+     */
+    MatrixBlock centered_x() const
+    {
+        return MatrixBlock(centered_, 0, 0, dim_x_, centered_.cols());
+    }
+
+    /**
+     * \brief Centered points of \f$Y\f$, one point per column
+     */
+    MatrixBlock centered_y() const
+    {
+        return MatrixBlock(centered_, dim_x_, 0, dim_y(), centered_.cols());
+    }
+
+    /**
+     * \brief Centered points of \f$X\f$ scaled by their covariance weights,
+     *        i.e. \f$P_xW\f$
+     */
+    MatrixBlock weighted_x() const
+    {
+        return MatrixBlock(weighted_, 0, 0, dim_x_, weighted_.cols());
+    }
+
+    /**
+     * \brief Centered points of \f$Y\f$ scaled by their covariance weights,
+     *        i.e. \f$P_yW\f$
+     */
+    MatrixBlock weighted_y() const
+    {
+        return MatrixBlock(weighted_, dim_x_, 0, dim_y(), weighted_.cols());
+    }
+
+    /**
+     * \brief Weighted covariance \f$\Sigma_{xx}\f$
+     */
+    MatrixBlock cov_xx() const
+    {
+        return MatrixBlock(covariance_, 0, 0, dim_x_, dim_x_);
+    }
+
+    /**
+     * \brief Weighted cross-covariance \f$\Sigma_{xy}\f$
+     */
+    MatrixBlock cov_xy() const
+    {
+        return MatrixBlock(covariance_, 0, dim_x_, dim_x_, dim_y());
+    }
+
+    /**
+     * \brief Weighted covariance \f$\Sigma_{yy}\f$
+     */
+    MatrixBlock cov_yy() const
+    {
+        return MatrixBlock(covariance_, dim_x_, dim_x_, dim_y(), dim_y());
+    }
+
+protected:
+    /** \cond internal */
+
+    /**
+     * \brief Evaluates the lower triangle of the symmetric joint covariance
+     *        \f$PWP^T\f$ which halves the cost of the product and mirrors it
+     *        onto the upper triangle
+     */
+    void covariance()
+    {
+        const int dimension = centered_.rows();
+        if (covariance_.rows() != dimension)
+        {
+            covariance_.resize(dimension, dimension);
+        }
+
+        covariance_.triangularView<Eigen::Lower>() =
+            weighted_ * centered_.transpose();
+        covariance_.triangularView<Eigen::StrictlyUpper>() =
+            covariance_.transpose();
+    }
+
+    int dim_y() const
+    {
+        return int(mean_.size()) - dim_x_;
+    }
+
+    void resize(int dimension, int point_count)
+    {
+        if (mean_.size() != dimension) mean_.resize(dimension);
+
+        if (centered_.rows() != dimension || centered_.cols() != point_count)
+        {
+            centered_.resize(dimension, point_count);
+            weighted_.resize(dimension, point_count);
+        }
+
+    }
+
+    int dim_x_;
+    Vector mean_;
+    Matrix centered_;
+    Matrix weighted_;
+    Matrix covariance_;
+
+    /** \endcond */
+};
+
+}
@@ -0,0 +1,349 @@
+/*
+ * This is part of the fl library, a C++ Bayesian filtering library
+ * (https://github.com/filtering-library)
+ *
+ * Copyright (c) 2015 Max Planck Society,
+ * 				 Autonomous Motion Department,
+ * 			     Institute for Intelligent Systems
+ *
+ * This Source Code Form is subject to the terms of the MIT License (MIT).
+ * A copy of the license can be found in the LICENSE file distributed with this
+ * source code.
+ */
+
+/**
+ * \file quasi_monte_carlo_transform.hpp
+ * \date October 2026
+ * \author agent (agent@local)
+ */
+
+#pragma once
+
+
+#include <cmath>
+#include <vector>
+#include <limits>
+#include <cstdint>
+#include <algorithm>
+
+#include <fl/util/math.hpp>
+#include <fl/util/random.hpp>
+#include <fl/util/traits.hpp>
+#include <fl/util/descriptor.hpp>
+#include <fl/distribution/gaussian.hpp>
+#include <fl/filter/gaussian/transform/point_set_transform.hpp>
+#include <fl/filter/gaussian/transform/monte_carlo_transform.hpp>
+
+namespace fl
+{
+
+/**
+ * \ingroup point_set_transform
+ *
+ * Randomized quasi-Monte Carlo transform (RQMC). Instead of drawing i.i.d.
+ * samples as the MonteCarloTransform does, the points are taken from a
+ * scrambled Halton low-discrepancy sequence in the unit cube, mapped onto
+ * standard normal variates using fl::uniform_to_normal and finally onto the
+ * Gaussian using its square root,
+ *
+ * \f$ x_i = \mu + L\, \Phi^{-1}(u_i) \f$.
+ *
+ * The \f$k\f$-th dimension of the unit cube uses the radical inverse in the
+ * \f$k\f$-th prime base. Each digit of the \f$k\f$-th dimension is scrambled
+ * by a random permutation of \f$\{0, \ldots, b_k - 1\}\f$ which breaks the
+ * correlation between high dimensions of the plain Halton sequence. Finally a
+ * random Cranley-Patterson shift modulo 1 is applied which renders each point
+ * marginally uniform, hence the integral estimate unbiased. The randomization
+ * is redrawn on every transform.
+ *
+ * For smooth integrands the integration error decreases almost as
+ * \f$O(N^{-1})\f$ in the number of points \f$N\f$ compared to
+ * \f$O(N^{-1/2})\f$ of the MonteCarloTransform. That is, the same moment
+ * accuracy is reached with considerably fewer model evaluations.
+ *
+ * The number of points is determined by the PointCountPolicy in the same way
+ * as for the MonteCarloTransform.
+ *
+ * forward() advances the random stream of the transform and draws the digit
+ * permutations into a workspace of the transform. Hence, as the
+ * MonteCarloTransform, a transform must not be used by several threads
+ * concurrently. Each thread should own a copy with a stream of its own, see
+ * seed().
+ *
+ * \tparam PointCountPolicy     The number of points policy. Default is a linear
+ *                              policy LinearPointCountPolicy<>
+ */
+template <
+    typename PointCountPolicy = LinearPointCountPolicy<>
+>
+class QuasiMonteCarloTransform
+    : public PointSetTransform<QuasiMonteCarloTransform<PointCountPolicy>>,
+      public Descriptor
+{
+public:
+    /**
+     * Creates a QuasiMonteCarloTransform
+     */
+    QuasiMonteCarloTransform()
+        : PointSetTransform<QuasiMonteCarloTransform<PointCountPolicy>>(this),
+          generator_(fl::random_seed(), fl::next_stream_id())
+    { }
+
+    /**
+     * \copydoc PointSetTransform::forward(const Gaussian&,
+     *                                     PointSet&) const
+     *
+     * \throws WrongSizeException
+     * \throws ResizingFixedSizeEntityException
+     */
+    template <typename Gaussian_, typename PointSet_>
+    void operator()(const Gaussian_& gaussian,
+                    PointSet_& point_set) const
+    {
+        forward(gaussian, gaussian.dimension(), 0, point_set);
+    }
+
+    /**
+     * \copydoc PointSetTransform::forward(const Gaussian&,
+     *                                     int global_dimension,
+     *                                     int dimension_offset,
+     *                                     PointSet&) const
+     *
+     * \throws WrongSizeException
+     * \throws ResizingFixedSizeEntityException
+     */
+    template <typename Gaussian_, typename PointSet_>
+    void operator()(const Gaussian_& gaussian,
+                    int global_dimension,
+                    int dimension_offset,
+                    PointSet_& point_set) const
+    {
+        forward(gaussian, global_dimension, dimension_offset, point_set);
+    }
+
+    /**
+     * \copydoc PointSetTransform::forward(const Gaussian&,
+     *                                     PointSet&) const
+     *
+     * \throws WrongSizeException
+     * \throws ResizingFixedSizeEntityException
+     */
+    template <typename Gaussian_, typename PointSet_>
+    void forward(const Gaussian_& gaussian,
+                 PointSet_& point_set) const
+    {
+        forward(gaussian, gaussian.dimension(), 0, point_set);
+    }
+
+    /**
+     * \copydoc PointSetTransform::forward(const Gaussian&,
+     *                                     int global_dimension,
+     *                                     int dimension_offset,
+     *                                     PointSet&) const
+     *
+     * The marginal Gaussian occupies the dimensions
+     * \f$[\text{offset}, \text{offset} + \text{dim})\f$ of the global
+     * low-discrepancy sequence. Hence, the points of several marginals
+     * transformed with the same global dimension form a joint low-discrepancy
+     * point set.
+     *
+     * \throws WrongSizeException
+     * \throws ResizingFixedSizeEntityException
+     */
+    template <typename Gaussian_, typename PointSet_>
+    void forward(const Gaussian_& gaussian,
+                 int global_dimension,
+                 int dimension_offset,
+                 PointSet_& point_set) const
+    {
+        const int dimension = gaussian.dimension();
+        const int point_count = number_of_points(global_dimension);
+
+        assert(point_count > 0);
+        assert(dimension_offset + dimension <= global_dimension);
+
+        point_set.resize(dimension, point_count);
+
+        auto& points = point_set.points();
+
+        for (int k = 0; k < dimension; ++k)
+        {
+            const int base = prime(dimension_offset + k);
+            const Real shift = uniform();
+            draw_permutation(base);
+
+            for (int i = 0; i < point_count; ++i)
+            {
+                Real u = scrambled_radical_inverse(i, base) + shift;
+                if (u >= Real(1)) u -= Real(1);
+
+                points(k, i) = fl::uniform_to_normal(
+                    std::min(std::max(u, min_uniform()), 1 - min_uniform()));
+            }
+        }
+
+        points = (gaussian.square_root() * points).colwise()
+                    + gaussian.mean();
+    }
+
+    /**
+     * \return Number of points generated by this transform
+     *
+     * \param dimension Dimension of the Gaussian
+     */
+    static constexpr int number_of_points(int dimension)
+    {
+        return PointCountPolicy::number_of_points(dimension);
+    }
+
+    /**
+     * \brief Restarts the randomization on the stream \a stream_id of
+     * \a seed, see fl::Philox4x32
+     */
+    void seed(std::uint64_t seed, std::uint64_t stream_id)
+    {
+        generator_.seed(seed, stream_id);
+    }
+
+    virtual std::string name() const
+    {
+        return "QuasiMonteCarloTransform";
+    }
+
+    virtual std::string description() const
+    {
+        return "Randomized quasi-Monte Carlo transform based on a scrambled "
+               "Halton sequence";
+    }
+
+protected:
+    /** \cond internal */
+
+    /**
+     * \return The k-th prime, starting with 2 for k = 0. The primes of the
+     *         first PrimeTableSize dimensions are computed once and shared by
+     *         all transforms.
+     */
+    static int prime(int k)
+    {
+        static const std::vector<int> table = first_primes(PrimeTableSize);
+
+        if (k < int(table.size())) return table[k];
+
+        // beyond the table the primes are searched without caching
+        int candidate = table.back();
+        for (int n = int(table.size()) - 1; n < k; ++n)
+        {
+            do { candidate += 2; } while (!is_prime(candidate, table));
+        }
+
+        return candidate;
+    }
+
+    /**
+     * \return The first \a count primes
+     */
+    static std::vector<int> first_primes(int count)
+    {
+        std::vector<int> primes;
+        primes.reserve(count);
+        primes.push_back(2);
+
+        for (int candidate = 3; int(primes.size()) < count; candidate += 2)
+        {
+            if (is_prime(candidate, primes)) primes.push_back(candidate);
+        }
+
+        return primes;
+    }
+
+    /**
+     * \return True if the odd \a candidate has no divisor among the
+     *         ascending \a primes. The primes must reach the square root
+     *         of the candidate or include all primes below it.
+     */
+    static bool is_prime(int candidate, const std::vector<int>& primes)
+    {
+        for (int p: primes)
+        {
+            if (p * p > candidate) return true;
+            if (candidate % p == 0) return false;
+        }
+
+        // all table primes are below the square root
+        for (int d = primes.back() + 2; d * d <= candidate; d += 2)
+        {
+            if (candidate % d == 0) return false;
+        }
+
+        return true;
+    }
+
+    /**
+     * \brief Draws a random digit permutation of {0, ..., base - 1}. The
+     *        workspace grows to the largest base used and is reused
+     *        afterwards.
+     */
+    void draw_permutation(int base) const
+    {
+        permutation_.resize(base);
+        for (int d = 0; d < base; ++d) permutation_[d] = d;
+
+        for (int d = base - 1; d > 0; --d)
+        {
+            const int j = int(uniform() * (d + 1));
+            std::swap(permutation_[d], permutation_[std::min(j, d)]);
+        }
+    }
+
+    /**
+     * \return Radical inverse of i in the given base with each digit mapped
+     * through the current permutation
+     */
+    Real scrambled_radical_inverse(int i, int base) const
+    {
+        const Real inverse_base = Real(1) / Real(base);
+
+        Real u = 0;
+        Real factor = inverse_base;
+        unsigned int n = i;
+
+        while (n > 0)
+        {
+            u += permutation_[n % base] * factor;
+            n /= base;
+            factor *= inverse_base;
+        }
+
+        // the infinitely many leading zero digits are permuted as well which
+        // adds the geometric series pi(0) * factor * (1 + 1/b + 1/b^2 + ...)
+        u += permutation_[0] * factor * Real(base) / Real(base - 1);
+
+        return u;
+    }
+
+    /**
+     * \return Uniform variate in [0, 1)
+     */
+    Real uniform() const
+    {
+        const std::uint64_t bits =
+            (std::uint64_t(generator_()) << 32) | generator_();
+
+        return Real(bits >> 11) * Real(1.0 / 9007199254740992.0); // 2^-53
+    }
+
+    static constexpr Real min_uniform()
+    {
+        return Real(1.e-12);
+    }
+
+    enum : int { PrimeTableSize = 1024 };
+
+    mutable fl::RandomEngine generator_;
+    mutable std::vector<int> permutation_;
+
+    /** \endcond */
+};
+
+}
@@ -0,0 +1,157 @@
+/*
+ * This is part of the fl library, a C++ Bayesian filtering library
+ * (https://github.com/filtering-library)
+ *
+ * Copyright (c) 2015 Max Planck Society,
+ * 				 Autonomous Motion Department,
+ * 			     Institute for Intelligent Systems
+ *
+ * This Source Code Form is subject to the terms of the MIT License (MIT).
+ * A copy of the license can be found in the LICENSE file distributed with this
+ * source code.
+ */
+
+/**
+ * \file rao_blackwellized_point_set.hpp
+ * \date October 2026
+ * \author agent (agent@local)
+ */
+
+#pragma once
+
+
+#include <Eigen/Dense>
+
+#include <fl/util/types.hpp>
+#include <fl/util/math/linear_algebra.hpp>
+#include <fl/distribution/gaussian.hpp>
+#include <fl/filter/gaussian/transform/point_set.hpp>
+
+namespace fl
+{
+
+/**
+ * \ingroup nonlinear_gaussian_filter
+ *
+ * \brief Points of a Gaussian \f${\cal N}(\mu, \Sigma)\f$ over the partitioned
+ * state \f$x = [x_n; x_l]\f$ of which only the nonlinear substate \f$x_n\f$
+ * is sampled by the quadrature.
+ *
+ * The quadrature points \f$\chi_i\f$ of the marginal
+ * \f${\cal N}(\mu_n, \Sigma_{nn})\f$ are completed by the conditional mean of
+ * the linear substate
+ *
+ * \f$ X_i = \begin{pmatrix} \chi_i \\
+ *                           \mu_l + \Sigma_{ln}\Sigma_{nn}^{-1}(\chi_i - \mu_n)
+ *           \end{pmatrix} \f$
+ *
+ * while the remaining uncertainty of \f$x_l\f$ is the conditional covariance
+ * \f$\Sigma_{l|n} = \Sigma_{ll} - \Sigma_{ln}\Sigma_{nn}^{-1}\Sigma_{nl}\f$
+ * which is the same for all points. For models linear in \f$x_l\f$ given
+ * \f$x_n\f$ this covariance is propagated in closed form. The number of
+ * points depends on \f$\dim(x_n)\f$ only.
+ */
+template <typename State>
+class RaoBlackwellizedPointSet
+{
+public:
+    typedef PointSet<State, Eigen::Dynamic> StatePointSet;
+    typedef Eigen::Matrix<Real, Eigen::Dynamic, Eigen::Dynamic> Matrix;
+    typedef Eigen::Matrix<Real, Eigen::Dynamic, 1> Vector;
+
+public:
+    /**
+     * \brief Generates the points of the \a belief given the dimension
+     *        \a nonlinear_dim of the nonlinear substate which is the head of
+     *        the state
+     */
+    template <typename Quadrature, typename Belief>
+    void compute(const Quadrature& quadrature,
+                 const Belief& belief,
+                 int nonlinear_dim)
+    {
+        const int dim = belief.dimension();
+        const int n = nonlinear_dim;
+        const int l = dim - n;
+        const int point_count = Quadrature::number_of_points(n);
+
+        auto&& mean = belief.mean();
+        auto&& cov = belief.covariance();
+
+        nonlinear_mean_ = mean.head(n);
+        nonlinear_cov_ = cov.topLeftCorner(n, n);
+
+        if (marginal_.dimension() != n) marginal_.dimension(n);
+        marginal_.mean(nonlinear_mean_);
+        marginal_.covariance(nonlinear_cov_);
+
+        nonlinear_points_.resize(n, point_count);
+        quadrature.transform()(marginal_, nonlinear_points_);
+
+        // gain of the linear substate L^T = Sigma_nn^-1 Sigma_nl
+        nonlinear_cov_factor_.compute(nonlinear_cov_);
+        gain_transpose_ = cov.topRightCorner(n, l);
+        nonlinear_cov_factor_.solve_in_place(gain_transpose_);
+
+        conditional_cov_ = cov.bottomRightCorner(l, l);
+        conditional_cov_.noalias() -=
+            cov.bottomLeftCorner(l, n) * gain_transpose_;
+
+        points_.resize(dim, point_count);
+        auto& X = points_.points();
+        auto&& chi = nonlinear_points_.points();
+
+        for (int i = 0; i < point_count; ++i)
+        {
+            deviation_ = chi.col(i) - nonlinear_mean_;
+
+            X.col(i).head(n) = chi.col(i);
+            X.col(i).tail(l) = mean.tail(l);
+            X.col(i).tail(l).noalias() +=
+                gain_transpose_.transpose() * deviation_;
+
+            points_.weight(i,
+                           nonlinear_points_.weights(i).w_mean,
+                           nonlinear_points_.weights(i).w_cov);
+        }
+    }
+
+    /**
+     * \return Full state points \f$X_i\f$ of the last compute()
+     */
+    const StatePointSet& points() const
+    {
+        return points_;
+    }
+
+    /**
+     * \return Conditional covariance \f$\Sigma_{l|n}\f$ of the linear substate
+     */
+    const Matrix& conditional_covariance() const
+    {
+        return conditional_cov_;
+    }
+
+    /**
+     * \return Dimension of the linear substate \f$x_l\f$
+     */
+    int linear_dimension() const
+    {
+        return conditional_cov_.rows();
+    }
+
+protected:
+    /** \cond internal */
+    StatePointSet points_;
+    PointSet<Vector, Eigen::Dynamic> nonlinear_points_;
+    Gaussian<Vector> marginal_;
+    Vector nonlinear_mean_;
+    Vector deviation_;
+    Matrix nonlinear_cov_;
+    Matrix gain_transpose_;
+    Matrix conditional_cov_;
+    SymmetricFactorization<Matrix> nonlinear_cov_factor_;
+    /** \endcond */
+};
+
+}
@@ -0,0 +1,466 @@
+/*
+ * This is part of the fl library, a C++ Bayesian filtering library
+ * (https://github.com/filtering-library)
+ *
+ * Copyright (c) 2015 Max Planck Society,
+ * 				 Autonomous Motion Department,
+ * 			     Institute for Intelligent Systems
+ *
+ * This Source Code Form is subject to the terms of the MIT License (MIT).
+ * A copy of the license can be found in the LICENSE file distributed with this
+ * source code.
+ */
+
+/**
+ * \file sparse_grid_gauss_hermite_transform.hpp
+ * \date October 2026
+ * \author agent (agent@local)
+ */
+
+#pragma once
+
+
+#include <map>
+#include <cmath>
+#include <mutex>
+#include <memory>
+#include <vector>
+
+#include <Eigen/Dense>
+
+#include <fl/util/types.hpp>
+#include <fl/util/traits.hpp>
+#include <fl/util/descriptor.hpp>
+#include <fl/distribution/gaussian.hpp>
+#include <fl/filter/gaussian/transform/point_set_transform.hpp>
+
+namespace fl
+{
+
+/**
+ * \ingroup point_set_transform
+ *
+ * Smolyak sparse-grid Gauss-Hermite transform \cite jia2012sparse . It
+ * implements the PointSetTransform interface.
+ *
+ * The univariate rule of level \f$l\f$ is the \f$(2l-1)\f$-point
+ * Gauss-Hermite rule of the standard normal distribution. The Smolyak
+ * combination of these rules
+ *
+ * \f$
+ * A_{L,n} = \displaystyle\sum_{L \leq |i| \leq L+n-1}
+ *     (-1)^{L+n-1-|i|} \binom{n-1}{L+n-1-|i|}
+ *     U^{i_1} \otimes \cdots \otimes U^{i_n}
+ * \f$
+ *
+ * integrates all polynomials of total degree \f$2L-1\f$ exactly while the
+ * number of points grows polynomially in the dimension \f$n\f$ instead of
+ * exponentially as \f$(2L-1)^n\f$ for the tensor-product rule. Level 2 yields
+ * \f$2n+1\f$ points along the axes, level 3 yields \f$2n^2+4n+1\f$ points and
+ * integrates the fourth moments exactly.
+ *
+ * The unit grid and its weights are computed once per dimension and reused
+ * afterwards. The grids are immutable and kept in a cache which is guarded
+ * by a mutex and shared among copies of the transform. Hence, forward() may
+ * be called concurrently. The points of a Gaussian are \f$x_i = \mu + L s_i\f$ with the
+ * unit points \f$s_i\f$ and \f$\Sigma = LL^T\f$. Note that some of the
+ * weights of level 3 and above are negative.
+ *
+ * \tparam Level    Accuracy level \f$L \geq 1\f$ of the rule
+ */
+template <int Level>
+class SparseGridGaussHermiteTransform
+    : public PointSetTransform<SparseGridGaussHermiteTransform<Level>>,
+      public Descriptor
+{
+    static_assert(Level >= 1, "Sparse grid level must be at least 1");
+
+public:
+    /**
+     * Creates a SparseGridGaussHermiteTransform
+     */
+    SparseGridGaussHermiteTransform()
+        : PointSetTransform<SparseGridGaussHermiteTransform<Level>>(this),
+          grids_(std::make_shared<GridCache>())
+    { }
+
+    /**
+     * \copydoc PointSetTransform::forward(const Gaussian&,
+     *                                     PointSet&) const
+     *
+     * \throws WrongSizeException
+     * \throws ResizingFixedSizeEntityException
+     */
+    template <typename Gaussian_, typename PointSet_>
+    void forward(const Gaussian_& gaussian,
+                 PointSet_& point_set) const
+    {
+        forward(gaussian, gaussian.dimension(), 0, point_set);
+    }
+
+    /**
+     * \copydoc PointSetTransform::forward(const Gaussian&,
+     *                                     PointSet&) const
+     *
+     * \throws WrongSizeException
+     * \throws ResizingFixedSizeEntityException
+     */
+    template <typename Gaussian_, typename PointSet_>
+    void operator()(const Gaussian_& gaussian,
+                    PointSet_& point_set) const
+    {
+        forward(gaussian, gaussian.dimension(), 0, point_set);
+    }
+
+    /**
+     * \copydoc PointSetTransform::forward(const Gaussian&,
+     *                                     int global_dimension,
+     *                                     int dimension_offset,
+     *                                     PointSet&) const
+     *
+     * \throws WrongSizeException
+     * \throws ResizingFixedSizeEntityException
+     */
+    template <typename Gaussian_, typename PointSet_>
+    void forward(const Gaussian_& gaussian,
+                 int global_dimension,
+                 int dimension_offset,
+                 PointSet_& point_set) const
+    {
+        typedef typename Traits<PointSet_>::Point  Point;
+        typedef typename Traits<PointSet_>::Weight Weight;
+
+        const int point_count = number_of_points(global_dimension);
+
+        assert(point_count > 0);
+
+        /**
+         * \internal
+         *
+         * \remark
+         * A PointSet with a fixed number of points must have the
+         * correct number of points which is required by this transform
+         */
+        if (IsFixed<Traits<PointSet_>::NumberOfPoints>() &&
+            Traits<PointSet_>::NumberOfPoints != point_count)
+        {
+            fl_throw(
+                WrongSizeException("Incompatible number of points of the"
+                                   " specified fixed-size PointSet"));
+        }
+
+        // will resize of transform size is different from point count.
+        point_set.resize(point_count);
+
+        const Grid& grid = *grid_of(global_dimension);
+
+        auto&& covariance_sqrt = gaussian.square_root();
+        const Point& mean = gaussian.mean();
+
+        auto&& unit_points = grid.unit_points.middleRows(
+                                 dimension_offset, gaussian.dimension());
+
+        for (int i = 0; i < point_count; ++i)
+        {
+            point_set.point(i,
+                            mean + covariance_sqrt * unit_points.col(i),
+                            Weight{grid.weights(i), grid.weights(i)});
+        }
+    }
+
+    /**
+     * \copydoc PointSetTransform::forward(const Gaussian&,
+     *                                     int global_dimension,
+     *                                     int dimension_offset,
+     *                                     PointSet&) const
+     *
+     * \throws WrongSizeException
+     * \throws ResizingFixedSizeEntityException
+     */
+    template <typename Gaussian_, typename PointSet_>
+    void operator()(const Gaussian_& gaussian,
+                    int global_dimension,
+                    int dimension_offset,
+                    PointSet_& point_set) const
+    {
+        forward(gaussian, global_dimension, dimension_offset, point_set);
+    }
+
+    /**
+     * \return Number of points generated by this transform
+     *
+     * A point has the coordinate 0 in all but \f$k\f$ dimensions. The nonzero
+     * coordinates are taken from the rules of levels \f$l_j = a_j + 1\f$ with
+     * \f$\sum_j a_j \leq L - 1\f$, each providing \f$2a_j\f$ nonzero nodes.
+     * Summing over all such points yields
+     * \f$\sum_{k<n} \binom{n}{k} 2^k \binom{L - 1 + k}{2k}\f$ plus the
+     * points without a zero coordinate if \f$L > n\f$.
+     *
+     * \param dimension Dimension of the Gaussian
+     */
+    static constexpr int number_of_points(int dimension)
+    {
+        return (dimension != Eigen::Dynamic)
+                    ? count_points(dimension, 0)
+                    : Eigen::Dynamic;
+    }
+
+public:
+    /** \cond INTERNAL */
+
+    /**
+     * \brief Unit points of the grid of the specified dimension
+     */
+    Eigen::Matrix<Real, Eigen::Dynamic, Eigen::Dynamic>
+    unit_points(int dimension) const
+    {
+        return grid_of(dimension)->unit_points;
+    }
+
+    /**
+     * \brief Weights of the grid of the specified dimension
+     */
+    Eigen::Matrix<Real, Eigen::Dynamic, 1> weights(int dimension) const
+    {
+        return grid_of(dimension)->weights;
+    }
+
+    /** \endcond */
+
+    virtual std::string name() const
+    {
+        return "SparseGridGaussHermiteTransform<"
+                + this->list_arguments(std::to_string(Level))
+                + ">";
+    }
+
+    virtual std::string description() const
+    {
+        return "Smolyak sparse-grid Gauss-Hermite transform of level "
+                + std::to_string(Level);
+    }
+
+protected:
+    /** \cond INTERNAL */
+
+    /**
+     * \brief Unit points and weights of the grid of one dimension
+     */
+    struct Grid
+    {
+        Eigen::Matrix<Real, Eigen::Dynamic, Eigen::Dynamic> unit_points;
+        Eigen::Matrix<Real, Eigen::Dynamic, 1> weights;
+    };
+
+    /**
+     * \brief Grids computed so far indexed by their dimension
+     */
+    struct GridCache
+    {
+        std::mutex mutex;
+        std::map<int, std::shared_ptr<const Grid>> grids;
+    };
+
+    /**
+     * \brief Returns the grid of the specified dimension and computes it
+     *        unless it is already available
+     */
+    std::shared_ptr<const Grid> grid_of(int dimension) const
+    {
+        std::lock_guard<std::mutex> lock(grids_->mutex);
+
+        auto& grid = grids_->grids[dimension];
+        if (!grid) grid = compute_grid(dimension);
+
+        return grid;
+    }
+
+    static constexpr int binomial(int n, int k)
+    {
+        return k == 0 ? 1 : binomial(n, k - 1) * (n - k + 1) / k;
+    }
+
+    static constexpr int count_points(int dimension, int k)
+    {
+        return (k > dimension || k > Level - 1)
+                ? 0
+                : binomial(dimension, k) * (1 << k) * count_levels(dimension, k)
+                  + count_points(dimension, k + 1);
+    }
+
+    /**
+     * \brief Weighted number of level excesses \f$a_1, \ldots, a_k \geq 1\f$
+     *        of \a k nonzero coordinates. If all coordinates are nonzero,
+     *        the excess cannot be absorbed by center coordinates and must be
+     *        at least \f$L - n\f$.
+     */
+    static constexpr int count_levels(int dimension, int k)
+    {
+        return binomial(Level - 1 + k, 2 * k)
+               - (k == dimension && Level - dimension > dimension
+                    ? binomial(Level - 1, 2 * k)
+                    : 0);
+    }
+
+    /**
+     * \brief Univariate Gauss-Hermite rule of the standard normal with
+     *        \a m nodes by means of the Golub-Welsch algorithm
+     */
+    static void gauss_hermite(int m,
+                              std::vector<Real>& nodes,
+                              std::vector<Real>& weights)
+    {
+        Eigen::Matrix<Real, Eigen::Dynamic, Eigen::Dynamic> jacobi =
+            Eigen::Matrix<Real, Eigen::Dynamic, Eigen::Dynamic>::Zero(m, m);
+
+        for (int k = 1; k < m; ++k)
+        {
+            jacobi(k, k - 1) = jacobi(k - 1, k) = std::sqrt(Real(k));
+        }
+
+        Eigen::SelfAdjointEigenSolver<
+            Eigen::Matrix<Real, Eigen::Dynamic, Eigen::Dynamic>
+        > solver(jacobi);
+
+        nodes.resize(m);
+        weights.resize(m);
+        for (int k = 0; k < m; ++k)
+        {
+            nodes[k] = solver.eigenvalues()(k);
+            weights[k] = std::pow(solver.eigenvectors()(0, k), 2);
+        }
+
+        // the odd rules are symmetric with an exact center node
+        nodes[m / 2] = 0;
+    }
+
+    /**
+     * \brief Computes the unit grid and the weights of the specified
+     *        dimension.
+     *
+     * Each point is identified by the codes of its coordinates. The code of
+     * the center node is 0 in every rule, the code of the \f$k\f$-th node of
+     * the rule of level \f$l\f$ is \f$2lL + k + 1\f$. Identical
+     * points of different tensor grids are merged by summing up their
+     * weights.
+     */
+    static std::shared_ptr<const Grid> compute_grid(int dimension)
+    {
+        const int base = 2 * Level;
+
+        std::vector<std::vector<Real>> rule_nodes(Level + 1);
+        std::vector<std::vector<Real>> rule_weights(Level + 1);
+        for (int l = 1; l <= Level; ++l)
+        {
+            gauss_hermite(2 * l - 1, rule_nodes[l], rule_weights[l]);
+        }
+
+        std::map<std::vector<int>, Real> grid;
+        std::vector<int> levels(dimension, 1);
+        std::vector<int> code(dimension, 0);
+
+        add_tensor_grids(0, Level - 1, rule_weights, levels, code, grid);
+
+        const int point_count = int(grid.size());
+        assert(point_count == number_of_points(dimension));
+
+        auto result = std::make_shared<Grid>();
+        result->unit_points.resize(dimension, point_count);
+        result->weights.resize(point_count);
+
+        int i = 0;
+        for (auto& entry: grid)
+        {
+            for (int j = 0; j < dimension; ++j)
+            {
+                const int c = entry.first[j];
+                result->unit_points(j, i) =
+                    c == 0 ? Real(0)
+                           : rule_nodes[c / base][c % base - 1];
+            }
+            result->weights(i) = entry.second;
+            ++i;
+        }
+
+        return result;
+    }
+
+    /**
+     * \brief Enumerates the multi-indices \f$i\f$ of the Smolyak sum with the
+     *        remaining level \a excess and adds their tensor grids
+     */
+    static void add_tensor_grids(
+        int j,
+        int excess,
+        const std::vector<std::vector<Real>>& rule_weights,
+        std::vector<int>& levels,
+        std::vector<int>& code,
+        std::map<std::vector<int>, Real>& grid)
+    {
+        const int dimension = int(levels.size());
+
+        if (j == dimension)
+        {
+            // |i| = n + L - 1 - excess
+            const int d = excess;
+            if (d > dimension - 1) return;
+
+            const Real coefficient =
+                (d % 2 == 0 ? 1 : -1) * Real(binomial(dimension - 1, d));
+
+            add_tensor_nodes(
+                0, coefficient, rule_weights, levels, code, grid);
+            return;
+        }
+
+        for (int a = 0; a <= excess; ++a)
+        {
+            levels[j] = a + 1;
+            add_tensor_grids(
+                j + 1, excess - a, rule_weights, levels, code, grid);
+        }
+        levels[j] = 1;
+    }
+
+    /**
+     * \brief Adds the nodes of the tensor grid of the multi-index \a levels
+     */
+    static void add_tensor_nodes(
+        int j,
+        Real weight,
+        const std::vector<std::vector<Real>>& rule_weights,
+        const std::vector<int>& levels,
+        std::vector<int>& code,
+        std::map<std::vector<int>, Real>& grid)
+    {
+        const int dimension = int(levels.size());
+
+        if (j == dimension)
+        {
+            grid[code] += weight;
+            return;
+        }
+
+        const int l = levels[j];
+        const int m = 2 * l - 1;
+        const int base = 2 * Level;
+
+        for (int k = 0; k < m; ++k)
+        {
+            code[j] = (k == m / 2) ? 0 : l * base + k + 1;
+            add_tensor_nodes(j + 1,
+                             weight * rule_weights[l][k],
+                             rule_weights,
+                             levels,
+                             code,
+                             grid);
+        }
+        code[j] = 0;
+    }
+
+    std::shared_ptr<GridCache> grids_;
+
+    /** \endcond */
+};
+
+}
@@ -0,0 +1,274 @@
+/*
+ * This is part of the fl library, a C++ Bayesian filtering library
+ * (https://github.com/filtering-library)
+ *
+ * Copyright (c) 2015 Max Planck Society,
+ * 				 Autonomous Motion Department,
+ * 			     Institute for Intelligent Systems
+ *
+ * This Source Code Form is subject to the terms of the MIT License (MIT).
+ * A copy of the license can be found in the LICENSE file distributed with this
+ * source code.
+ */
+
+/**
+ * \file spherical_simplex_transform.hpp
+ * \date October 2026
+ * \author agent (agent@local)
+ */
+
+#pragma once
+
+
+#include <cmath>
+
+#include <Eigen/Dense>
+
+#include <fl/util/types.hpp>
+#include <fl/util/traits.hpp>
+#include <fl/util/descriptor.hpp>
+#include <fl/exception/exception.hpp>
+#include <fl/distribution/gaussian.hpp>
+#include <fl/filter/gaussian/transform/point_set_transform.hpp>
+
+namespace fl
+{
+
+/**
+ * \ingroup point_set_transform
+ *
+ * Spherical simplex unscented transform \cite julier2003spherical . It
+ * implements the PointSetTransform interface using the minimal number of
+ * \f$n+2\f$ points which match the mean and the covariance of an
+ * \f$n\f$-dimensional Gaussian.
+ *
+ * The points \f$x_i = \mu + L s_i\f$ with \f$\Sigma = LL^T\f$ are obtained from
+ * the unit points \f$s_0 = 0\f$ and \f$s_1, \ldots, s_{n+1}\f$ which lie on a
+ * hypersphere. The \f$k\f$-th coordinate of \f$s_i\f$ is
+ *
+ * \f$
+ * s_{i,k} = \begin{cases}
+ *   -1 / \sqrt{k(k+1)W_1} & i \leq k \\
+ *   k / \sqrt{k(k+1)W_1}  & i = k + 1 \\
+ *   0                     & \text{otherwise}
+ * \end{cases}
+ * \f$
+ *
+ * where \f$W_0\f$ is the weight of the center point and
+ * \f$W_1 = (1 - W_0)/(n + 1)\f$ the weight of the remaining points. Since the
+ * \f$k\f$-th coordinate depends on \f$k\f$ only and not on the dimension of
+ * the Gaussian, the points of the marginals of a joint Gaussian are formed
+ * consistently.
+ *
+ * By default all \f$n+2\f$ points are weighted equally, i.e.
+ * \f$W_0 = 1/(n+2)\f$, which spreads the points at a distance of roughly
+ * \f$\sqrt{n}\f$ standard deviations similar to the CubatureTransform.
+ */
+class SphericalSimplexTransform
+    : public PointSetTransform<SphericalSimplexTransform>,
+      public Descriptor
+{
+public:
+    /**
+     * Creates a SphericalSimplexTransform with equal weights of all points
+     */
+    SphericalSimplexTransform()
+        : PointSetTransform<SphericalSimplexTransform>(this),
+          weight_0_(-1)
+    { }
+
+    /**
+     * Creates a SphericalSimplexTransform
+     *
+     * \param weight_0  Weight \f$W_0 \in [0, 1)\f$ of the center point. Larger
+     *                  weights move the remaining points further away from
+     *                  the mean.
+     *
+     * \throws Exception if \a weight_0 is not within \f$[0, 1)\f$
+     */
+    explicit SphericalSimplexTransform(Real weight_0)
+        : PointSetTransform<SphericalSimplexTransform>(this),
+          weight_0_(weight_0)
+    {
+        if (!(weight_0 >= 0 && weight_0 < 1))
+        {
+            fl_throw(Exception("Spherical simplex center weight must be "
+                               "within [0, 1)"));
+        }
+    }
+
+    /**
+     * \copydoc PointSetTransform::forward(const Gaussian&,
+     *                                     PointSet&) const
+     *
+     * \throws WrongSizeException
+     * \throws ResizingFixedSizeEntityException
+     */
+    template <typename Gaussian_, typename PointSet_>
+    void forward(const Gaussian_& gaussian,
+                 PointSet_& point_set) const
+    {
+        forward(gaussian, gaussian.dimension(), 0, point_set);
+    }
+
+    /**
+     * \copydoc PointSetTransform::forward(const Gaussian&,
+     *                                     PointSet&) const
+     *
+     * \throws WrongSizeException
+     * \throws ResizingFixedSizeEntityException
+     */
+    template <typename Gaussian_, typename PointSet_>
+    void operator()(const Gaussian_& gaussian,
+                    PointSet_& point_set) const
+    {
+        forward(gaussian, gaussian.dimension(), 0, point_set);
+    }
+
+    /**
+     * \copydoc PointSetTransform::forward(const Gaussian&,
+     *                                     int global_dimension,
+     *                                     int dimension_offset,
+     *                                     PointSet&) const
+     *
+     * \throws WrongSizeException
+     * \throws ResizingFixedSizeEntityException
+     */
+    template <typename Gaussian_, typename PointSet_>
+    void forward(const Gaussian_& gaussian,
+                 int global_dimension,
+                 int dimension_offset,
+                 PointSet_& point_set) const
+    {
+        typedef typename Traits<PointSet_>::Point  Point;
+        typedef typename Traits<PointSet_>::Weight Weight;
+
+        const Real dim = Real(global_dimension);
+        const int point_count = number_of_points(global_dimension);
+
+        assert(point_count > 0);
+
+        /**
+         * \internal
+         *
+         * \remark
+         * A PointSet with a fixed number of points must have the
+         * correct number of points which is required by this transform
+         */
+        if (IsFixed<Traits<PointSet_>::NumberOfPoints>() &&
+            Traits<PointSet_>::NumberOfPoints != point_count)
+        {
+            fl_throw(
+                WrongSizeException("Incompatible number of points of the"
+                                   " specified fixed-size PointSet"));
+        }
+
+        // will resize of transform size is different from point count.
+        point_set.resize(point_count);
+
+        const int marginal_dimension = gaussian.dimension();
+        const Real w_1 = weight_i(dim);
+
+        // unit points restricted to the coordinates of this marginal
+        Eigen::Matrix<Real, Eigen::Dynamic, Eigen::Dynamic> unit_points =
+            Eigen::Matrix<Real, Eigen::Dynamic, Eigen::Dynamic>::Zero(
+                marginal_dimension, point_count);
+
+        for (int j = 0; j < marginal_dimension; ++j)
+        {
+            const Real k = Real(dimension_offset + j + 1);
+            const Real scale = Real(1) / std::sqrt(k * (k + 1) * w_1);
+            const int last = dimension_offset + j + 1;
+
+            unit_points.row(j).segment(1, last).setConstant(-scale);
+            unit_points(j, last + 1) = k * scale;
+        }
+
+        auto&& covariance_sqrt = gaussian.square_root();
+        const Point& mean = gaussian.mean();
+
+        point_set.point(0, mean, Weight{weight_0(dim), weight_0(dim)});
+
+        const Weight weight{w_1, w_1};
+        for (int i = 1; i < point_count; ++i)
+        {
+            point_set.point(
+                i, mean + covariance_sqrt * unit_points.col(i), weight);
+        }
+    }
+
+    /**
+     * \copydoc PointSetTransform::forward(const Gaussian&,
+     *                                     int global_dimension,
+     *                                     int dimension_offset,
+     *                                     PointSet&) const
+     *
+     * \throws WrongSizeException
+     * \throws ResizingFixedSizeEntityException
+     */
+    template <typename Gaussian_, typename PointSet_>
+    void operator()(const Gaussian_& gaussian,
+                    int global_dimension,
+                    int dimension_offset,
+                    PointSet_& point_set) const
+    {
+        forward(gaussian, global_dimension, dimension_offset, point_set);
+    }
+
+    /**
+     * \return Number of points generated by this transform
+     *
+     * \param dimension Dimension of the Gaussian
+     */
+    static constexpr int number_of_points(int dimension)
+    {
+        return (dimension != Eigen::Dynamic) ? dimension + 2 : Eigen::Dynamic;
+    }
+
+public:
+    /** \cond INTERNAL */
+
+    /**
+     * \return Mean and covariance weight \f$W_0\f$ of the center point
+     *
+     * \param dim Dimension of the Gaussian
+     */
+    Real weight_0(Real dim) const
+    {
+        return weight_0_ < 0 ? Real(1) / (dim + Real(2)) : weight_0_;
+    }
+
+    /**
+     * \return Mean and covariance weight \f$W_1\f$ of the remaining points
+     *
+     * \param dim Dimension of the Gaussian
+     */
+    Real weight_i(Real dim) const
+    {
+        return (Real(1) - weight_0(dim)) / (dim + Real(1));
+    }
+    /** \endcond */
+
+    virtual std::string name() const
+    {
+        return "SphericalSimplexTransform";
+    }
+
+    virtual std::string description() const
+    {
+        return "Spherical simplex unscented transform";
+    }
+
+protected:
+    /** \cond INTERNAL */
+
+    /**
+     * \brief Weight of the center point or a negative value if all points
+     *        are weighted equally
+     */
+    Real weight_0_;
+
+    /** \endcond */
+};
+
+}
@@ -133,7 +133,6 @@ public:
 
         auto&& covariance_sqrt = gaussian.square_root() * gamma_factor(dim);
 
-        Point point_shift;
         const Point& mean = gaussian.mean();
 
         // set the first point
@@ -156,7 +155,8 @@ public:
 
         for (int i = limit_1; i < limit_2; ++i)
         {
-            point_shift = covariance_sqrt.col(i - dimension_offset - 1);
+            // column expression of the scaled square root, not a temporary
+            auto&& point_shift = covariance_sqrt.col(i - dimension_offset - 1);
             point_set.point(i, mean + point_shift, weight_i);
             point_set.point(global_dimension + i, mean - point_shift, weight_i);
         }
@@ -0,0 +1,414 @@
+/*
+ * This is part of the fl library, a C++ Bayesian filtering library
+ * (https://github.com/filtering-library)
+ *
+ * Copyright (c) 2015 Max Planck Society,
+ * 				 Autonomous Motion Department,
+ * 			     Institute for Intelligent Systems
+ *
+ * This Source Code Form is subject to the terms of the MIT License (MIT).
+ * A copy of the license can be found in the LICENSE file distributed with this
+ * source code.
+ */
+
+/**
+ * \file extended_update_policy.hpp
+ * \date October 2026
+ * \author agent (agent@local)
+ */
+
+#pragma once
+
+
+#include <string>
+
+#include <Eigen/Dense>
+
+#include <fl/util/meta.hpp>
+#include <fl/util/traits.hpp>
+#include <fl/util/descriptor.hpp>
+#include <fl/util/math/dual.hpp>
+#include <fl/util/math/linear_algebra.hpp>
+#include <fl/filter/gaussian/update_policy/sigma_point_linear_update_policy.hpp>
+
+namespace fl
+{
+
+// Forward declarations
+template <typename...> class ExtendedUpdatePolicy;
+
+/**
+ * \internal
+ * \ingroup nonlinear_gaussian_filter
+ *
+ * \brief Kalman correction shared by the extended update policies. Given the
+ * observation \f$h(\mu)\f$ predicted at the mean and the Jacobian \f$H\f$ of
+ * the linearized model, the innovation covariance is
+ * \f$S = H\Sigma H^T + R\f$ where the policies add the noise term \f$R\f$.
+ */
+template <typename State, typename Obsrv>
+class ExtendedKalmanCorrection
+{
+public:
+    /**
+     * \return Log. likelihood \f$\log {\cal N}(y; h(\mu), S)\f$ of the
+     *         observation of the last update under the linearized model
+     */
+    Real log_likelihood() const
+    {
+        return cov_yy_factor_.log_normal_density(innovation_);
+    }
+
+protected:
+    /** \cond internal */
+
+    /**
+     * \brief Computes \f$\Sigma H^T\f$ (transposed) and \f$H\Sigma H^T\f$
+     */
+    template <typename Belief>
+    void innovation_covariance(const Belief& prior_belief)
+    {
+        obsrv_state_cov_.noalias() = jacobian_ * prior_belief.covariance();
+        cov_yy_.noalias() = obsrv_state_cov_ * jacobian_.transpose();
+    }
+
+    /**
+     * \brief Applies the Kalman gain \f$K = \Sigma H^TS^{-1}\f$
+     */
+    template <typename Belief>
+    void correct(const Belief& prior_belief,
+                 const Obsrv& obsrv,
+                 Belief& posterior_belief)
+    {
+        cov_yy_factor_.compute(cov_yy_);
+        gain_transpose_ = obsrv_state_cov_;
+        cov_yy_factor_.solve_in_place(gain_transpose_);
+
+        innovation_ = obsrv;
+        innovation_ -= expected_obsrv_;
+
+        mean_ = prior_belief.mean();
+        mean_.noalias() += gain_transpose_.transpose() * innovation_;
+
+        cov_ = prior_belief.covariance();
+        cov_.noalias() -= gain_transpose_.transpose() * obsrv_state_cov_;
+
+        // changing the dimension resets the belief which creates temporaries
+        if (posterior_belief.dimension() != prior_belief.dimension())
+        {
+            posterior_belief.dimension(prior_belief.dimension());
+        }
+
+        posterior_belief.mean(mean_);
+        posterior_belief.covariance(cov_);
+    }
+
+    typedef typename SecondMomentOf<Obsrv>::Type ObsrvCovariance;
+    typedef Eigen::Matrix<
+                Real, SizeOf<Obsrv>::Value, SizeOf<State>::Value
+            > ObsrvStateMatrix;
+
+    State mean_;
+    Obsrv expected_obsrv_;
+    Obsrv innovation_;
+    typename SecondMomentOf<State>::Type cov_;
+    ObsrvCovariance cov_yy_;
+    ObsrvStateMatrix jacobian_;
+    ObsrvStateMatrix obsrv_state_cov_;
+    ObsrvStateMatrix gain_transpose_;
+    SymmetricFactorization<ObsrvCovariance> cov_yy_factor_;
+
+    /** \endcond */
+};
+
+template <
+    typename Linearization,
+    typename ObservationFunction
+>
+class ExtendedUpdatePolicy<
+          Linearization,
+          ObservationFunction>
+    : public ExtendedUpdatePolicy<
+                Linearization,
+                NonAdditive<ObservationFunction>>
+{ };
+
+/**
+ * \ingroup nonlinear_gaussian_filter
+ *
+ * \brief Extended Kalman filter update of observation models with additive
+ * noise \f$y = h(x) + w\f$.
+ *
+ * The model is linearized at the predicted mean by a single evaluation of
+ * \c expected_observation() on Dual scalars, see AutoDiffLinearization,
+ * which yields \f$h(\mu)\f$ and the Jacobian \f$H\f$. The update is the
+ * Kalman filter update of the linearized model with
+ * \f$S = H\Sigma H^T + R\f$.
+ */
+template <
+    typename Linearization,
+    typename AdditiveObservationFunction
+>
+class ExtendedUpdatePolicy<
+          Linearization,
+          Additive<AdditiveObservationFunction>>
+    : public Descriptor,
+      public ExtendedKalmanCorrection<
+                 typename AdditiveObservationFunction::State,
+                 typename AdditiveObservationFunction::Obsrv>
+{
+public:
+    typedef typename AdditiveObservationFunction::State State;
+    typedef typename AdditiveObservationFunction::Obsrv Obsrv;
+
+    typedef Dual<Real, SizeOf<State>::Value> DualScalar;
+    typedef Eigen::Matrix<DualScalar, SizeOf<State>::Value, 1> DualState;
+    typedef Eigen::Matrix<DualScalar, SizeOf<Obsrv>::Value, 1> DualObsrv;
+
+    template <
+        typename Belief
+    >
+    void operator()(const AdditiveObservationFunction& obsrv_function,
+                    const Linearization& linearization,
+                    const Belief& prior_belief,
+                    const Obsrv& obsrv,
+                    Belief& posterior_belief)
+    {
+        linearize(obsrv_function, prior_belief);
+        this->cov_yy_ += obsrv_function.noise_covariance();
+        this->correct(prior_belief, obsrv, posterior_belief);
+    }
+
+    virtual std::string name() const
+    {
+        return "ExtendedUpdatePolicy<"
+                + this->list_arguments(
+                       "Linearization",
+                       "Additive<AdditiveObservationFunction>")
+                + ">";
+    }
+
+    virtual std::string description() const
+    {
+        return "Extended Kalman filter update policy for observation model "
+               "with additive noise";
+    }
+
+protected:
+    /** \cond internal */
+
+    /**
+     * \brief Linearizes the model at the mean of the \a prior_belief and
+     *        computes \f$H\Sigma H^T\f$ without the noise
+     */
+    template <typename Belief>
+    void linearize(const AdditiveObservationFunction& obsrv_function,
+                   const Belief& prior_belief)
+    {
+        const int dim = prior_belief.dimension();
+
+        dual_variables(prior_belief.mean(), 0, dim, dual_state_);
+        dual_obsrv_ = obsrv_function.expected_observation(dual_state_);
+
+        dual_value(dual_obsrv_, this->expected_obsrv_);
+        dual_jacobian(dual_obsrv_, 0, dim, this->jacobian_);
+
+        this->innovation_covariance(prior_belief);
+    }
+
+    DualState dual_state_;
+    DualObsrv dual_obsrv_;
+
+    /** \endcond */
+};
+
+/**
+ * \ingroup nonlinear_gaussian_filter
+ *
+ * \brief Extended Kalman filter update of observation models with additive
+ * noise of diagonal covariance \f$R\f$ which is added to the diagonal of
+ * \f$H\Sigma H^T\f$ only
+ */
+template <
+    typename Linearization,
+    typename AdditiveUncorrelatedObsrvFunction
+>
+class ExtendedUpdatePolicy<
+          Linearization,
+          AdditiveUncorrelated<AdditiveUncorrelatedObsrvFunction>>
+    : public ExtendedUpdatePolicy<
+                 Linearization,
+                 Additive<AdditiveUncorrelatedObsrvFunction>>
+{
+public:
+    typedef typename AdditiveUncorrelatedObsrvFunction::Obsrv Obsrv;
+
+    template <
+        typename Belief
+    >
+    void operator()(const AdditiveUncorrelatedObsrvFunction& obsrv_function,
+                    const Linearization& linearization,
+                    const Belief& prior_belief,
+                    const Obsrv& obsrv,
+                    Belief& posterior_belief)
+    {
+        this->linearize(obsrv_function, prior_belief);
+        this->cov_yy_.diagonal() +=
+            obsrv_function.noise_diagonal_covariance().diagonal();
+        this->correct(prior_belief, obsrv, posterior_belief);
+    }
+
+    virtual std::string name() const
+    {
+        return "ExtendedUpdatePolicy<"
+                + this->list_arguments(
+                       "Linearization",
+                       "AdditiveUncorrelated<"
+                       "AdditiveUncorrelatedObsrvFunction>")
+                + ">";
+    }
+
+    virtual std::string description() const
+    {
+        return "Extended Kalman filter update policy for observation model "
+               "with additive uncorrelated noise";
+    }
+};
+
+/**
+ * \ingroup nonlinear_gaussian_filter
+ *
+ * \brief Extended Kalman filter update of observation models with
+ * non-additive standard normal noise \f$y = h(x, w)\f$.
+ *
+ * The model is linearized at the predicted mean and the noise mean
+ * \f$w = 0\f$ by a single evaluation of \c observation() on Dual scalars
+ * which yields both Jacobians \f$H = \partial h / \partial x\f$ and
+ * \f$M = \partial h / \partial w\f$. The innovation covariance is
+ * \f$S = H\Sigma H^T + MM^T\f$.
+ */
+template <
+    typename Linearization,
+    typename ObservationFunction
+>
+class ExtendedUpdatePolicy<
+          Linearization,
+          NonAdditive<ObservationFunction>>
+    : public Descriptor,
+      public ExtendedKalmanCorrection<
+                 typename ObservationFunction::State,
+                 typename ObservationFunction::Obsrv>
+{
+public:
+    typedef typename ObservationFunction::State State;
+    typedef typename ObservationFunction::Obsrv Obsrv;
+    typedef typename ObservationFunction::Noise Noise;
+
+    enum : signed int
+    {
+        Directions = JoinSizes<
+                         SizeOf<State>::Value,
+                         SizeOf<Noise>::Value
+                     >::Size
+    };
+
+    typedef Dual<Real, Directions> DualScalar;
+    typedef Eigen::Matrix<DualScalar, SizeOf<State>::Value, 1> DualState;
+    typedef Eigen::Matrix<DualScalar, SizeOf<Noise>::Value, 1> DualNoise;
+    typedef Eigen::Matrix<DualScalar, SizeOf<Obsrv>::Value, 1> DualObsrv;
+
+    template <
+        typename Belief
+    >
+    void operator()(const ObservationFunction& obsrv_function,
+                    const Linearization& linearization,
+                    const Belief& prior_belief,
+                    const Obsrv& obsrv,
+                    Belief& posterior_belief)
+    {
+        const int dim = prior_belief.dimension();
+        const int noise_dim = obsrv_function.noise_dimension();
+
+        noise_mean_.setZero(noise_dim);
+
+        dual_variables(prior_belief.mean(), 0, dim + noise_dim, dual_state_);
+        dual_variables(noise_mean_, dim, dim + noise_dim, dual_noise_);
+        dual_obsrv_ = obsrv_function.observation(dual_state_, dual_noise_);
+
+        dual_value(dual_obsrv_, this->expected_obsrv_);
+        dual_jacobian(dual_obsrv_, 0, dim, this->jacobian_);
+        dual_jacobian(dual_obsrv_, dim, noise_dim, noise_jacobian_);
+
+        this->innovation_covariance(prior_belief);
+        this->cov_yy_.noalias() +=
+            noise_jacobian_ * noise_jacobian_.transpose();
+
+        this->correct(prior_belief, obsrv, posterior_belief);
+    }
+
+    virtual std::string name() const
+    {
+        return "ExtendedUpdatePolicy<"
+                + this->list_arguments(
+                       "Linearization",
+                       "NonAdditive<ObservationFunction>")
+                + ">";
+    }
+
+    virtual std::string description() const
+    {
+        return "Extended Kalman filter update policy for observation model "
+               "with non-additive noise";
+    }
+
+protected:
+    /** \cond internal */
+    typedef Eigen::Matrix<
+                Real, SizeOf<Obsrv>::Value, SizeOf<Noise>::Value
+            > NoiseJacobian;
+
+    DualState dual_state_;
+    DualNoise dual_noise_;
+    DualObsrv dual_obsrv_;
+    Noise noise_mean_;
+    NoiseJacobian noise_jacobian_;
+    /** \endcond */
+};
+
+/**
+ * \ingroup nonlinear_gaussian_filter
+ *
+ * \brief Linear observation models marked as Linear<Model> are updated in
+ * closed form as in the sigma point filters
+ */
+template <
+    typename Linearization,
+    typename LinearObservationFunction
+>
+class ExtendedUpdatePolicy<
+          Linearization,
+          Linear<LinearObservationFunction>>
+    : public SigmaPointUpdatePolicy<
+                Linearization,
+                Linear<LinearObservationFunction>>
+{ };
+
+/**
+ * \ingroup nonlinear_gaussian_filter
+ *
+ * \brief Conditionally linear observation models are linearized as any other
+ * model with additive noise
+ */
+template <
+    typename Linearization,
+    typename ConditionallyLinearObservationFunction
+>
+class ExtendedUpdatePolicy<
+          Linearization,
+          ConditionallyLinear<ConditionallyLinearObservationFunction>>
+    : public ExtendedUpdatePolicy<
+                Linearization,
+                Additive<ConditionallyLinearObservationFunction>>
+{ };
+
+}
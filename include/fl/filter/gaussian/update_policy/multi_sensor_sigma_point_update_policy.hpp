@@ -27,6 +27,7 @@
 #include <fl/util/traits.hpp>
 #include <fl/util/descriptor.hpp>
 #include <fl/model/observation/joint_observation_model_iid.hpp>
+#include <fl/model/observation/interface/observation_precomputation.hpp>
 #include <fl/filter/gaussian/transform/point_set.hpp>
 #include <fl/filter/gaussian/quadrature/sigma_point_quadrature.hpp>
 
@@ -90,6 +91,10 @@ class MultiSensorSigmaPointUpdatePolicy<
  *        This instance expects a \a NonAdditive<JointObservationModel<>>.
  *        The implementation exploits factorization in the joint observation.
  *        The update is performed for each sensor separately.
+ *
+ * If the local observation model provides the precomputation hook, see
+ * HasObservationPrecomputation, the state dependent part of the observation
+ * is computed once per sigma point and shared by all sensors.
  */
 template <
     typename SigmaPointQuadrature,
@@ -102,6 +107,7 @@ class MultiSensorSigmaPointUpdatePolicy<
 {
 public:
     typedef JointObservationModel<MultipleOfLocalObsrvModel> JointModel;
+    typedef typename JointModel::LocalModel LocalModel;
 
     typedef typename JointModel::State State;
     typedef typename JointModel::Obsrv Obsrv;
@@ -158,7 +164,9 @@ public:
         /* - Compute expected moments of the state  - */
         /* - E[X], Cov(X, X)                        - */
         /* ------------------------------------------ */
-        auto W = p_X.covariance_weights_vector().asDiagonal();
+        // keep the weights alive, asDiagonal() only refers to them
+        auto w_cov = p_X.covariance_weights_vector();
+        auto W = w_cov.asDiagonal();
         auto mu_x = p_X.mean();
         auto X = p_X.centered_points();
         auto c_xx_inv = (X * W * X.transpose()).inverse().eval();
@@ -174,13 +182,19 @@ public:
         const int sensor_count = obsrv_function.count_local_models();
         const int dim_y = y.size() / sensor_count;
 
+        /* ------------------------------------------ */
+        /* - Precompute the state dependent part of - */
+        /* - the observation once for all sensors   - */
+        /* ------------------------------------------ */
+        precomputation_.precompute(sensor_model, p_X);
+
         /* ------------------------------------------ */
         /* - lambda of the sensor observation       - */
-        /* - function                               - */
+        /* - function of the k-th point             - */
         /* ------------------------------------------ */
-        auto&& h = [&](const State& x, const LocalObsrvNoise& w)
+        auto&& h = [&](int k, const State& x, const LocalObsrvNoise& w)
         {
-            return sensor_model.observation(x, w);
+            return precomputation_.observation(sensor_model, k, x, w);
         };
 
 
@@ -191,7 +205,7 @@ public:
 
             // select current sensor and propagate the points through h(x, w)
             sensor_model.id(i);
-            quadrature.propagate_points(h, p_X, p_Q, p_Y);
+            quadrature.propagate_indexed_points(h, p_X, p_Q, p_Y);
 
             // comute expected moments of the observation and validate
             auto mu_y = p_Y.mean();
@@ -251,6 +265,8 @@ private:
 
         return true;
     }
+
+    ObservationPrecomputation<LocalModel> precomputation_;
 };
 
 }
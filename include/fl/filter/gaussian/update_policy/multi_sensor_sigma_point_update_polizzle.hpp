@@ -28,6 +28,7 @@
 #include <fl/util/traits.hpp>
 #include <fl/util/descriptor.hpp>
 #include <fl/model/observation/joint_observation_model_iid.hpp>
+#include <fl/model/observation/interface/observation_precomputation.hpp>
 #include <fl/filter/gaussian/transform/point_set.hpp>
 #include <fl/filter/gaussian/quadrature/sigma_point_quadrature.hpp>
 
@@ -98,7 +99,7 @@ public:
     typedef typename JointModel::Noise Noise;
 
     typedef typename Traits<JointModel>::LocalObsrv LocalFeature;
-    typedef Vector1d LocalObsrvNoise;
+    typedef typename JointModel::LocalNoise LocalObsrvNoise;
 
     template <typename Belief>
     void operator()(JointModel& obsrv_function,
@@ -145,7 +146,9 @@ public:
         auto mu_x = p_X.mean();
         auto X = p_X.centered_points();
 
-        auto W = p_X.covariance_weights_vector().asDiagonal();
+        // keep the weights alive, asDiagonal() only refers to them
+        auto w_cov = p_X.covariance_weights_vector();
+        auto W = w_cov.asDiagonal();
         auto c_xx = (X * W * X.transpose()).eval();
         auto c_xx_inv = c_xx.inverse().eval();
 
@@ -156,15 +159,26 @@ public:
         const int sensor_count = obsrv_function.count_local_models();
         const int dim_y = y.size() / sensor_count;
 
-        auto h_body = [&](const State& x,const typename BodyModel::Noise& w)
+        auto& body_model = body_tail_model.body_model();
+        auto& tail_model = body_tail_model.tail_model();
+
+        // the state dependent parts of body and tail are shared by all sensors
+        body_precomputation_.precompute(body_model, p_X);
+        tail_precomputation_.precompute(tail_model, p_X);
+
+        auto h_body = [&](int k, const State& x, const LocalObsrvNoise& w)
         {
+            const typename BodyModel::Noise w_body =
+                w.topRows(body_model.noise_dimension());
             return feature_model.feature_obsrv(
-                        body_tail_model.body_model().observation(x, w));
+                body_precomputation_.observation(body_model, k, x, w_body));
         };
-        auto h_tail = [&](const State& x,const typename TailModel::Noise& w)
+        auto h_tail = [&](int k, const State& x, const LocalObsrvNoise& w)
         {
+            const typename TailModel::Noise w_tail =
+                w.topRows(tail_model.noise_dimension());
             return feature_model.feature_obsrv(
-                        body_tail_model.tail_model().observation(x, w));
+                tail_precomputation_.observation(tail_model, k, x, w_tail));
         };
         PointSet<LocalFeature, NumberOfPoints> p_Y_body;
         PointSet<LocalFeature, NumberOfPoints> p_Y_tail;
@@ -180,7 +194,7 @@ public:
             /* - Integrate body                         - */
             /* ------------------------------------------ */
 
-            quadrature.propagate_points(h_body, p_X, p_R, p_Y_body);
+            quadrature.propagate_indexed_points(h_body, p_X, p_R, p_Y_body);
             auto mu_y_body = p_Y_body.mean();
 
             // validate sensor value, i.e. make sure it is finite
@@ -193,7 +207,7 @@ public:
             /* ------------------------------------------ */
             /* - Integrate tail                         - */
             /* ------------------------------------------ */
-            quadrature.propagate_points(h_tail, p_X, p_R, p_Y_tail);
+            quadrature.propagate_indexed_points(h_tail, p_X, p_R, p_Y_tail);
             auto mu_y_tail = p_Y_tail.mean();
             auto Y_tail = p_Y_tail.centered_points();
             auto c_yy_tail = (Y_tail * W * Y_tail.transpose()).eval();
@@ -261,6 +275,9 @@ private:
 
         return true;
     }
+
+    ObservationPrecomputation<BodyModel> body_precomputation_;
+    ObservationPrecomputation<TailModel> tail_precomputation_;
 };
 
 }
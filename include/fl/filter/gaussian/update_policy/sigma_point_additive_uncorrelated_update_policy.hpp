@@ -20,12 +20,16 @@
 #pragma once
 
 
+#include <cmath>
+
 #include <Eigen/Dense>
 
 #include <fl/util/meta.hpp>
 #include <fl/util/traits.hpp>
 #include <fl/util/descriptor.hpp>
+#include <fl/util/math/linear_algebra.hpp>
 #include <fl/filter/gaussian/transform/point_set.hpp>
+#include <fl/filter/gaussian/transform/point_set_moments.hpp>
 #include <fl/filter/gaussian/quadrature/sigma_point_quadrature.hpp>
 
 namespace fl
@@ -34,6 +38,28 @@ namespace fl
 // Forward declarations
 template <typename...> class SigmaPointUpdatePolicy;
 
+/**
+ * \ingroup nonlinear_gaussian_filter
+ *
+ * \brief Sigma point update for observation models with additive noise of
+ * diagonal covariance \f$R\f$.
+ *
+ * With \f$m\f$ observation dimensions, \f$n\f$ state dimensions and
+ * \f$p\f$ sigma points the update is computed in one of two equivalent
+ * forms:
+ *
+ *  - The innovation form factorizes the \f$m \times m\f$ innovation
+ *    covariance \f$S = Y_cWY_c^T + R\f$ at a cost of \f$O(m^3)\f$.
+ *  - The Woodbury form applies the matrix inversion lemma to \f$S\f$ and
+ *    factorizes the \f$p \times p\f$ matrix \f$I + WY_c^TR^{-1}Y_c\f$
+ *    instead. Since \f$R\f$ is diagonal, this costs \f$O(p^3 + mp^2)\f$ and
+ *    never forms a matrix of \f$m \times m\f$ elements.
+ *
+ * By default the form is selected on each update by comparing the leading
+ * flop counts of both forms, see innovation_form_cost() and
+ * woodbury_form_cost(). Hence, observations of varying dimension are
+ * processed in the cheaper form whichever dimension dominates.
+ */
 template <
     typename SigmaPointQuadrature,
     typename AdditiveUncorrelatedObsrvFunction
@@ -53,11 +79,25 @@ public:
             SigmaPointQuadrature::number_of_points(SizeOf<State>::Value)
     };
 
-    // static_assert(false, "Just implementing this ........");
-
     typedef PointSet<State, NumberOfPoints> StatePointSet;
     typedef PointSet<Obsrv, NumberOfPoints> ObsrvPointSet;
 
+    /**
+     * \brief Form in which the update is computed
+     */
+    enum UpdateForm
+    {
+        AutomaticForm,  /**< Cheaper form of the current dimensions */
+        InnovationForm, /**< Observation space form, \f$O(m^3)\f$ */
+        WoodburyForm    /**< Sigma point space form, \f$O(p^3 + mp^2)\f$ */
+    };
+
+public:
+    SigmaPointUpdatePolicy()
+        : update_form_(AutomaticForm),
+          woodbury_(false)
+    { }
+
     template <
         typename Belief
     >
@@ -74,34 +114,149 @@ public:
 
         quadrature.propergate_gaussian(h, prior_belief, X, Z);
 
-        auto R_inv =
-            obsrv_function
-                .noise_diagonal_covariance()
-                .diagonal()
-                .cwiseInverse()
-                .eval();
+        update(obsrv_function, X, Z, obsrv);
+        posterior(prior_belief, posterior_belief);
+    }
+
+    /**
+     * \brief Updates the belief represented by the given \a predicted_points,
+     *        e.g. the points of a preceding prediction, instead of points
+     *        generated from the \a predicted_belief. This saves the
+     *        factorization of the predicted covariance.
+     */
+    template <
+        typename PredictedPointSet,
+        typename Belief
+    >
+    void update_points(
+        const AdditiveUncorrelatedObsrvFunction& obsrv_function,
+        const SigmaPointQuadrature& quadrature,
+        const Belief& predicted_belief,
+        const PredictedPointSet& predicted_points,
+        const Obsrv& obsrv,
+        Belief& posterior_belief)
+    {
+        auto&& h = [&](const State& x)
+        {
+           return obsrv_function.expected_observation(x);
+        };
+
+        quadrature.propagate_points(
+            h, predicted_points, predicted_obsrv_points_);
 
-        auto W_inv =
-            X.covariance_weights_vector()
-                .cwiseInverse()
-                .eval();
+        update(
+            obsrv_function, predicted_points, predicted_obsrv_points_, obsrv);
+        posterior(predicted_belief, posterior_belief);
+    }
 
-        auto&& prediction = Z.center();
-        auto&& Y_c = Z.points();
-        auto&& X_c = X.centered_points();
+    /**
+     * \brief Sets the form of subsequent updates. The default AutomaticForm
+     *        selects the cheaper form on each update.
+     */
+    void update_form(UpdateForm form)
+    {
+        update_form_ = form;
+    }
 
-        auto innovation = (obsrv - prediction).eval();
+    /**
+     * \return Form of subsequent updates
+     */
+    UpdateForm update_form() const
+    {
+        return update_form_;
+    }
 
-        auto C = (Y_c.transpose() * R_inv.asDiagonal() * Y_c).eval();
-        C += W_inv.asDiagonal();
-        C = C.inverse();
+    /**
+     * \return Form in which an update of the given dimensions is computed
+     *
+     * \param state_dim     State dimension \f$n\f$
+     * \param obsrv_dim     Observation dimension \f$m\f$
+     * \param point_count   Number of sigma points \f$p\f$
+     */
+    UpdateForm select_form(int state_dim, int obsrv_dim, int point_count) const
+    {
+        if (update_form_ != AutomaticForm) return update_form_;
 
-        auto correction = (
-           X_c * C * Y_c.transpose() *  R_inv.asDiagonal() * innovation).eval();
+        return woodbury_form_cost(state_dim, obsrv_dim, point_count)
+                    < innovation_form_cost(state_dim, obsrv_dim, point_count)
+                ? WoodburyForm
+                : InnovationForm;
+    }
 
-        posterior_belief.dimension(prior_belief.dimension());
-        posterior_belief.mean(X.mean() + correction);
-        posterior_belief.covariance(X_c * C * X_c.transpose());
+    /**
+     * \return Leading flop count of the innovation form: the joint covariance
+     *         of the points, the Cholesky factor of \f$S\f$, the gain and the
+     *         covariance correction
+     */
+    static Real innovation_form_cost(int state_dim,
+                                     int obsrv_dim,
+                                     int point_count)
+    {
+        const Real n = state_dim;
+        const Real m = obsrv_dim;
+        const Real p = point_count;
+
+        return p * (n + m) * (n + m)
+               + m * m * m / Real(3)
+               + Real(2) * m * m * n
+               + Real(2) * m * n * n;
+    }
+
+    /**
+     * \return Leading flop count of the Woodbury form: the product
+     *         \f$WY_c^TR^{-1}Y_c\f$, its LU factor, the gain and the
+     *         covariance in sigma point space
+     */
+    static Real woodbury_form_cost(int state_dim,
+                                   int obsrv_dim,
+                                   int point_count)
+    {
+        const Real n = state_dim;
+        const Real m = obsrv_dim;
+        const Real p = point_count;
+
+        return Real(2) * m * p * (p + Real(1))
+               + Real(2) * p * p * p / Real(3)
+               + Real(2) * p * p * n
+               + Real(2) * p * n * n;
+    }
+
+    /**
+     * \return Log. likelihood \f$\log {\cal N}(y; \hat{y}, S)\f$ of the
+     *         observation of the last update under the predicted
+     *         observation moments. After an update in the Woodbury form
+     *         \f$S = R + Y_cWY_c^T\f$ is not available. Its inverse and
+     *         determinant follow from the matrix inversion and the matrix
+     *         determinant lemma by means of the factor of
+     *         \f$I + WY_c^TR^{-1}Y_c\f$ instead.
+     */
+    Real log_likelihood() const
+    {
+        if (!woodbury_)
+        {
+            return cov_yy_factor_.log_normal_density(innovation_);
+        }
+
+        // W Y_c^T R^-1 (y - y_mean)
+        const Eigen::Matrix<Real, Eigen::Dynamic, 1> weighted_innovation =
+            moments_.weighted_y().transpose()
+            * noise_variance_.cwiseInverse().asDiagonal()
+            * innovation_;
+
+        const Real quadratic_form =
+            innovation_.dot(noise_variance_.cwiseInverse().asDiagonal()
+                            * innovation_)
+            - point_innovation_.dot(
+                  point_matrix_lu_.solve(weighted_innovation));
+
+        const Real log_determinant =
+            noise_variance_.array().log().sum()
+            + point_matrix_lu_.matrixLU()
+                  .diagonal().array().abs().log().sum();
+
+        return -Real(0.5) * (quadratic_form
+                             + log_determinant
+                             + innovation_.size() * std::log(2.0 * M_PI));
     }
 
     virtual std::string name() const
@@ -120,8 +275,145 @@ public:
     }
 
 protected:
+    /** \cond internal */
+
+    template <typename PointSetX, typename PointSetZ>
+    void update(const AdditiveUncorrelatedObsrvFunction& obsrv_function,
+                const PointSetX& X,
+                const PointSetZ& Z,
+                const Obsrv& obsrv)
+    {
+        noise_variance_ = obsrv_function.noise_diagonal_covariance().diagonal();
+
+        const UpdateForm form = select_form(
+            X.dimension(), int(obsrv.size()), X.count_points());
+
+        // the Woodbury form requires R^-1 to exist
+        woodbury_ = form == WoodburyForm && noise_variance_.minCoeff() > 0;
+
+        if (woodbury_)
+        {
+            woodbury_update(X, Z, obsrv);
+        }
+        else
+        {
+            innovation_update(X, Z, obsrv);
+        }
+    }
+
+    template <typename Belief>
+    void posterior(const Belief& prior_belief, Belief& posterior_belief) const
+    {
+        // changing the dimension resets the belief which creates temporaries
+        if (posterior_belief.dimension() != prior_belief.dimension())
+        {
+            posterior_belief.dimension(prior_belief.dimension());
+        }
+
+        posterior_belief.mean(mean_);
+        posterior_belief.covariance(cov_);
+    }
+
+    /**
+     * \brief Posterior from the gain \f$K = \Sigma_{xy}S^{-1}\f$ using a
+     *        factorization of the innovation covariance \f$S\f$
+     */
+    template <typename PointSetX, typename PointSetZ>
+    void innovation_update(const PointSetX& X,
+                           const PointSetZ& Z,
+                           const Obsrv& obsrv)
+    {
+        moments_.compute(X, Z);
+
+        auto&& cov_xy = moments_.cov_xy();
+
+        innovation_ = obsrv;
+        innovation_ -= moments_.mean_y();
+
+        cov_yy_ = moments_.cov_yy();
+        cov_yy_.diagonal() += noise_variance_;
+
+        cov_yy_factor_.compute(cov_yy_);
+        gain_transpose_ = cov_xy.transpose();
+        cov_yy_factor_.solve_in_place(gain_transpose_);
+
+        mean_ = moments_.mean_x();
+        mean_.noalias() += gain_transpose_.transpose() * innovation_;
+
+        cov_ = moments_.cov_xx();
+        cov_.noalias() -= cov_xy * gain_transpose_;
+    }
+
+    /**
+     * \brief Posterior in sigma point space. By the matrix inversion lemma
+     *        the posterior covariance is \f$X_cCX_c^T\f$ and the mean
+     *        correction \f$X_cCY_c^TR^{-1}(y - \hat{y})\f$ with
+     *        \f$C = (I + WY_c^TR^{-1}Y_c)^{-1}W\f$. Unlike
+     *        \f$(W^{-1} + Y_c^TR^{-1}Y_c)^{-1}\f$ this does not require the
+     *        covariance weights to be invertible.
+     */
+    template <typename PointSetX, typename PointSetZ>
+    void woodbury_update(const PointSetX& X,
+                         const PointSetZ& Z,
+                         const Obsrv& obsrv)
+    {
+        moments_.center(X, Z);
+
+        innovation_ = obsrv;
+        innovation_ -= moments_.mean_y();
+
+        // R^-1 Y_c
+        scaled_obsrv_points_.noalias() =
+            noise_variance_.cwiseInverse().asDiagonal()
+            * moments_.centered_y();
+
+        // I + W Y_c^T R^-1 Y_c
+        point_matrix_.noalias() =
+            moments_.weighted_y().transpose() * scaled_obsrv_points_;
+        point_matrix_.diagonal().array() += Real(1);
+
+        // C X_c^T which is the transposed gain in sigma point space
+        point_matrix_lu_.compute(point_matrix_);
+        point_gain_ = point_matrix_lu_.solve(moments_.weighted_x().transpose());
+
+        point_innovation_.noalias() =
+            scaled_obsrv_points_.transpose() * innovation_;
+
+        mean_ = moments_.mean_x();
+        mean_.noalias() += point_gain_.transpose() * point_innovation_;
+
+        cov_.noalias() = moments_.centered_x() * point_gain_;
+    }
+
+    typedef typename SecondMomentOf<Obsrv>::Type ObsrvCovariance;
+    // dynamic in the number of points which differs for reused points
+    typedef Eigen::Matrix<Real, Eigen::Dynamic, Eigen::Dynamic> PointMatrix;
+
     StatePointSet X;
     ObsrvPointSet Z;
+    PointSet<Obsrv, Eigen::Dynamic> predicted_obsrv_points_;
+    PointSetMoments moments_;
+    UpdateForm update_form_;
+    bool woodbury_;
+
+    State mean_;
+    Obsrv innovation_;
+    Obsrv noise_variance_;
+    typename SecondMomentOf<State>::Type cov_;
+
+    ObsrvCovariance cov_yy_;
+    Eigen::Matrix<Real, SizeOf<Obsrv>::Value, SizeOf<State>::Value>
+        gain_transpose_;
+    SymmetricFactorization<ObsrvCovariance> cov_yy_factor_;
+
+    Eigen::Matrix<Real, SizeOf<Obsrv>::Value, Eigen::Dynamic>
+        scaled_obsrv_points_;
+    PointMatrix point_matrix_;
+    Eigen::PartialPivLU<PointMatrix> point_matrix_lu_;
+    Eigen::Matrix<Real, Eigen::Dynamic, SizeOf<State>::Value> point_gain_;
+    Eigen::Matrix<Real, Eigen::Dynamic, 1> point_innovation_;
+
+    /** \endcond */
 };
 
 }
@@ -25,7 +25,9 @@
 #include <fl/util/meta.hpp>
 #include <fl/util/traits.hpp>
 #include <fl/util/descriptor.hpp>
+#include <fl/util/math/linear_algebra.hpp>
 #include <fl/filter/gaussian/transform/point_set.hpp>
+#include <fl/filter/gaussian/transform/point_set_moments.hpp>
 #include <fl/filter/gaussian/quadrature/sigma_point_quadrature.hpp>
 
 namespace fl
@@ -72,21 +74,48 @@ public:
 
         quadrature.propergate_gaussian(h, prior_belief, X, Z);
 
-        auto&& prediction = Z.center();
-        auto&& Z_c = Z.points();
-        auto&& W = X.covariance_weights_vector();
-        auto&& X_c = X.centered_points();
-
-        auto innovation = (obsrv - prediction).eval();
-        auto cov_xx = (X_c * W.asDiagonal() * X_c.transpose()).eval();
-        auto cov_yy = (Z_c * W.asDiagonal() * Z_c.transpose()
-                       + obsrv_function.noise_covariance()).eval();
-        auto cov_xy = (X_c * W.asDiagonal() * Z_c.transpose()).eval();
-        auto K = (cov_xy * cov_yy.inverse()).eval();
-
-        posterior_belief.dimension(prior_belief.dimension());
-        posterior_belief.mean(X.mean() + K * innovation);
-        posterior_belief.covariance(cov_xx - K * cov_yy * K.transpose());
+        update(obsrv_function, X, Z, obsrv);
+        posterior(prior_belief, posterior_belief);
+    }
+
+    /**
+     * \brief Updates the belief represented by the given \a predicted_points,
+     *        e.g. the points of a preceding prediction, instead of points
+     *        generated from the \a predicted_belief. This saves the
+     *        factorization of the predicted covariance.
+     */
+    template <
+        typename PredictedPointSet,
+        typename Belief
+    >
+    void update_points(const AdditiveObservationFunction& obsrv_function,
+                       const SigmaPointQuadrature& quadrature,
+                       const Belief& predicted_belief,
+                       const PredictedPointSet& predicted_points,
+                       const Obsrv& obsrv,
+                       Belief& posterior_belief)
+    {
+        auto&& h = [&](const State& x)
+        {
+           return obsrv_function.expected_observation(x);
+        };
+
+        quadrature.propagate_points(
+            h, predicted_points, predicted_obsrv_points_);
+
+        update(
+            obsrv_function, predicted_points, predicted_obsrv_points_, obsrv);
+        posterior(predicted_belief, posterior_belief);
+    }
+
+    /**
+     * \return Log. likelihood \f$\log {\cal N}(y; \hat{y}, S)\f$ of the
+     *         observation of the last update under the predicted
+     *         observation moments
+     */
+    Real log_likelihood() const
+    {
+        return cov_yy_factor_.log_normal_density(innovation_);
     }
 
     virtual std::string name() const
@@ -105,8 +134,69 @@ public:
     }
 
 protected:
+    /** \cond internal */
+
+    template <typename PointSetX, typename PointSetZ>
+    void update(const AdditiveObservationFunction& obsrv_function,
+                const PointSetX& X,
+                const PointSetZ& Z,
+                const Obsrv& obsrv)
+    {
+        moments_.compute(X, Z);
+
+        auto&& cov_xy = moments_.cov_xy();
+
+        innovation_ = obsrv;
+        innovation_ -= moments_.mean_y();
+
+        cov_yy_ = moments_.cov_yy();
+        cov_yy_ += obsrv_function.noise_covariance();
+
+        /*
+         * The gain K = C_xy C_yy^-1 is obtained in its transposed form
+         * K^T = C_yy^-1 C_yx from a single factorization of C_yy. With this
+         * the covariance correction K C_yy K^T reduces to C_xy K^T.
+         */
+        cov_yy_factor_.compute(cov_yy_);
+        gain_transpose_ = cov_xy.transpose();
+        cov_yy_factor_.solve_in_place(gain_transpose_);
+
+        mean_ = moments_.mean_x();
+        mean_.noalias() += gain_transpose_.transpose() * innovation_;
+
+        cov_ = moments_.cov_xx();
+        cov_.noalias() -= cov_xy * gain_transpose_;
+    }
+
+    template <typename Belief>
+    void posterior(const Belief& prior_belief, Belief& posterior_belief) const
+    {
+        // changing the dimension resets the belief which creates temporaries
+        if (posterior_belief.dimension() != prior_belief.dimension())
+        {
+            posterior_belief.dimension(prior_belief.dimension());
+        }
+
+        posterior_belief.mean(mean_);
+        posterior_belief.covariance(cov_);
+    }
+
     StatePointSet X;
     ObsrvPointSet Z;
+    PointSet<Obsrv, Eigen::Dynamic> predicted_obsrv_points_;
+    PointSetMoments moments_;
+
+    typedef typename SecondMomentOf<Obsrv>::Type ObsrvCovariance;
+
+    State mean_;
+    Obsrv innovation_;
+    typename SecondMomentOf<State>::Type cov_;
+    ObsrvCovariance cov_yy_;
+    Eigen::Matrix<Real, SizeOf<Obsrv>::Value, SizeOf<State>::Value>
+        gain_transpose_;
+    SymmetricFactorization<ObsrvCovariance> cov_yy_factor_;
+
+    /** \endcond */
 };
 
 }
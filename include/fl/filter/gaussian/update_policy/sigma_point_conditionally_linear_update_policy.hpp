@@ -0,0 +1,228 @@
+/*
+ * This is part of the fl library, a C++ Bayesian filtering library
+ * (https://github.com/filtering-library)
+ *
+ * Copyright (c) 2015 Max Planck Society,
+ * 				 Autonomous Motion Department,
+ * 			     Institute for Intelligent Systems
+ *
+ * This Source Code Form is subject to the terms of the MIT License (MIT).
+ * A copy of the license can be found in the LICENSE file distributed with this
+ * source code.
+ */
+
+/**
+ * \file sigma_point_conditionally_linear_update_policy.hpp
+ * \date October 2026
+ * \author agent (agent@local)
+ */
+
+#pragma once
+
+
+#include <Eigen/Dense>
+
+#include <fl/util/meta.hpp>
+#include <fl/util/traits.hpp>
+#include <fl/util/descriptor.hpp>
+#include <fl/util/math/linear_algebra.hpp>
+#include <fl/filter/gaussian/transform/point_set.hpp>
+#include <fl/filter/gaussian/transform/point_set_moments.hpp>
+#include <fl/filter/gaussian/transform/rao_blackwellized_point_set.hpp>
+#include <fl/filter/gaussian/quadrature/sigma_point_quadrature.hpp>
+
+namespace fl
+{
+
+// Forward declarations
+template <typename...> class SigmaPointUpdatePolicy;
+
+/**
+ * \ingroup nonlinear_gaussian_filter
+ *
+ * \brief Rao-Blackwellized sigma point update of observation models which
+ * are linear in a substate, see ConditionallyLinearObservationFunction.
+ *
+ * The quadrature is applied to the nonlinear substate \f$x_n\f$ only, see
+ * RaoBlackwellizedPointSet. Given the points \f$X_i\f$ and
+ * \f$C_i = C(X_i)\f$ the moments of the points are completed by the
+ * closed form contributions of the linear substate
+ *
+ * \f$ \Sigma_{yy} = \Sigma_{yy}^{X} + \sum_i w_i C_i\Sigma_{l|n}C_i^T + R,
+ *     \quad
+ *     \Sigma_{x_ly} = \Sigma_{x_ly}^{X} + \Sigma_{l|n}\sum_i w_i C_i^T \f$
+ *
+ * which are then used in the regular Kalman update. The number of points
+ * and model evaluations scales with \f$\dim(x_n)\f$ instead of the full
+ * state dimension. The policy is selected for all models derived from
+ * ConditionallyLinearObservationFunction, see IsConditionallyLinear.
+ * Models explicitly marked as Additive are updated by means of the full
+ * state quadrature.
+ */
+template <
+    typename SigmaPointQuadrature,
+    typename ConditionallyLinearObservationFunction
+>
+class SigmaPointUpdatePolicy<
+          SigmaPointQuadrature,
+          ConditionallyLinear<ConditionallyLinearObservationFunction>>
+    : public Descriptor
+{
+public:
+    typedef typename ConditionallyLinearObservationFunction::State State;
+    typedef typename ConditionallyLinearObservationFunction::Obsrv Obsrv;
+
+    template <
+        typename Belief
+    >
+    void operator()(const ConditionallyLinearObservationFunction&
+                              obsrv_function,
+                    const SigmaPointQuadrature& quadrature,
+                    const Belief& prior_belief,
+                    const Obsrv& obsrv,
+                    Belief& posterior_belief)
+    {
+        auto h = [&](const State& x)
+        {
+           return obsrv_function.expected_observation(x);
+        };
+
+        X.compute(quadrature,
+                  prior_belief,
+                  obsrv_function.nonlinear_dimension());
+
+        auto&& points = X.points();
+        auto&& conditional_cov = X.conditional_covariance();
+        const int linear_dim = X.linear_dimension();
+        const int dim = prior_belief.dimension();
+
+        quadrature.propagate_points(h, points, Z);
+
+        moments_.compute(points, Z);
+
+        cov_yy_ = moments_.cov_yy();
+        cov_xy_ = moments_.cov_xy();
+        cov_ = moments_.cov_xx();
+        cov_.bottomRightCorner(linear_dim, linear_dim) += conditional_cov;
+
+        // expected contributions of the linear substate given the points
+        mean_linear_matrix_.setZero(obsrv.rows(), linear_dim);
+        for (int i = 0; i < points.count_points(); ++i)
+        {
+            const Real w = points.weights(i).w_mean;
+
+            state_ = points.points().col(i);
+            linear_matrix_ = obsrv_function.linear_matrix(state_);
+            linear_cov_.noalias() = linear_matrix_ * conditional_cov;
+            cov_yy_.noalias() += w * linear_cov_ * linear_matrix_.transpose();
+            mean_linear_matrix_ += w * linear_matrix_;
+        }
+
+        cov_xy_.bottomRows(linear_dim).noalias() +=
+            conditional_cov * mean_linear_matrix_.transpose();
+
+        cov_yy_ += obsrv_function.noise_covariance();
+
+        /*
+         * The gain is obtained in its transposed form K^T = C_yy^-1 C_yx as
+         * in the additive update policy
+         */
+        cov_yy_factor_.compute(cov_yy_);
+        gain_transpose_ = cov_xy_.transpose();
+        cov_yy_factor_.solve_in_place(gain_transpose_);
+
+        innovation_ = obsrv;
+        innovation_ -= moments_.mean_y();
+
+        mean_ = moments_.mean_x();
+        mean_.noalias() += gain_transpose_.transpose() * innovation_;
+
+        cov_.noalias() -= cov_xy_ * gain_transpose_;
+
+        // changing the dimension resets the belief which creates temporaries
+        if (posterior_belief.dimension() != dim)
+        {
+            posterior_belief.dimension(dim);
+        }
+
+        posterior_belief.mean(mean_);
+        posterior_belief.covariance(cov_);
+    }
+
+    /**
+     * \brief Counterpart of the point reusing update of the additive
+     *        policies. The points of the nonlinear substate are generated
+     *        from the \a predicted_belief, hence, the predicted points are
+     *        not used.
+     */
+    template <
+        typename PredictedPointSet,
+        typename Belief
+    >
+    void update_points(const ConditionallyLinearObservationFunction&
+                           obsrv_function,
+                       const SigmaPointQuadrature& quadrature,
+                       const Belief& predicted_belief,
+                       const PredictedPointSet& predicted_points,
+                       const Obsrv& obsrv,
+                       Belief& posterior_belief)
+    {
+        (*this)(obsrv_function,
+                quadrature,
+                predicted_belief,
+                obsrv,
+                posterior_belief);
+    }
+
+    /**
+     * \return Log. likelihood \f$\log {\cal N}(y; \hat{y}, S)\f$ of the
+     *         observation of the last update under the predicted
+     *         observation moments
+     */
+    Real log_likelihood() const
+    {
+        return cov_yy_factor_.log_normal_density(innovation_);
+    }
+
+    virtual std::string name() const
+    {
+        return "SigmaPointUpdatePolicy<"
+                + this->list_arguments(
+                       "SigmaPointQuadrature",
+                       "ConditionallyLinear<"
+                       "ConditionallyLinearObservationFunction>")
+                + ">";
+    }
+
+    virtual std::string description() const
+    {
+        return "Rao-Blackwellized sigma point update policy for "
+               "conditionally linear observation models";
+    }
+
+protected:
+    /** \cond internal */
+    typedef typename SecondMomentOf<Obsrv>::Type ObsrvCovariance;
+    typedef typename ConditionallyLinearObservationFunction
+                ::LinearMatrix LinearMatrix;
+
+    RaoBlackwellizedPointSet<State> X;
+    PointSet<Obsrv, Eigen::Dynamic> Z;
+    PointSetMoments moments_;
+
+    State state_;
+    State mean_;
+    Obsrv innovation_;
+    typename SecondMomentOf<State>::Type cov_;
+    ObsrvCovariance cov_yy_;
+    LinearMatrix linear_matrix_;
+    LinearMatrix linear_cov_;
+    LinearMatrix mean_linear_matrix_;
+    Eigen::Matrix<Real, SizeOf<State>::Value, SizeOf<Obsrv>::Value> cov_xy_;
+    Eigen::Matrix<Real, SizeOf<Obsrv>::Value, SizeOf<State>::Value>
+        gain_transpose_;
+    SymmetricFactorization<ObsrvCovariance> cov_yy_factor_;
+    /** \endcond */
+};
+
+}
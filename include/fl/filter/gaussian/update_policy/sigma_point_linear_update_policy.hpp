@@ -0,0 +1,170 @@
+/*
+ * This is part of the fl library, a C++ Bayesian filtering library
+ * (https://github.com/filtering-library)
+ *
+ * Copyright (c) 2015 Max Planck Society,
+ * 				 Autonomous Motion Department,
+ * 			     Institute for Intelligent Systems
+ *
+ * This Source Code Form is subject to the terms of the MIT License (MIT).
+ * A copy of the license can be found in the LICENSE file distributed with this
+ * source code.
+ */
+
+/**
+ * \file sigma_point_linear_update_policy.hpp
+ * \date October 2026
+ * \author agent (agent@local)
+ */
+
+#pragma once
+
+
+#include <Eigen/Dense>
+
+#include <fl/util/meta.hpp>
+#include <fl/util/traits.hpp>
+#include <fl/util/descriptor.hpp>
+#include <fl/util/math/linear_algebra.hpp>
+#include <fl/filter/gaussian/quadrature/sigma_point_quadrature.hpp>
+
+namespace fl
+{
+
+// Forward declarations
+template <typename...> class SigmaPointUpdatePolicy;
+
+/**
+ * \ingroup nonlinear_gaussian_filter
+ *
+ * \brief Update policy of linear observation models within a sigma point
+ * GaussianFilter.
+ *
+ * For \f$y = Hx + w\f$ the moments of the sigma points are the exact moments
+ * \f$\Sigma_{yy} = H\Sigma H^T + R\f$ and \f$\Sigma_{xy} = \Sigma H^T\f$ of
+ * the Kalman filter update which is therefore evaluated in closed form
+ * instead. The policy is selected for linear models marked as
+ * Linear<Model>, see IsLinear and LinearityOf. Unmarked linear models are
+ * updated by means of the quadrature.
+ */
+template <
+    typename SigmaPointQuadrature,
+    typename LinearObservationFunction
+>
+class SigmaPointUpdatePolicy<
+          SigmaPointQuadrature,
+          Linear<LinearObservationFunction>>
+    : public Descriptor
+{
+public:
+    typedef typename LinearObservationFunction::State State;
+    typedef typename LinearObservationFunction::Obsrv Obsrv;
+
+    template <
+        typename Belief
+    >
+    void operator()(const LinearObservationFunction& obsrv_function,
+                    const SigmaPointQuadrature& quadrature,
+                    const Belief& prior_belief,
+                    const Obsrv& obsrv,
+                    Belief& posterior_belief)
+    {
+        auto&& H = obsrv_function.sensor_matrix();
+        auto&& R = obsrv_function.noise_density().covariance();
+
+        auto&& mean = prior_belief.mean();
+        auto&& cov_xx = prior_belief.covariance();
+
+        obsrv_state_cov_.noalias() = H * cov_xx;
+        cov_yy_.noalias() = obsrv_state_cov_ * H.transpose();
+        cov_yy_ += R;
+
+        cov_yy_factor_.compute(cov_yy_);
+        gain_transpose_ = obsrv_state_cov_;
+        cov_yy_factor_.solve_in_place(gain_transpose_);
+
+        innovation_ = obsrv;
+        innovation_.noalias() -= H * mean;
+
+        mean_ = mean;
+        mean_.noalias() += gain_transpose_.transpose() * innovation_;
+
+        cov_ = cov_xx;
+        cov_.noalias() -= gain_transpose_.transpose() * obsrv_state_cov_;
+
+        // changing the dimension resets the belief which creates temporaries
+        if (posterior_belief.dimension() != prior_belief.dimension())
+        {
+            posterior_belief.dimension(prior_belief.dimension());
+        }
+
+        posterior_belief.mean(mean_);
+        posterior_belief.covariance(cov_);
+    }
+
+    /**
+     * \brief Counterpart of the point reusing update of the additive
+     *        policies. The closed form update is exact given the moments of
+     *        the \a predicted_belief, hence, the points are not needed.
+     */
+    template <
+        typename PredictedPointSet,
+        typename Belief
+    >
+    void update_points(const LinearObservationFunction& obsrv_function,
+                       const SigmaPointQuadrature& quadrature,
+                       const Belief& predicted_belief,
+                       const PredictedPointSet& predicted_points,
+                       const Obsrv& obsrv,
+                       Belief& posterior_belief)
+    {
+        (*this)(obsrv_function,
+                quadrature,
+                predicted_belief,
+                obsrv,
+                posterior_belief);
+    }
+
+    /**
+     * \return Log. likelihood \f$\log {\cal N}(y; \hat{y}, S)\f$ of the
+     *         observation of the last update under the predicted
+     *         observation moments
+     */
+    Real log_likelihood() const
+    {
+        return cov_yy_factor_.log_normal_density(innovation_);
+    }
+
+    virtual std::string name() const
+    {
+        return "SigmaPointUpdatePolicy<"
+                + this->list_arguments(
+                       "SigmaPointQuadrature",
+                       "Linear<LinearObservationFunction>")
+                + ">";
+    }
+
+    virtual std::string description() const
+    {
+        return "Closed form update policy for linear observation models "
+               "within a sigma point based filter";
+    }
+
+protected:
+    /** \cond internal */
+    typedef typename SecondMomentOf<Obsrv>::Type ObsrvCovariance;
+    typedef Eigen::Matrix<
+                Real, SizeOf<Obsrv>::Value, SizeOf<State>::Value
+            > ObsrvStateMatrix;
+
+    State mean_;
+    Obsrv innovation_;
+    typename SecondMomentOf<State>::Type cov_;
+    ObsrvCovariance cov_yy_;
+    ObsrvStateMatrix obsrv_state_cov_;
+    ObsrvStateMatrix gain_transpose_;
+    SymmetricFactorization<ObsrvCovariance> cov_yy_factor_;
+    /** \endcond */
+};
+
+}
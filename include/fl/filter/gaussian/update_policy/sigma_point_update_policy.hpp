@@ -25,7 +25,10 @@
 #include <fl/util/meta.hpp>
 #include <fl/util/traits.hpp>
 #include <fl/util/descriptor.hpp>
+#include <fl/util/math/linear_algebra.hpp>
+#include <fl/model/observation/interface/observation_function.hpp>
 #include <fl/filter/gaussian/transform/point_set.hpp>
+#include <fl/filter/gaussian/transform/point_set_moments.hpp>
 #include <fl/filter/gaussian/quadrature/sigma_point_quadrature.hpp>
 
 namespace fl
@@ -62,6 +65,12 @@ public:
     typedef typename ObservationFunction::Obsrv Obsrv;
     typedef typename ObservationFunction::Noise Noise;
 
+    /**
+     * \brief Point matrices holding one variate per column
+     */
+    typedef Eigen::Matrix<Real, SizeOf<State>::Value, Eigen::Dynamic> States;
+    typedef Eigen::Matrix<Real, SizeOf<Noise>::Value, Eigen::Dynamic> Noises;
+
     enum : signed int
     {
         NumberOfPoints = SigmaPointQuadrature::number_of_points(
@@ -88,34 +97,82 @@ public:
 
         noise_distr_.dimension(obsrv_function.noise_dimension());
 
-        auto&& h = [&](const State& x, const Noise& w)
+        // all points are passed to the model at once
+        auto&& h = [&](const Eigen::Ref<const States>& x,
+                       const Eigen::Ref<const Noises>& w)
         {
-           return obsrv_function.observation(x, w);
+           return batch_observations(obsrv_function, x, w);
         };
 
-        quadrature.propergate_gaussian(h, prior_belief, noise_distr_, X, Y, Z);
+        quadrature.transform_to_points(prior_belief, noise_distr_, X, Y);
+        quadrature.propagate_point_matrices(h, X, Y, Z);
+
+        moments_.compute(X, Z);
+
+        auto&& cov_xy = moments_.cov_xy();
+
+        innovation_ = obsrv;
+        innovation_ -= moments_.mean_y();
 
-        auto&& prediction = Z.center();
-        auto&& Z_c = Z.points();
-        auto&& W = X.covariance_weights_vector();
-        auto&& X_c = X.centered_points();
+        /*
+         * C_yy is factorized once. The factor yields the transposed gain
+         * K^T = C_yy^-1 C_yx which serves both, the mean correction
+         * K (y - mu_y) and the covariance correction
+         * C_xy C_yy^-1 C_yx = C_xy K^T.
+         */
+        cov_yy_factor_.compute(moments_.cov_yy());
+        gain_transpose_ = cov_xy.transpose();
+        cov_yy_factor_.solve_in_place(gain_transpose_);
 
-        auto innovation = (obsrv - prediction).eval();
-        auto cov_xx = (X_c * W.asDiagonal() * X_c.transpose()).eval();
-        auto cov_yy = (Z_c * W.asDiagonal() * Z_c.transpose()).eval();
-        auto cov_xy = (X_c * W.asDiagonal() * Z_c.transpose()).eval();
-        auto cov_yx = cov_xy.transpose().eval();
+        mean_ = moments_.mean_x();
+        mean_.noalias() += gain_transpose_.transpose() * innovation_;
+
+        cov_ = moments_.cov_xx();
+        cov_.noalias() -= cov_xy * gain_transpose_;
+
+        // changing the dimension resets the belief which creates temporaries
+        if (posterior_belief.dimension() != prior_belief.dimension())
+        {
+            posterior_belief.dimension(prior_belief.dimension());
+        }
 
-        auto x_updated = (X.mean() + cov_xy * solve(cov_yy, innovation)).eval();
-        auto cov_xx_updated = (cov_xx - cov_xy * solve(cov_yy, cov_yx)).eval();
+        posterior_belief.mean(mean_);
+        posterior_belief.covariance(cov_);
+    }
 
-        posterior_belief.dimension(prior_belief.dimension());
-        posterior_belief.mean(x_updated);
-        posterior_belief.covariance(cov_xx_updated);
+    /**
+     * \brief Counterpart of the point reusing update of the additive
+     *        policies. The observation noise enters the model non-additively
+     *        and requires points of the joint state and noise. These cannot
+     *        be formed from the \a predicted_points, hence, the points are
+     *        regenerated from the \a predicted_belief.
+     */
+    template <
+        typename PredictedPointSet,
+        typename Belief
+    >
+    void update_points(const ObservationFunction& obsrv_function,
+                       const SigmaPointQuadrature& quadrature,
+                       const Belief& predicted_belief,
+                       const PredictedPointSet& predicted_points,
+                       const Obsrv& obsrv,
+                       Belief& posterior_belief)
+    {
+        (*this)(obsrv_function,
+                quadrature,
+                predicted_belief,
+                obsrv,
+                posterior_belief);
+    }
 
-        //        auto K = (cov_xy * cov_yy.inverse()).eval();
-        //        posterior_belief.mean(X.mean() + K * innovation);
-        //        posterior_belief.covariance(cov_xx - K * cov_yy * K.transpose());
+    /**
+     * \return Log. likelihood \f$\log {\cal N}(y; \hat{y}, S)\f$ of the
+     *         observation of the last update under the predicted
+     *         observation moments
+     */
+    Real log_likelihood() const
+    {
+        return cov_yy_factor_.log_normal_density(innovation_);
     }
 
     virtual std::string name() const
@@ -139,6 +196,15 @@ protected:
     NoisePointSet Y;
     ObsrvPointSet Z;
     Gaussian<Noise> noise_distr_;
+    PointSetMoments moments_;
+
+    State mean_;
+    Obsrv innovation_;
+    typename SecondMomentOf<State>::Type cov_;
+    Eigen::Matrix<Real, SizeOf<Obsrv>::Value, SizeOf<State>::Value>
+        gain_transpose_;
+    SymmetricFactorization<typename SecondMomentOf<Obsrv>::Type>
+        cov_yy_factor_;
 };
 
 }
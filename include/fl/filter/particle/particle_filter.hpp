@@ -22,7 +22,9 @@
 #include <fl/util/traits.hpp>
 #include <fl/filter/filter_interface.hpp>
 #include <fl/distribution/discrete_distribution.hpp>
+#include <fl/distribution/sampling_policy.hpp>
 #include <fl/distribution/standard_gaussian.hpp>
+#include <fl/model/process/interface/state_transition_function.hpp>
 
 namespace fl
 {
@@ -43,9 +45,12 @@ template <typename...> class ParticleFilter;
  */
 template <
     typename StateTransitionFunction,
-    typename ObservationDensity
+    typename ObservationDensity,
+    typename NoiseSamplingPolicy
 >
-struct Traits<ParticleFilter<StateTransitionFunction, ObservationDensity>>
+struct Traits<
+           ParticleFilter<
+               StateTransitionFunction, ObservationDensity, NoiseSamplingPolicy>>
 {
     typedef typename StateTransitionFunction::State State;
     typedef typename StateTransitionFunction::Input Input;
@@ -53,18 +58,49 @@ struct Traits<ParticleFilter<StateTransitionFunction, ObservationDensity>>
     typedef DiscreteDistribution<State>             Belief;
 };
 
+/**
+ * \internal
+ * \ingroup particle_filter
+ *
+ * ParticleFilter Traits
+ */
+template <
+    typename StateTransitionFunction,
+    typename ObservationDensity
+>
+struct Traits<ParticleFilter<StateTransitionFunction, ObservationDensity>>
+    : Traits<
+          ParticleFilter<
+              StateTransitionFunction, ObservationDensity, IidSamplingPolicy>>
+{ };
+
 /**
  * \ingroup particle_filter
  *
  * \brief Represents the general particle filter
+ *
+ * The process noise of all particles is drawn at once according to the
+ * \c NoiseSamplingPolicy (see \ref sampling_policy). Antithetic or Latin
+ * hypercube noise sampling reduces the variance of the predicted particle
+ * set which allows for fewer particles, hence, fewer calls of the process
+ * and observation models at the same accuracy.
+ *
+ * \tparam StateTransitionFunction  Process model
+ * \tparam ObservationDensity       Observation model
+ * \tparam NoiseSamplingPolicy      Process noise sampling policy
  */
 template<
     typename StateTransitionFunction,
-    typename ObservationDensity
+    typename ObservationDensity,
+    typename NoiseSamplingPolicy
 >
-class ParticleFilter<StateTransitionFunction, ObservationDensity>
+class ParticleFilter<
+          StateTransitionFunction, ObservationDensity, NoiseSamplingPolicy>
     : public FilterInterface<
-                 ParticleFilter<StateTransitionFunction, ObservationDensity>>
+                 ParticleFilter<
+                     StateTransitionFunction,
+                     ObservationDensity,
+                     NoiseSamplingPolicy>>
 {
 private:
     /** \cond internal */
@@ -101,13 +137,26 @@ public:
                          const Input& input,
                          Belief& predicted_belief)
     {
+        const int particle_count = prior_belief.size();
+
+        particles_.resize(process_model_.state_dimension(), particle_count);
+        for(int i = 0; i < particle_count; i++)
+        {
+            particles_.col(i) = prior_belief.location(i);
+        }
+
+        noise_samples_.resize(process_model_.noise_dimension(),
+                              particle_count);
+        NoiseSamplingPolicy::fill(process_noise_, noise_samples_);
+
+        // propagate all particles at once using the batch model interface
+        particles_ =
+            batch_states(process_model_, particles_, noise_samples_, input);
+
         predicted_belief = prior_belief;
-        for(int i = 0; i < predicted_belief.size(); i++)
+        for(int i = 0; i < particle_count; i++)
         {
-            predicted_belief.location(i) =
-                    process_model_.state(prior_belief.location(i),
-                                         process_noise_.sample(),
-                                         input);
+            predicted_belief.location(i) = particles_.col(i);
         }
     }
 
@@ -196,6 +245,18 @@ protected:
     StandardGaussian<StateNoise> process_noise_;
     StandardGaussian<ObsrvNoise> obsrv_noise_;
 
+    /**
+     * \brief Particle locations, one per column
+     */
+    Eigen::Matrix<Real, SizeOf<State>::Value, Eigen::Dynamic> particles_;
+
+    /**
+     * \brief Process noise samples of all particles, one per column
+     */
+    Eigen::Matrix<
+        Real, SizeOf<StateNoise>::Value, Eigen::Dynamic
+    > noise_samples_;
+
     /**
      * when the KL divergence KL(p||u), where p is the particle distribution
      * and u is the uniform distribution, exceeds max_kl_divergence_, then there
@@ -205,4 +266,28 @@ protected:
     fl::Real max_kl_divergence_;
 };
 
+/**
+ * \ingroup particle_filter
+ *
+ * \brief Particle filter with independently sampled process noise
+ */
+template<
+    typename StateTransitionFunction,
+    typename ObservationDensity
+>
+class ParticleFilter<StateTransitionFunction, ObservationDensity>
+    : public ParticleFilter<
+                 StateTransitionFunction, ObservationDensity, IidSamplingPolicy>
+{
+public:
+    ParticleFilter(const StateTransitionFunction& process_model,
+                   const ObservationDensity& obsrv_model,
+                   const Real& max_kl_divergence = 1.0)
+        : ParticleFilter<
+              StateTransitionFunction,
+              ObservationDensity,
+              IidSamplingPolicy>(process_model, obsrv_model, max_kl_divergence)
+    { }
+};
+
 }
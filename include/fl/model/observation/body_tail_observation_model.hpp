@@ -141,6 +141,10 @@ public:
      */
     typedef typename Traits<This>::Noise Noise;
 
+    typedef typename Traits<This>::ObsrvFunction::Obsrvs Obsrvs;
+    typedef typename Traits<This>::ObsrvFunction::States States;
+    typedef typename Traits<This>::ObsrvFunction::Noises Noises;
+
     /**
      * \brief Represents the body observation function of this model
      */
@@ -208,6 +212,47 @@ public:
         return y; // RVO
     }
 
+    /**
+     * \brief Batch version of observation(). Column \f$i\f$ of the result
+     * is the observation of the \f$i\f$-th column of \a states and
+     * \a noises. The model selection components of all noise variates are
+     * mapped onto uniform variates at once using the vectorized
+     * fl::normal_to_uniform.
+     */
+    Obsrvs observations(const Eigen::Ref<const States>& states,
+                        const Eigen::Ref<const Noises>& noises) const override
+    {
+        assert(states.cols() == noises.cols());
+        assert(noises.rows() == noise_dimension());
+
+        const int count = states.cols();
+
+        const Eigen::Array<Real, 1, Eigen::Dynamic> u =
+            fl::normal_to_uniform(noises.bottomRows(1).array());
+
+        Obsrvs y(obsrv_dimension(), count);
+
+        for (int i = 0; i < count; ++i)
+        {
+            const State state = states.col(i);
+
+            if(u(i) > tail_weight_)
+            {
+                const typename BodyModel::Noise noise_body =
+                    noises.col(i).topRows(body_.noise_dimension());
+                y.col(i) = body_.observation(state, noise_body);
+            }
+            else
+            {
+                const typename TailModel::Noise noise_tail =
+                    noises.col(i).topRows(tail_.noise_dimension());
+                y.col(i) = tail_.observation(state, noise_tail);
+            }
+        }
+
+        return y;
+    }
+
     /**
      * \brief Evalues the probability of the specified \a obsrv, i.e.
      * \f$p(y \mid x)\f$ where \f$y =\f$ \a obsrv and \f$x =\f$ \a state.
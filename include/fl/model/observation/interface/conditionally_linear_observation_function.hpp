@@ -0,0 +1,89 @@
+/*
+ * This is part of the fl library, a C++ Bayesian filtering library
+ * (https://github.com/filtering-library)
+ *
+ * Copyright (c) 2015 Max Planck Society,
+ * 				 Autonomous Motion Department,
+ * 			     Institute for Intelligent Systems
+ *
+ * This Source Code Form is subject to the terms of the MIT License (MIT).
+ * A copy of the license can be found in the LICENSE file distributed with this
+ * source code.
+ */
+
+/**
+ * \file conditionally_linear_observation_function.hpp
+ * \date October 2026
+ * \author agent (agent@local)
+ */
+
+#pragma once
+
+
+#include <Eigen/Dense>
+
+#include <fl/util/types.hpp>
+#include <fl/util/traits.hpp>
+
+#include <fl/model/observation/interface/additive_observation_function.hpp>
+
+namespace fl
+{
+
+/**
+ * \ingroup observation_models
+ *
+ * \brief Additive observation function which is linear in a substate given
+ * the remaining substate.
+ *
+ * The state \f$x = [x_n; x_l]\f$ is partitioned into the nonlinear substate
+ * \f$x_n\f$, the first nonlinear_dimension() components, and the linear
+ * substate \f$x_l\f$ such that
+ *
+ * \f$ y = h(x) + w = c(x_n) + C(x_n)\, x_l + w \f$
+ *
+ * where linear_matrix() returns \f$C = \partial h / \partial x_l\f$. A sigma
+ * point GaussianFilter applies the quadrature to \f$x_n\f$ only, see
+ * SigmaPointUpdatePolicy<SigmaPointQuadrature,
+ * ConditionallyLinear<ConditionallyLinearObservationFunction>>.
+ */
+template <
+    typename Obsrv,
+    typename State,
+    typename NoiseDensity,
+    int Id = 0
+>
+class ConditionallyLinearObservationFunction
+    : public AdditiveObservationFunction<Obsrv, State, NoiseDensity, Id>,
+      private internal::ConditionallyLinearModelType
+{
+public:
+    /**
+     * Jacobian \f$C\f$ of the model with respect to the linear substate
+     */
+    typedef Eigen::Matrix<
+                Real,
+                SizeOf<Obsrv>::Value,
+                Eigen::Dynamic
+            > LinearMatrix;
+
+public:
+    /**
+     * \brief Overridable default destructor
+     */
+    virtual ~ConditionallyLinearObservationFunction() noexcept { }
+
+    /**
+     * \return Dimension of the nonlinear substate \f$x_n\f$ which is the
+     *         head of the state vector
+     */
+    virtual int nonlinear_dimension() const = 0;
+
+    /**
+     * \return \f$C(x_n)\f$ of dimension \f$\dim(y) \times \dim(x_l)\f$. Only
+     *         the nonlinear substate of \a state is used.
+     */
+    virtual LinearMatrix linear_matrix(const State& state) const = 0;
+};
+
+}
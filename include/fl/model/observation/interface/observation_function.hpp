@@ -20,6 +20,8 @@
 #pragma once
 
 
+#include <Eigen/Dense>
+
 #include <fl/util/types.hpp>
 #include <fl/util/traits.hpp>
 
@@ -45,6 +47,14 @@ public:
     typedef State_ State;
     typedef Noise_ Noise;
 
+    /**
+     * \brief Matrices holding one observation, state or noise variate per
+     *        column. Used by the batch version observations().
+     */
+    typedef Eigen::Matrix<Real, SizeOf<Obsrv>::Value, Eigen::Dynamic> Obsrvs;
+    typedef Eigen::Matrix<Real, SizeOf<State>::Value, Eigen::Dynamic> States;
+    typedef Eigen::Matrix<Real, SizeOf<Noise>::Value, Eigen::Dynamic> Noises;
+
     /**
      * \brief Overridable default destructor
      */
@@ -63,6 +73,33 @@ public:
     virtual Obsrv observation(const State& state,
                               const Noise& noise) const = 0;
 
+    /**
+     * \brief Batch version of observation(). Column \f$i\f$ of the result is
+     * the observation \f$h(x_i, w_i)\f$ of the \f$i\f$-th columns of
+     * \a states and \a noises.
+     *
+     * The default implementation evaluates observation() column by column.
+     * Models which evaluate many states cheaper at once, e.g. linear models
+     * by means of a single matrix product, override this.
+     *
+     * The arguments are taken by reference such that point matrices of any
+     * number of columns and blocks of them are passed without copies.
+     */
+    virtual Obsrvs observations(const Eigen::Ref<const States>& states,
+                                const Eigen::Ref<const Noises>& noises) const
+    {
+        assert(states.cols() == noises.cols());
+
+        Obsrvs y(obsrv_dimension(), states.cols());
+
+        for (int i = 0; i < states.cols(); ++i)
+        {
+            y.col(i) = observation(states.col(i), noises.col(i));
+        }
+
+        return y;
+    }
+
     /**
      * \brief Returns the dimension of the state variable \f$x\f$
      */
@@ -98,6 +135,64 @@ public:
     virtual void id(int) { /* const ID */ }
 };
 
+/** \cond internal */
+namespace internal
+{
+
+template <typename Model, typename StateMatrix, typename NoiseMatrix>
+auto batch_observations(const Model& model,
+                        const StateMatrix& states,
+                        const NoiseMatrix& noises,
+                        int) -> decltype(model.observations(states, noises))
+{
+    return model.observations(states, noises);
+}
+
+template <typename Model, typename StateMatrix, typename NoiseMatrix>
+Eigen::Matrix<Real, SizeOf<typename Model::Obsrv>::Value, Eigen::Dynamic>
+batch_observations(const Model& model,
+                   const StateMatrix& states,
+                   const NoiseMatrix& noises,
+                   long)
+{
+    assert(states.cols() == noises.cols());
+
+    Eigen::Matrix<
+        Real, SizeOf<typename Model::Obsrv>::Value, Eigen::Dynamic
+    > y;
+
+    for (int i = 0; i < states.cols(); ++i)
+    {
+        const typename Model::Obsrv y_i =
+            model.observation(states.col(i), noises.col(i));
+
+        if (i == 0) y.resize(y_i.size(), states.cols());
+        y.col(i) = y_i;
+    }
+
+    return y;
+}
+
+}
+/** \endcond */
+
+/**
+ * \ingroup observation_models
+ *
+ * \brief Evaluates the observations of all columns of \a states and
+ * \a noises. Calls the batch function observations() of the model if it
+ * has one, e.g. by deriving from ObservationFunction. Models which only
+ * provide observation() are evaluated column by column.
+ */
+template <typename Model, typename StateMatrix, typename NoiseMatrix>
+auto batch_observations(const Model& model,
+                        const StateMatrix& states,
+                        const NoiseMatrix& noises)
+    -> decltype(internal::batch_observations(model, states, noises, 0))
+{
+    return internal::batch_observations(model, states, noises, 0);
+}
+
 }
 
 
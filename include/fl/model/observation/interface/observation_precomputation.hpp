@@ -0,0 +1,144 @@
+/*
+ * This is part of the fl library, a C++ Bayesian filtering library
+ * (https://github.com/filtering-library)
+ *
+ * Copyright (c) 2015 Max Planck Society,
+ * 				 Autonomous Motion Department,
+ * 			     Institute for Intelligent Systems
+ *
+ * This Source Code Form is subject to the terms of the MIT License (MIT).
+ * A copy of the license can be found in the LICENSE file distributed with this
+ * source code.
+ */
+
+/**
+ * \file observation_precomputation.hpp
+ * \date October 2026
+ * \author agent (agent@local)
+ */
+
+#pragma once
+
+
+#include <vector>
+#include <type_traits>
+
+#include <Eigen/StdVector>
+
+namespace fl
+{
+
+/**
+ * \ingroup observation_models
+ *
+ * \brief Determines whether an observation model provides the optional
+ * state precomputation hook
+ *
+ * \code
+ * typedef ... Precomputation;
+ *
+ * Precomputation precompute(const State& state) const;
+ *
+ * Obsrv precomputed_observation(const Precomputation& precomputation,
+ *                               const Noise& noise) const;
+ * \endcode
+ *
+ * The precomputation holds the state dependent part of the observation
+ * function which is the same for all sensors of a joint model, e.g. the
+ * rendering of an object at the state \f$x\f$ for all pixels of a depth
+ * camera. Hence, it must not depend on the model id.
+ * precomputed_observation(precompute(x), w) must be equal to
+ * observation(x, w).
+ */
+template <typename Model>
+struct HasObservationPrecomputation
+{
+private:
+    template <typename M>
+    static std::true_type test(typename M::Precomputation*);
+
+    template <typename M>
+    static std::false_type test(...);
+
+public:
+    enum : bool { Value = decltype(test<Model>(nullptr))::value };
+};
+
+/**
+ * \ingroup observation_models
+ *
+ * \brief Holds the precomputations of an observation model for each point of
+ * a point set. The multi-sensor update policies precompute once per point and
+ * evaluate each sensor on the stored precomputations.
+ *
+ * This is the fallback for models without the precomputation hook. Nothing is
+ * stored and the observation function is evaluated on the state directly.
+ */
+template <
+    typename Model,
+    bool Enabled = HasObservationPrecomputation<Model>::Value
+>
+class ObservationPrecomputation
+{
+public:
+    /**
+     * \brief Precomputes the state dependent part of the points in \a X
+     */
+    template <typename PointSet>
+    void precompute(const Model& model, const PointSet& X) { }
+
+    /**
+     * \brief Evaluates the observation \f$h(x_i, w)\f$ of the \a i-th point
+     *        \a x
+     */
+    template <typename State, typename Noise>
+    typename Model::Obsrv observation(const Model& model,
+                                      int i,
+                                      const State& x,
+                                      const Noise& w) const
+    {
+        return model.observation(x, w);
+    }
+};
+
+/**
+ * \ingroup observation_models
+ *
+ * \brief ObservationPrecomputation of a model providing the precomputation
+ * hook
+ */
+template <typename Model>
+class ObservationPrecomputation<Model, true>
+{
+public:
+    typedef typename Model::Precomputation Precomputation;
+
+    template <typename PointSet>
+    void precompute(const Model& model, const PointSet& X)
+    {
+        const int point_count = X.count_points();
+
+        precomputations_.resize(point_count);
+        for (int i = 0; i < point_count; ++i)
+        {
+            precomputations_[i] = model.precompute(X.point(i));
+        }
+    }
+
+    template <typename State, typename Noise>
+    typename Model::Obsrv observation(const Model& model,
+                                      int i,
+                                      const State& x,
+                                      const Noise& w) const
+    {
+        return model.precomputed_observation(precomputations_[i], w);
+    }
+
+private:
+    std::vector<
+        Precomputation,
+        Eigen::aligned_allocator<Precomputation>
+    > precomputations_;
+};
+
+}
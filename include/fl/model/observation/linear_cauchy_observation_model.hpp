@@ -47,6 +47,9 @@ public:
     typedef typename CauchyDistribution<Obsrv>::StandardVariate Noise;
     typedef typename CauchyDistribution<Obsrv>::SecondMoment NoiseMatrix;
 
+    typedef typename ObservationDensity<Obsrv, State>::StateArray StateArray;
+    typedef typename ObservationDensity<Obsrv, State>::ValueArray ValueArray;
+
     /**
      * Observation model sensor matrix \f$H_t\f$ use in
      *
@@ -92,6 +95,30 @@ public:
         return density_.log_probability(obsrv);
     }
 
+    /**
+     * \brief Evaluates the log. probabilities of \a obsrv for all \a states.
+     *
+     * All predicted observations are computed with a single matrix product
+     * and evaluated in one batch. Since the density is symmetric in
+     * \f$y - H x\f$ the predictions are evaluated under a density located
+     * at \a obsrv.
+     */
+    ValueArray log_probabilities(const Obsrv& obsrv,
+                                 const StateArray& states) override
+    {
+        Eigen::Matrix<Real, SizeOf<State>::Value, Eigen::Dynamic>
+            state_matrix(state_dimension(), states.size());
+
+        for (int i = 0; i < states.size(); ++i)
+        {
+            state_matrix.col(i) = states[i];
+        }
+
+        density_.location(obsrv);
+
+        return density_.log_probabilities(sensor_matrix_ * state_matrix);
+    }
+
     const SensorMatrix& sensor_matrix() const override
     {
         return sensor_matrix_;
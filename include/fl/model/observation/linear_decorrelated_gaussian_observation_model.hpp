@@ -59,6 +59,15 @@ public:
     typedef
     typename AdditiveUncorrelatedInterface::NoiseMatrix NoiseDiagonalMatrix;
 
+    typedef
+    typename AdditiveObservationFunctionInterface::Obsrvs Obsrvs;
+
+    typedef
+    typename AdditiveObservationFunctionInterface::States States;
+
+    typedef
+    typename AdditiveObservationFunctionInterface::Noises Noises;
+
     /**
      * Observation model sensor matrix \f$H_t\f$ use in
      *
@@ -102,6 +111,23 @@ public:
         return sensor_matrix_ * state;
     }
 
+    /**
+     * \brief Batch version of observation() computing
+     *        \f$ Y = H_t X + N_t W \f$ with one product for the sensor
+     *        matrix and a row scaling by the diagonal noise matrix
+     */
+    Obsrvs observations(const Eigen::Ref<const States>& states,
+                        const Eigen::Ref<const Noises>& noises) const override
+    {
+        assert(states.cols() == noises.cols());
+
+        Obsrvs y(obsrv_dimension(), states.cols());
+        y.noalias() = sensor_matrix_ * states;
+        y.noalias() += noise_diagonal_matrix() * noises;
+
+        return y;
+    }
+
     Real log_probability(const Obsrv& obsrv, const State& state) const override
     {
         density_.mean(expected_observation(state));
@@ -124,6 +150,15 @@ public:
         return density_.covariance();
     }
 
+    /**
+     * \return The noise density \f$p(w)\f$ of which the diagonal
+     *         covariance \f$R\f$ can be accessed without copying it
+     */
+    const DecorrelatedGaussian<Obsrv>& noise_density() const
+    {
+        return density_;
+    }
+
     virtual NoiseDiagonalMatrix noise_diagonal_matrix() const
     {
         return density_.square_root();
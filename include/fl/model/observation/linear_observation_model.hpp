@@ -48,6 +48,10 @@ public:
     typedef AdditiveObservationFunction<Obsrv, State, NoiseDensity> AdditiveInterface;
     typedef typename AdditiveInterface::FunctionInterface FunctionInterface;
 
+    typedef typename FunctionInterface::Obsrvs Obsrvs;
+    typedef typename FunctionInterface::States States;
+    typedef typename FunctionInterface::Noises Noises;
+
     /**
      * Linear model density. The density for linear model is the Gaussian over
      * observation space.
@@ -110,6 +114,23 @@ public:
         return sensor_matrix_ * state;
     }
 
+    /**
+     * \brief Batch version of observation() computing
+     *        \f$ Y = H_t X + N_t W \f$ with one product per term instead of
+     *        one matrix-vector product per column
+     */
+    Obsrvs observations(const Eigen::Ref<const States>& states,
+                        const Eigen::Ref<const Noises>& noises) const override
+    {
+        assert(states.cols() == noises.cols());
+
+        Obsrvs y(obsrv_dimension(), states.cols());
+        y.noalias() = sensor_matrix_ * states;
+        y.noalias() += noise_matrix() * noises;
+
+        return y;
+    }
+
     Real log_probability(const Obsrv& obsrv, const State& state) const
     {
         density_.mean(expected_observation(state));
@@ -132,6 +153,15 @@ public:
         return density_.covariance();
     }
 
+    /**
+     * \return The noise density \f$p(w)\f$ of which the covariance
+     *         \f$R\f$ can be accessed without copying it
+     */
+    const NoiseDensity& noise_density() const
+    {
+        return density_;
+    }
+
     int obsrv_dimension() const override
     {
         return sensor_matrix_.rows();
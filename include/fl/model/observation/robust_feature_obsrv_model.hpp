@@ -107,7 +107,8 @@ public:
      */
     explicit RobustFeatureObsrvModel(ObsrvModel& obsrv_model)
         : obsrv_model_(obsrv_model),
-          body_gaussian_(obsrv_model.obsrv_dimension())
+          body_gaussian_(obsrv_model.obsrv_dimension()),
+          mean_state_(State::Zero(obsrv_model.state_dimension()))
     { }
 
     /**
@@ -73,9 +73,12 @@ public:
             ObsrvModel& obsrv_model,
             int sensor_count)
         : RobustFeatureObsrvModelBase(obsrv_model),
-          body_gaussians_(sensor_count),
           id_(0)
-    { }
+    {
+        // Eigen 3.4 reads Array<T, N, 1>(int) of a fixed size N as a
+        // coefficient initializer, hence the separate resize
+        body_gaussians_.resize(sensor_count);
+    }
 
     /**
      * \brief Overridable default destructor
@@ -0,0 +1,373 @@
+/*
+ * This is part of the fl library, a C++ Bayesian filtering library
+ * (https://github.com/filtering-library)
+ *
+ * Copyright (c) 2015 Max Planck Society,
+ * 				 Autonomous Motion Department,
+ * 			     Institute for Intelligent Systems
+ *
+ * This Source Code Form is subject to the terms of the MIT License (MIT).
+ * A copy of the license can be found in the LICENSE file distributed with this
+ * source code.
+ */
+
+/**
+ * \file tabulated_observation_density.hpp
+ * \date October 2026
+ * \author agent (agent@local)
+ */
+
+#pragma once
+
+
+#include <cmath>
+#include <limits>
+#include <string>
+#include <algorithm>
+
+#include <Eigen/Dense>
+
+#include <fl/util/types.hpp>
+#include <fl/util/traits.hpp>
+#include <fl/util/descriptor.hpp>
+#include <fl/exception/exception.hpp>
+#include <fl/model/observation/interface/observation_density.hpp>
+
+namespace fl
+{
+
+/**
+ * \ingroup observation_models
+ *
+ * \brief Precompiled version of a scalar observation density
+ * \f$p(y \mid \hat{y})\f$ which depends only on the observation \f$y\f$ and
+ * the predicted observation \f$\hat{y}\f$, e.g. a BodyTailObsrvModel or a
+ * UniformObservationModel of a single pixel. The one-dimensional state of the
+ * wrapped model is the predicted observation.
+ *
+ * On construction the log. probability of the model is evaluated on a regular
+ * grid over \f$[y_{min}, y_{max}] \times [\hat{y}_{min}, \hat{y}_{max}]\f$.
+ * Afterwards, log_probability() costs a bilinear interpolation between four
+ * table entries instead of evaluating exp, log or erf. Queries outside of the
+ * grid fall back to the exact model.
+ *
+ * The interpolation error is estimated during compilation by comparing the
+ * interpolant against the model at the center of every grid cell. This is
+ * where the error of a locally quadratic function peaks. The estimate is
+ * reported by estimated_max_error(). It is not a bound: the error of a model
+ * with large higher-order derivatives may peak elsewhere within a cell.
+ * Discontinuities of the model within the grid, e.g. the support bounds of a
+ * uniform tail, show up as a large error and should be kept outside of the
+ * tabulated range.
+ *
+ * Log. probabilities below min_log_probability() are clamped to it, both
+ * before tabulation and when falling back to the model outside of the grid,
+ * such that zero probabilities map onto the same value everywhere.
+ *
+ * \tparam Model    Observation density with a one-dimensional \c Obsrv and a
+ *                  one-dimensional \c State
+ */
+template <typename Model>
+class TabulatedObservationDensity
+    : public ObservationDensity<typename Model::Obsrv, typename Model::State>,
+      public Descriptor
+{
+private:
+    typedef ObservationDensity<
+                typename Model::Obsrv,
+                typename Model::State
+            > DensityInterface;
+
+public:
+    typedef typename Model::Obsrv Obsrv;
+    typedef typename Model::State State;
+
+    typedef typename DensityInterface::StateArray StateArray;
+    typedef typename DensityInterface::ValueArray ValueArray;
+
+    /**
+     * \brief Table of log. probabilities. Entry \f$(i, j)\f$ holds
+     * \f$\log p(y_i \mid \hat{y}_j)\f$.
+     */
+    typedef Eigen::Matrix<Real, Eigen::Dynamic, Eigen::Dynamic> Table;
+
+public:
+    /**
+     * \brief Compiles the specified \a model into a table
+     *
+     * \param model             Scalar observation density
+     * \param obsrv_min         Lower bound of the tabulated observations
+     * \param obsrv_max         Upper bound of the tabulated observations
+     * \param obsrv_nodes       Number of grid nodes along the observation
+     * \param prediction_min    Lower bound of the tabulated predictions
+     * \param prediction_max    Upper bound of the tabulated predictions
+     * \param prediction_nodes  Number of grid nodes along the prediction
+     *
+     * \throws Exception if the model is not scalar, a range is empty or less
+     *                   than two nodes are requested along a dimension
+     */
+    TabulatedObservationDensity(const Model& model,
+                                Real obsrv_min,
+                                Real obsrv_max,
+                                int obsrv_nodes,
+                                Real prediction_min,
+                                Real prediction_max,
+                                int prediction_nodes)
+        : model_(model),
+          obsrv_min_(obsrv_min),
+          obsrv_max_(obsrv_max),
+          prediction_min_(prediction_min),
+          prediction_max_(prediction_max),
+          estimated_max_error_(0)
+    {
+        if (model_.obsrv_dimension() != 1 || model_.state_dimension() != 1)
+        {
+            fl_throw(Exception("Tabulated density requires a scalar "
+                               "observation and a scalar predicted "
+                               "observation state"));
+        }
+
+        if (!(obsrv_min < obsrv_max) || !(prediction_min < prediction_max))
+        {
+            fl_throw(Exception("Tabulated density requires non-empty ranges"));
+        }
+
+        if (obsrv_nodes < 2 || prediction_nodes < 2)
+        {
+            fl_throw(Exception("Tabulated density requires at least two "
+                               "nodes per dimension"));
+        }
+
+        obsrv_scale_ = Real(obsrv_nodes - 1) / (obsrv_max - obsrv_min);
+        prediction_scale_ =
+            Real(prediction_nodes - 1) / (prediction_max - prediction_min);
+
+        compile(obsrv_nodes, prediction_nodes);
+    }
+
+    /**
+     * \brief Evaluates the interpolated log. probability of \a obsrv given
+     *        the predicted observation \a state
+     */
+    Real log_probability(const Obsrv& obsrv, const State& state) const override
+    {
+        return lookup(obsrv(0), state(0));
+    }
+
+    /**
+     * \brief Evaluates the interpolated probability of \a obsrv given the
+     *        predicted observation \a state
+     */
+    Real probability(const Obsrv& obsrv, const State& state) const override
+    {
+        return std::exp(lookup(obsrv(0), state(0)));
+    }
+
+    /**
+     * \brief Evaluates the log. probabilities of \a obsrv given each of the
+     *        predicted observations in \a states
+     */
+    ValueArray log_probabilities(const Obsrv& obsrv,
+                                 const StateArray& states) override
+    {
+        ValueArray log_probs(states.size());
+
+        const Real y = obsrv(0);
+        for (int i = 0; i < states.size(); ++i)
+        {
+            log_probs(i) = lookup(y, states(i)(0));
+        }
+
+        return log_probs;
+    }
+
+    /**
+     * \brief Element-wise log. probabilities of the observations \a obsrvs
+     *        given the predicted observations \a predictions, e.g. the
+     *        depth image of a camera and a rendered depth image.
+     */
+    template <typename Obsrvs, typename Predictions>
+    Eigen::Array<Real,
+                 Obsrvs::RowsAtCompileTime,
+                 Obsrvs::ColsAtCompileTime>
+    log_probabilities(const Eigen::ArrayBase<Obsrvs>& obsrvs,
+                      const Eigen::ArrayBase<Predictions>& predictions) const
+    {
+        assert(obsrvs.rows() == predictions.rows());
+        assert(obsrvs.cols() == predictions.cols());
+
+        Eigen::Array<Real,
+                     Obsrvs::RowsAtCompileTime,
+                     Obsrvs::ColsAtCompileTime>
+            log_probs(obsrvs.rows(), obsrvs.cols());
+
+        for (int j = 0; j < obsrvs.cols(); ++j)
+        {
+            for (int i = 0; i < obsrvs.rows(); ++i)
+            {
+                log_probs(i, j) = lookup(obsrvs(i, j), predictions(i, j));
+            }
+        }
+
+        return log_probs;
+    }
+
+    /**
+     * \brief Estimated maximum absolute error of the interpolated
+     *        log. probability within the tabulated range, sampled at the
+     *        cell centers
+     */
+    Real estimated_max_error() const
+    {
+        return estimated_max_error_;
+    }
+
+    /**
+     * \brief Tabulated log. probabilities
+     */
+    const Table& table() const
+    {
+        return table_;
+    }
+
+    /**
+     * \brief Accesses the wrapped exact model
+     */
+    const Model& model() const
+    {
+        return model_;
+    }
+
+    /**
+     * \brief Lower bound of the tabulated log. probabilities,
+     *        \f$\log\f$ of the smallest normalized Real
+     */
+    static Real min_log_probability()
+    {
+        return std::log(std::numeric_limits<Real>::min());
+    }
+
+    int obsrv_dimension() const override { return 1; }
+    int state_dimension() const override { return 1; }
+
+    virtual std::string name() const
+    {
+        return "TabulatedObservationDensity<"
+                + this->list_arguments(model_.name())
+                + ">";
+    }
+
+    virtual std::string description() const
+    {
+        return "Tabulated observation density of "
+                + this->list_descriptions(model_.description());
+    }
+
+protected:
+    /** \cond internal */
+
+    /**
+     * \brief Tabulates the model on the grid and estimates the
+     *        interpolation error at the cell centers
+     */
+    void compile(int obsrv_nodes, int prediction_nodes)
+    {
+        table_.resize(obsrv_nodes, prediction_nodes);
+
+        const Real dy = Real(1) / obsrv_scale_;
+        const Real dx = Real(1) / prediction_scale_;
+
+        for (int j = 0; j < prediction_nodes; ++j)
+        {
+            for (int i = 0; i < obsrv_nodes; ++i)
+            {
+                table_(i, j) = exact(obsrv_min_ + i * dy,
+                                     prediction_min_ + j * dx);
+            }
+        }
+
+        estimated_max_error_ = 0;
+        for (int j = 0; j < prediction_nodes - 1; ++j)
+        {
+            for (int i = 0; i < obsrv_nodes - 1; ++i)
+            {
+                const Real y = obsrv_min_ + (i + Real(0.5)) * dy;
+                const Real x = prediction_min_ + (j + Real(0.5)) * dx;
+
+                estimated_max_error_ =
+                    std::max(estimated_max_error_,
+                             std::fabs(lookup(y, x) - exact(y, x)));
+            }
+        }
+    }
+
+    /**
+     * \brief Exact log. probability clamped to min_log_probability()
+     */
+    Real exact(Real y, Real x) const
+    {
+        const Real log_prob = model_.log_probability(Obsrv::Constant(1, y),
+                                                     State::Constant(1, x));
+
+        // also maps NaN, i.e. log(0) evaluated as 0 * -inf, onto the bound
+        return log_prob > min_log_probability() ? log_prob
+                                                : min_log_probability();
+    }
+
+    /**
+     * \brief Bilinear interpolation of the table at (\a y, \a x) or the
+     *        exact log. probability outside of the grid
+     */
+    Real lookup(Real y, Real x) const
+    {
+        const Real s = (y - obsrv_min_) * obsrv_scale_;
+        const Real t = (x - prediction_min_) * prediction_scale_;
+
+        const int last_row = table_.rows() - 1;
+        const int last_col = table_.cols() - 1;
+
+        // the negated comparison also rejects NaN
+        if (!(s >= 0 && s <= last_row && t >= 0 && t <= last_col))
+        {
+            return outside(y, x);
+        }
+
+        const int i = std::min(int(s), last_row - 1);
+        const int j = std::min(int(t), last_col - 1);
+        const Real fs = s - i;
+        const Real ft = t - j;
+
+        const Real* v = table_.data() + i + j * table_.rows();
+        const Real* w = v + table_.rows();
+
+        const Real v_j  = v[0] + fs * (v[1] - v[0]);
+        const Real v_j1 = w[0] + fs * (w[1] - w[0]);
+
+        return v_j + ft * (v_j1 - v_j);
+    }
+
+    /**
+     * \brief Exact log. probability of a query outside of the grid, clamped
+     *        like the table entries. Kept out of lookup() such that the
+     *        latter is small enough to be inlined.
+     */
+    Real outside(Real y, Real x) const
+    {
+        return exact(y, x);
+    }
+
+    Model model_;
+    Table table_;
+
+    Real obsrv_min_;
+    Real obsrv_max_;
+    Real obsrv_scale_;
+    Real prediction_min_;
+    Real prediction_max_;
+    Real prediction_scale_;
+    Real estimated_max_error_;
+
+    /** \endcond */
+};
+
+}
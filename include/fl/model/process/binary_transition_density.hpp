@@ -20,14 +20,32 @@
 #pragma once
 
 
-#include <fl/util/types.hpp>
+#include <cmath>
 #include <iostream>
 
+#include <Eigen/Dense>
+
+#include <fl/util/types.hpp>
+
 
 
 namespace fl
 {
 
+/**
+ * Transition of a binary state in continuous time. Given the probability
+ * \f$p_1\f$ of the state being 1, the probability after a time \f$dt\f$ is
+ * the affine map
+ *
+ * \f$ p_1' = a\, p_1 + (1 - a)\, s \f$
+ *
+ * with \f$a = (p_{1\to1} - p_{0\to1})^{dt}\f$ and the stationary
+ * probability \f$s = p_{0\to1} / (1 - p_{1\to1} + p_{0\to1})\f$. The
+ * coefficients depend on \f$dt\f$ only and are computed once per call,
+ * hence, advancing many cells by the same \f$dt\f$ through the array
+ * interface costs a single std::pow and one multiply-add per cell. The
+ * density holds no mutable state and may be shared among threads.
+ */
 class BinaryTransitionDensity /// \todo not really a density since it is discrete
 {
 public:
@@ -42,26 +60,103 @@ public:
             std::cout << "the case of p_0to1 > p_1to1 is not handled in the "
                       << "binary transition density." << std::endl;
         }
+
+        stationary_ = p_0to1_ / (1. - p_1to1_ + p_0to1_);
+
+        // limit of p_0to1_ -> 0 and p_1to1_ -> 1
+        if(!std::isfinite(stationary_)) stationary_ = 0.;
     }
 
     Real probability(const bool& next_state,
                               const bool& state,
-                              const Real& dt)
+                              const Real& dt) const
     {
-        Real a = std::pow(p_1to1_ - p_0to1_, dt);
-        Real prob_1 =  a * Real(state)
-                                + (a - 1.) * p_0to1_ / (p_1to1_ - 1. - p_0to1_);
-
-        // limit of p_0to1_ -> 0 and p_1to1_ -> 1
-        if(!std::isfinite(prob_1)) prob_1 = Real(state);
+        Real a, b;
+        coefficients(dt, a, b);
+        Real prob_1 = a * Real(state) + b;
 
         return next_state ? prob_1 : 1. - prob_1;
     }
 
+    /**
+     * \return Element-wise transition probabilities
+     *         \f$p(\text{next\_states}_i \mid \text{states}_i)\f$ of a set of
+     *         binary cells sharing the time step \a dt
+     */
+    template <typename NextStates, typename States>
+    Eigen::Array<Real,
+                 States::RowsAtCompileTime,
+                 States::ColsAtCompileTime>
+    probabilities(const Eigen::ArrayBase<NextStates>& next_states,
+                  const Eigen::ArrayBase<States>& states,
+                  const Real& dt) const
+    {
+        Real a, b;
+        coefficients(dt, a, b);
+
+        const Eigen::Array<Real,
+                           States::RowsAtCompileTime,
+                           States::ColsAtCompileTime> prob_1 =
+            a * states.template cast<Real>() + b;
+
+        return next_states.select(prob_1, 1. - prob_1);
+    }
+
+    /**
+     * \return The probabilities of the cells being 1 after the time step
+     *         \a dt given their current probabilities \a p_1
+     */
+    template <typename Derived>
+    Eigen::Array<Real,
+                 Derived::RowsAtCompileTime,
+                 Derived::ColsAtCompileTime>
+    probabilities(const Eigen::ArrayBase<Derived>& p_1, const Real& dt) const
+    {
+        Real a, b;
+        coefficients(dt, a, b);
+
+        return a * p_1 + b;
+    }
+
+    /**
+     * \brief Advances the probabilities \a p_1 of the cells being 1 by the
+     *        time step \a dt in place
+     */
+    template <typename Derived>
+    void propagate(Eigen::ArrayBase<Derived>& p_1, const Real& dt) const
+    {
+        Real a, b;
+        coefficients(dt, a, b);
+
+        p_1 = a * p_1 + b;
+    }
+
+    /**
+     * \copydoc propagate(Eigen::ArrayBase<Derived>&, const Real&) const
+     *
+     * This overload accepts temporaries such as blocks or maps.
+     */
+    template <typename Derived>
+    void propagate(Eigen::ArrayBase<Derived>&& p_1, const Real& dt) const
+    {
+        propagate(p_1, dt);
+    }
+
+private:
+    /**
+     * \brief Computes the affine coefficients \a a and \a b of the time
+     *        step \a dt
+     */
+    void coefficients(const Real& dt, Real& a, Real& b) const
+    {
+        a = std::pow(p_1to1_ - p_0to1_, dt);
+        b = (1. - a) * stationary_;
+    }
 
 private:
     Real p_1to1_;
     Real p_0to1_;
+    Real stationary_;
 };
 
 
@@ -0,0 +1,92 @@
+/*
+ * This is part of the fl library, a C++ Bayesian filtering library
+ * (https://github.com/filtering-library)
+ *
+ * Copyright (c) 2015 Max Planck Society,
+ * 				 Autonomous Motion Department,
+ * 			     Institute for Intelligent Systems
+ *
+ * This Source Code Form is subject to the terms of the MIT License (MIT).
+ * A copy of the license can be found in the LICENSE file distributed with this
+ * source code.
+ */
+
+/**
+ * \file conditionally_linear_state_transition_function.hpp
+ * \date October 2026
+ * \author agent (agent@local)
+ */
+
+#pragma once
+
+
+#include <Eigen/Dense>
+
+#include <fl/util/types.hpp>
+#include <fl/util/traits.hpp>
+
+#include <fl/model/process/interface/additive_state_transition_function.hpp>
+
+namespace fl
+{
+
+/**
+ * \ingroup process_models
+ *
+ * \brief Additive state transition function which is linear in a substate
+ * given the remaining substate.
+ *
+ * The state \f$x = [x_n; x_l]\f$ is partitioned into the nonlinear substate
+ * \f$x_n\f$, the first nonlinear_dimension() components, and the linear
+ * substate \f$x_l\f$ such that
+ *
+ * \f$ x_{t+1} = f(x_t, u_t) + v_t
+ *             = a(x_{n,t}, u_t) + B(x_{n,t}, u_t)\, x_{l,t} + v_t \f$
+ *
+ * where linear_matrix() returns \f$B = \partial f / \partial x_l\f$. A sigma
+ * point GaussianFilter applies the quadrature to \f$x_n\f$ only and
+ * integrates over \f$x_l\f$ in closed form, see
+ * SigmaPointPredictPolicy<SigmaPointQuadrature,
+ * ConditionallyLinear<ConditionallyLinearStateTransitionFunction>>.
+ */
+template <
+    typename State,
+    typename Noise,
+    typename Input,
+    int Id = 0
+>
+class ConditionallyLinearStateTransitionFunction
+    : public AdditiveStateTransitionFunction<State, Noise, Input, Id>,
+      private internal::ConditionallyLinearModelType
+{
+public:
+    /**
+     * Jacobian \f$B\f$ of the model with respect to the linear substate
+     */
+    typedef Eigen::Matrix<
+                Real,
+                SizeOf<State>::Value,
+                Eigen::Dynamic
+            > LinearMatrix;
+
+public:
+    /**
+     * \brief Overridable default destructor
+     */
+    virtual ~ConditionallyLinearStateTransitionFunction() noexcept { }
+
+    /**
+     * \return Dimension of the nonlinear substate \f$x_n\f$ which is the
+     *         head of the state vector
+     */
+    virtual int nonlinear_dimension() const = 0;
+
+    /**
+     * \return \f$B(x_n, u)\f$ of dimension \f$\dim(x) \times \dim(x_l)\f$.
+     *         Only the nonlinear substate of \a state is used.
+     */
+    virtual LinearMatrix linear_matrix(const State& state,
+                                       const Input& input) const = 0;
+};
+
+}
@@ -20,6 +20,9 @@
 #pragma once
 
 
+#include <Eigen/Dense>
+
+#include <fl/util/types.hpp>
 #include <fl/util/traits.hpp>
 
 namespace fl
@@ -41,6 +44,13 @@ public:
     typedef Noise_ Noise;
     typedef Input_ Input;
 
+    /**
+     * \brief Matrices holding one state or noise variate per column. Used by
+     *        the batch version states().
+     */
+    typedef Eigen::Matrix<Real, SizeOf<State>::Value, Eigen::Dynamic> States;
+    typedef Eigen::Matrix<Real, SizeOf<Noise>::Value, Eigen::Dynamic> Noises;
+
 public:
     /**
      * \brief Overridable default destructor
@@ -55,6 +65,34 @@ public:
                         const Noise& noise,
                         const Input& input) const = 0;
 
+    /**
+     * \brief Batch version of state(). Column \f$i\f$ of the result is the
+     * state \f$f(x_i, v_i, u)\f$ of the \f$i\f$-th columns of
+     * \a prev_states and \a noises under the common \a input.
+     *
+     * The default implementation evaluates state() column by column. Models
+     * which propagate many states cheaper at once, e.g. linear models by
+     * means of a single matrix product, override this.
+     *
+     * The arguments are taken by reference such that point matrices of any
+     * number of columns and blocks of them are passed without copies.
+     */
+    virtual States states(const Eigen::Ref<const States>& prev_states,
+                          const Eigen::Ref<const Noises>& noises,
+                          const Input& input) const
+    {
+        assert(prev_states.cols() == noises.cols());
+
+        States x(state_dimension(), prev_states.cols());
+
+        for (int i = 0; i < prev_states.cols(); ++i)
+        {
+            x.col(i) = state(prev_states.col(i), noises.col(i), input);
+        }
+
+        return x;
+    }
+
     /**
      * \return Dimension of the state variable $\f$x\f$
      */
@@ -86,6 +124,76 @@ public:
     virtual void id(int) { /* const ID */ }
 };
 
+/** \cond internal */
+namespace internal
+{
+
+template <typename Model,
+          typename StateMatrix,
+          typename NoiseMatrix,
+          typename Input>
+auto batch_states(const Model& model,
+                  const StateMatrix& prev_states,
+                  const NoiseMatrix& noises,
+                  const Input& input,
+                  int) -> decltype(model.states(prev_states, noises, input))
+{
+    return model.states(prev_states, noises, input);
+}
+
+template <typename Model,
+          typename StateMatrix,
+          typename NoiseMatrix,
+          typename Input>
+Eigen::Matrix<Real, SizeOf<typename Model::State>::Value, Eigen::Dynamic>
+batch_states(const Model& model,
+             const StateMatrix& prev_states,
+             const NoiseMatrix& noises,
+             const Input& input,
+             long)
+{
+    assert(prev_states.cols() == noises.cols());
+
+    Eigen::Matrix<
+        Real, SizeOf<typename Model::State>::Value, Eigen::Dynamic
+    > x;
+
+    for (int i = 0; i < prev_states.cols(); ++i)
+    {
+        const typename Model::State x_i =
+            model.state(prev_states.col(i), noises.col(i), input);
+
+        if (i == 0) x.resize(x_i.size(), prev_states.cols());
+        x.col(i) = x_i;
+    }
+
+    return x;
+}
+
+}
+/** \endcond */
+
+/**
+ * \ingroup process_models
+ *
+ * \brief Propagates all columns of \a prev_states and \a noises under the
+ * common \a input. Calls the batch function states() of the model if it has
+ * one, e.g. by deriving from StateTransitionFunction. Models which only
+ * provide state() are evaluated column by column.
+ */
+template <typename Model,
+          typename StateMatrix,
+          typename NoiseMatrix,
+          typename Input>
+auto batch_states(const Model& model,
+                  const StateMatrix& prev_states,
+                  const NoiseMatrix& noises,
+                  const Input& input)
+    -> decltype(internal::batch_states(model, prev_states, noises, input, 0))
+{
+    return internal::batch_states(model, prev_states, noises, input, 0);
+}
+
 
 
 
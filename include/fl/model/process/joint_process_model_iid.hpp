@@ -22,10 +22,12 @@
 
 #include <Eigen/Dense>
 
+#include <string>
 #include <utility>
 
 #include <fl/util/traits.hpp>
 #include <fl/util/meta.hpp>
+#include <fl/util/descriptor.hpp>
 
 #include <fl/model/process/interface/state_transition_function.hpp>
 
@@ -49,31 +51,41 @@ struct Traits<
     enum : signed int { ModelCount = Count };
 
     typedef ProcessModel LocalProcessModel;
-    typedef typename Traits<ProcessModel>::Scalar Scalar;
-    typedef typename Traits<ProcessModel>::State LocalState;
-    typedef typename Traits<ProcessModel>::Input LocalInput;
-    typedef typename Traits<ProcessModel>::Noise LocalNoise;
+    typedef typename ProcessModel::State LocalState;
+    typedef typename ProcessModel::Input LocalInput;
+    typedef typename ProcessModel::Noise LocalNoise;
+    typedef typename LocalState::Scalar Scalar;
 
     enum : signed int
     {
-        StateDim = ExpandSizes<LocalState::SizeAtCompileTime, Count>::Size,
-        NoiseDim = ExpandSizes<LocalNoise::SizeAtCompileTime, Count>::Size,
-        InputDim = ExpandSizes<LocalInput::SizeAtCompileTime, Count>::Size
+        StateDim = ExpandSizes<SizeOf<LocalState>::Value, Count>::Size,
+        NoiseDim = ExpandSizes<SizeOf<LocalNoise>::Value, Count>::Size,
+        InputDim = ExpandSizes<SizeOf<LocalInput>::Value, Count>::Size
     };
 
     typedef Eigen::Matrix<Scalar, StateDim, 1> State;
     typedef Eigen::Matrix<Scalar, NoiseDim, 1> Noise;
     typedef Eigen::Matrix<Scalar, InputDim, 1> Input;
 
-    typedef ProcessModelInterface<
+    typedef StateTransitionFunction<
                 State,
                 Noise,
                 Input
-            > ProcessModelBase;
+            > StateTransitionFunctionBase;
 };
 
 /**
  * \ingroup process_models
+ *
+ * \brief JointProcessModel<MultipleOf<...>> is a state transition function
+ * composed of \f$n\f$ independent instances of the same local model, i.e.
+ * \f$ f(x, v, u) = [ f_{local}(x_1, v_1, u_1), \ldots,
+ * f_{local}(x_n, v_n, u_n) ]^T \f$.
+ *
+ * The \f$i\f$-th local model only depends on the \f$i\f$-th blocks of the
+ * state, the noise and the input. This structure is exploited by the
+ * SigmaPointPredictPolicy which reevaluates only the local models whose
+ * blocks are perturbed by a sigma point.
  */
 template <
     typename LocalProcessModel,
@@ -82,7 +94,8 @@ template <
 class JointProcessModel<MultipleOf<LocalProcessModel, Count>>
     : public Traits<
                  JointProcessModel<MultipleOf<LocalProcessModel, Count>>
-             >::ProcessModelBase
+             >::StateTransitionFunctionBase,
+      public Descriptor
 {
 private:
     /** Typdef of \c This for #from_traits(TypeName) helper */
@@ -93,9 +106,13 @@ public:
     typedef from_traits(Noise);
     typedef from_traits(Input);
 
+    typedef from_traits(LocalState);
+    typedef from_traits(LocalNoise);
+    typedef from_traits(LocalInput);
+
 public:
     JointProcessModel(const LocalProcessModel& local_process_model,
-                      int count = ToDimension<Count>())
+                      int count = ToDimension<Count>::Value)
         : local_process_model_(local_process_model),
           count_(count)
     {
@@ -111,23 +128,21 @@ public:
 
     virtual ~JointProcessModel() noexcept { }
 
-    virtual State predict_state(double delta_time,
-                                const State& state,
-                                const Noise& noise,
-                                const Input& input)
+    State state(const State& prev_state,
+                const Noise& noise,
+                const Input& input) const override
     {
         State x = State::Zero(state_dimension(), 1);
 
-        int state_dim = local_process_model_.state_dimension();
-        int noise_dim = local_process_model_.noise_dimension();
-        int input_dim = local_process_model_.input_dimension();
+        const int state_dim = local_process_model_.state_dimension();
+        const int noise_dim = local_process_model_.noise_dimension();
+        const int input_dim = local_process_model_.input_dimension();
 
         for (int i = 0; i < count_; ++i)
         {
             x.middleRows(i * state_dim, state_dim) =
-                local_process_model_.predict_state(
-                    delta_time,
-                    state.middleRows(i * state_dim, state_dim),
+                local_process_model_.state(
+                    prev_state.middleRows(i * state_dim, state_dim),
                     noise.middleRows(i * noise_dim, noise_dim),
                     input.middleRows(i * input_dim, input_dim));
         }
@@ -135,21 +150,42 @@ public:
         return x;
     }
 
-    virtual int state_dimension() const
+    int state_dimension() const override
     {
         return local_process_model_.state_dimension() * count_;
     }
 
-    virtual int noise_dimension() const
+    int noise_dimension() const override
     {
         return local_process_model_.noise_dimension() * count_;
     }
 
-    virtual int input_dimension() const
+    int input_dimension() const override
     {
         return local_process_model_.input_dimension() * count_;
     }
 
+    /**
+     * \brief Returns the number of local models within this joint model
+     */
+    int count_local_models() const
+    {
+        return count_;
+    }
+
+    virtual std::string name() const
+    {
+        return "JointProcessModel<MultipleOf<"
+                    + this->list_arguments(local_process_model_.name()) +
+               ", Count>>";
+    }
+
+    virtual std::string description() const
+    {
+        return "Joint process model of multiple independent local process "
+               "models with non-additive noise.";
+    }
+
     LocalProcessModel& local_process_model()
     {
         return local_process_model_;
@@ -56,6 +56,9 @@ public:
     typedef AdditiveStateTransitionFunction<State, State, Input> AdditiveInterface;
     typedef typename AdditiveInterface::FunctionInterface FunctionInterface;
 
+    typedef typename FunctionInterface::States States;
+    typedef typename FunctionInterface::Noises Noises;
+
 
     /**
      * \brief Linear model density. The density for linear model is the Gaussian
@@ -109,6 +112,27 @@ public:
         return dynamics_matrix_ * state + input_matrix_ * input;
     }
 
+    /**
+     * \brief Batch version of state() computing
+     *        \f$ X_{t+1} = F_t X_t + G_t u_t 1^T + N_t V_t \f$ with one
+     *        product per term instead of one matrix-vector product per column
+     */
+    virtual States states(const Eigen::Ref<const States>& prev_states,
+                          const Eigen::Ref<const Noises>& noises,
+                          const Input& input) const
+    {
+        assert(prev_states.cols() == noises.cols());
+
+        States x(state_dimension(), prev_states.cols());
+        x.noalias() = dynamics_matrix_ * prev_states;
+        x.noalias() += noise_matrix() * noises;
+
+        const State control = input_matrix_ * input;
+        x.colwise() += control;
+
+        return x;
+    }
+
     virtual Real log_probability(const State& state,
                                           const State& cond_state,
                                           const Input& cond_input) const
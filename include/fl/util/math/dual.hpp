@@ -0,0 +1,510 @@
+/*
+ * This is part of the fl library, a C++ Bayesian filtering library
+ * (https://github.com/filtering-library)
+ *
+ * Copyright (c) 2015 Max Planck Society,
+ * 				 Autonomous Motion Department,
+ * 			     Institute for Intelligent Systems
+ *
+ * This Source Code Form is subject to the terms of the MIT License (MIT).
+ * A copy of the license can be found in the LICENSE file distributed with this
+ * source code.
+ */
+
+/**
+ * \file dual.hpp
+ * \date October 2026
+ * \author agent (agent@local)
+ */
+
+#pragma once
+
+
+#include <cmath>
+
+#include <Eigen/Dense>
+
+#include <fl/util/types.hpp>
+
+namespace fl
+{
+
+/**
+ * \ingroup automatic_differentiation
+ *
+ * \brief Dual number scalar for forward-mode automatic differentiation.
+ *
+ * A Dual carries a value \f$a\f$ along with the derivatives
+ * \f$\nabla a = (\partial a / \partial z_1, \ldots,
+ * \partial a / \partial z_k)\f$ with respect to \f$k\f$ independent
+ * variables \f$z\f$ which are propagated through every arithmetic operation
+ * and elementary function by means of the chain rule. Evaluating a function
+ * \f$f(z)\f$ written generically in its scalar type once with Dual arguments
+ * therefore yields its value and its complete Jacobian
+ * \f$\partial f / \partial z\f$ in a single pass.
+ *
+ * Dual implements the Eigen NumTraits and may be used as the scalar of Eigen
+ * matrices. Real valued matrices are mixed with Dual valued ones directly,
+ * e.g. \c A * x with a \c Real matrix \c A and a Dual vector \c x.
+ * Elementary functions are found by argument dependent lookup, hence, they
+ * must be called unqualified, e.g. <tt>using std::sin; sin(x);</tt>.
+ *
+ * \tparam Scalar_      Underlying floating point type
+ * \tparam Directions   Number \f$k\f$ of independent variables. With
+ *                      Eigen::Dynamic the derivatives are allocated on the
+ *                      heap. Constants then carry no derivatives at all
+ *                      which are treated as zero.
+ */
+template <typename Scalar_, int Directions = Eigen::Dynamic>
+class Dual
+{
+public:
+    typedef Scalar_ Scalar;
+    typedef Eigen::Matrix<Scalar, Directions, 1> Derivatives;
+
+public:
+    /**
+     * \brief Creates the constant zero
+     */
+    Dual()
+        : value_(Scalar(0))
+    {
+        if (Directions != Eigen::Dynamic) derivatives_.setZero();
+    }
+
+    /**
+     * \brief Creates the constant \a value
+     */
+    Dual(Scalar value)
+        : value_(value)
+    {
+        if (Directions != Eigen::Dynamic) derivatives_.setZero();
+    }
+
+    /**
+     * \brief Creates a Dual of the given \a value and \a derivatives
+     */
+    Dual(Scalar value, const Derivatives& derivatives)
+        : value_(value),
+          derivatives_(derivatives)
+    { }
+
+    /**
+     * \brief Turns this Dual into the independent variable \a direction out
+     *        of \a directions with the given \a value, i.e. its derivative is
+     *        the unit vector \f$e_{direction}\f$.
+     */
+    void variable(Scalar value, int direction, int directions)
+    {
+        value_ = value;
+        derivatives_.setZero(directions);
+        derivatives_(direction) = Scalar(1);
+    }
+
+    /**
+     * \brief Value \f$a\f$
+     */
+    const Scalar& value() const
+    {
+        return value_;
+    }
+
+    /**
+     * \brief Derivatives \f$\nabla a\f$. Constants of a Dual with dynamic
+     *        directions have no derivatives.
+     */
+    const Derivatives& derivatives() const
+    {
+        return derivatives_;
+    }
+
+    /**
+     * \return \f$g(a)\f$ given its value and its derivative
+     *         \f$g'(a)\f$ at \f$a\f$, i.e. the Dual
+     *         \f$(g(a), g'(a)\nabla a)\f$
+     */
+    Dual chain(Scalar value, Scalar derivative) const
+    {
+        return Dual(value, derivative * derivatives_);
+    }
+
+public: /* compound assignment */
+    Dual& operator+=(const Dual& b)
+    {
+        combine(Scalar(1), b.derivatives_, Scalar(1));
+        value_ += b.value_;
+        return *this;
+    }
+
+    Dual& operator-=(const Dual& b)
+    {
+        combine(Scalar(1), b.derivatives_, Scalar(-1));
+        value_ -= b.value_;
+        return *this;
+    }
+
+    Dual& operator*=(const Dual& b)
+    {
+        combine(b.value_, b.derivatives_, value_);
+        value_ *= b.value_;
+        return *this;
+    }
+
+    Dual& operator/=(const Dual& b)
+    {
+        const Scalar inv = Scalar(1) / b.value_;
+        combine(inv, b.derivatives_, -value_ * inv * inv);
+        value_ *= inv;
+        return *this;
+    }
+
+    Dual& operator+=(Scalar b)
+    {
+        value_ += b;
+        return *this;
+    }
+
+    Dual& operator-=(Scalar b)
+    {
+        value_ -= b;
+        return *this;
+    }
+
+    Dual& operator*=(Scalar b)
+    {
+        value_ *= b;
+        derivatives_ *= b;
+        return *this;
+    }
+
+    Dual& operator/=(Scalar b)
+    {
+        value_ /= b;
+        derivatives_ /= b;
+        return *this;
+    }
+
+public: /* arithmetic */
+    friend Dual operator+(const Dual& a)
+    {
+        return a;
+    }
+
+    friend Dual operator-(const Dual& a)
+    {
+        return Dual(-a.value_, -a.derivatives_);
+    }
+
+    friend Dual operator+(Dual a, const Dual& b) { return a += b; }
+    friend Dual operator-(Dual a, const Dual& b) { return a -= b; }
+    friend Dual operator*(Dual a, const Dual& b) { return a *= b; }
+    friend Dual operator/(Dual a, const Dual& b) { return a /= b; }
+
+    friend Dual operator+(Dual a, Scalar b) { return a += b; }
+    friend Dual operator-(Dual a, Scalar b) { return a -= b; }
+    friend Dual operator*(Dual a, Scalar b) { return a *= b; }
+    friend Dual operator/(Dual a, Scalar b) { return a /= b; }
+
+    friend Dual operator+(Scalar a, Dual b) { return b += a; }
+    friend Dual operator*(Scalar a, Dual b) { return b *= a; }
+
+    friend Dual operator-(Scalar a, const Dual& b)
+    {
+        return Dual(a - b.value_, -b.derivatives_);
+    }
+
+    friend Dual operator/(Scalar a, const Dual& b)
+    {
+        const Scalar inv = Scalar(1) / b.value_;
+        return b.chain(a * inv, -a * inv * inv);
+    }
+
+public: /* comparison of the values */
+    friend bool operator==(const Dual& a, const Dual& b)
+    {
+        return a.value_ == b.value_;
+    }
+
+    friend bool operator!=(const Dual& a, const Dual& b)
+    {
+        return a.value_ != b.value_;
+    }
+
+    friend bool operator<(const Dual& a, const Dual& b)
+    {
+        return a.value_ < b.value_;
+    }
+
+    friend bool operator>(const Dual& a, const Dual& b)
+    {
+        return a.value_ > b.value_;
+    }
+
+    friend bool operator<=(const Dual& a, const Dual& b)
+    {
+        return a.value_ <= b.value_;
+    }
+
+    friend bool operator>=(const Dual& a, const Dual& b)
+    {
+        return a.value_ >= b.value_;
+    }
+
+public: /* elementary functions */
+    friend Dual abs(const Dual& a)
+    {
+        return a.chain(std::abs(a.value_), a.value_ < 0 ? -1 : 1);
+    }
+
+    friend Dual sqrt(const Dual& a)
+    {
+        const Scalar s = std::sqrt(a.value_);
+        return a.chain(s, Scalar(0.5) / s);
+    }
+
+    friend Dual pow(const Dual& a, Scalar p)
+    {
+        return a.chain(std::pow(a.value_, p),
+                       p * std::pow(a.value_, p - Scalar(1)));
+    }
+
+    friend Dual exp(const Dual& a)
+    {
+        const Scalar e = std::exp(a.value_);
+        return a.chain(e, e);
+    }
+
+    friend Dual log(const Dual& a)
+    {
+        return a.chain(std::log(a.value_), Scalar(1) / a.value_);
+    }
+
+    friend Dual sin(const Dual& a)
+    {
+        return a.chain(std::sin(a.value_), std::cos(a.value_));
+    }
+
+    friend Dual cos(const Dual& a)
+    {
+        return a.chain(std::cos(a.value_), -std::sin(a.value_));
+    }
+
+    friend Dual tan(const Dual& a)
+    {
+        const Scalar t = std::tan(a.value_);
+        return a.chain(t, Scalar(1) + t * t);
+    }
+
+    friend Dual asin(const Dual& a)
+    {
+        return a.chain(std::asin(a.value_),
+                       Scalar(1) / std::sqrt(Scalar(1) - a.value_ * a.value_));
+    }
+
+    friend Dual acos(const Dual& a)
+    {
+        return a.chain(std::acos(a.value_),
+                       Scalar(-1) / std::sqrt(Scalar(1) - a.value_ * a.value_));
+    }
+
+    friend Dual atan(const Dual& a)
+    {
+        return a.chain(std::atan(a.value_),
+                       Scalar(1) / (Scalar(1) + a.value_ * a.value_));
+    }
+
+    friend Dual sinh(const Dual& a)
+    {
+        return a.chain(std::sinh(a.value_), std::cosh(a.value_));
+    }
+
+    friend Dual cosh(const Dual& a)
+    {
+        return a.chain(std::cosh(a.value_), std::sinh(a.value_));
+    }
+
+    friend Dual tanh(const Dual& a)
+    {
+        const Scalar t = std::tanh(a.value_);
+        return a.chain(t, Scalar(1) - t * t);
+    }
+
+    /**
+     * \return \f$\operatorname{atan2}(y, x)\f$ with
+     *         \f$\nabla = (x \nabla y - y \nabla x) / (x^2 + y^2)\f$
+     */
+    friend Dual atan2(const Dual& y, const Dual& x)
+    {
+        const Scalar inv = Scalar(1) / (x.value_ * x.value_ +
+                                        y.value_ * y.value_);
+        Dual result(std::atan2(y.value_, x.value_),
+                    (x.value_ * inv) * y.derivatives_);
+        result.combine(Scalar(1), x.derivatives_, -y.value_ * inv);
+        return result;
+    }
+
+    EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+
+protected:
+    /** \cond internal */
+
+    /**
+     * \brief Sets the derivatives to \f$\alpha\nabla a + \beta\nabla b\f$.
+     *        Missing derivatives of dynamic constants are treated as zero.
+     */
+    void combine(Scalar alpha, const Derivatives& b, Scalar beta)
+    {
+        if (b.size() == 0)
+        {
+            derivatives_ *= alpha;
+        }
+        else if (derivatives_.size() == 0)
+        {
+            derivatives_ = beta * b;
+        }
+        else
+        {
+            derivatives_ = alpha * derivatives_ + beta * b;
+        }
+    }
+
+    Scalar value_;
+    Derivatives derivatives_;
+
+    /** \endcond */
+};
+
+/**
+ * \ingroup automatic_differentiation
+ *
+ * \brief Sets \a dual_x to the independent variables of the values \a x. The
+ *        element \f$x_i\f$ is the variable along the direction
+ *        \a offset \f$+ i\f$ out of \a directions.
+ *
+ * Two vectors, e.g. a state and a noise variate, are differentiated jointly
+ * by assigning them consecutive direction ranges.
+ */
+template <typename Vector, typename DualVector>
+void dual_variables(const Vector& x,
+                    int offset,
+                    int directions,
+                    DualVector& dual_x)
+{
+    if (dual_x.size() != x.size()) dual_x.resize(x.size());
+
+    for (int i = 0; i < x.size(); ++i)
+    {
+        dual_x(i).variable(x(i), offset + i, directions);
+    }
+}
+
+/**
+ * \ingroup automatic_differentiation
+ *
+ * \brief Extracts the values of the Dual vector \a dual_y
+ */
+template <typename DualVector, typename Vector>
+void dual_value(const DualVector& dual_y, Vector& y)
+{
+    if (y.size() != dual_y.size()) y.resize(dual_y.size());
+
+    for (int i = 0; i < dual_y.size(); ++i)
+    {
+        y(i) = dual_y(i).value();
+    }
+}
+
+/**
+ * \ingroup automatic_differentiation
+ *
+ * \brief Extracts the Jacobian of the Dual vector \a dual_y with respect to
+ *        the \a count variables starting at the direction \a offset, see
+ *        dual_variables().
+ */
+template <typename DualVector, typename Jacobian>
+void dual_jacobian(const DualVector& dual_y,
+                   int offset,
+                   int count,
+                   Jacobian& jacobian)
+{
+    if (jacobian.rows() != dual_y.size() || jacobian.cols() != count)
+    {
+        jacobian.resize(dual_y.size(), count);
+    }
+
+    for (int i = 0; i < dual_y.size(); ++i)
+    {
+        auto&& derivatives = dual_y(i).derivatives();
+
+        if (derivatives.size() == 0)
+        {
+            // constant output element
+            jacobian.row(i).setZero();
+            continue;
+        }
+
+        jacobian.row(i) = derivatives.segment(offset, count).transpose();
+    }
+}
+
+}
+
+namespace Eigen
+{
+
+/**
+ * \internal
+ *
+ * \brief Eigen scalar traits of fl::Dual
+ */
+template <typename Scalar, int Directions>
+struct NumTraits<fl::Dual<Scalar, Directions>>
+    : NumTraits<Scalar>
+{
+    typedef fl::Dual<Scalar, Directions> Real;
+    typedef fl::Dual<Scalar, Directions> NonInteger;
+    typedef fl::Dual<Scalar, Directions> Nested;
+    typedef fl::Dual<Scalar, Directions> Literal;
+
+    enum
+    {
+        IsComplex = 0,
+        IsInteger = 0,
+        IsSigned = 1,
+        RequireInitialization = 1,
+        ReadCost = Directions == Dynamic
+                    ? HugeCost
+                    : (Directions + 1) * NumTraits<Scalar>::ReadCost,
+        AddCost = Directions == Dynamic
+                    ? HugeCost
+                    : (Directions + 1) * NumTraits<Scalar>::AddCost,
+        MulCost = Directions == Dynamic
+                    ? HugeCost
+                    : (2 * Directions + 1) * NumTraits<Scalar>::MulCost
+    };
+};
+
+/**
+ * \internal
+ *
+ * \brief Allows mixing fl::Dual and its underlying scalar in Eigen
+ *        expressions
+ */
+template <typename Scalar, int Directions, typename BinaryOp>
+struct ScalarBinaryOpTraits<fl::Dual<Scalar, Directions>, Scalar, BinaryOp>
+{
+    typedef fl::Dual<Scalar, Directions> ReturnType;
+};
+
+/**
+ * \internal
+ *
+ * \copydoc ScalarBinaryOpTraits<fl::Dual<Scalar, Directions>, Scalar, BinaryOp>
+ */
+template <typename Scalar, int Directions, typename BinaryOp>
+struct ScalarBinaryOpTraits<Scalar, fl::Dual<Scalar, Directions>, BinaryOp>
+{
+    typedef fl::Dual<Scalar, Directions> ReturnType;
+};
+
+}
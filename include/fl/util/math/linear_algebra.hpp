@@ -235,13 +235,19 @@ inline Eigen::Matrix<double, 4, 3> quaternion_matrix(
 
 /**
  * \ingroup linear_algebra
- * \todo DOC
+ *
+ * \brief Computes the lower Cholesky factor of \a regular_matrix. The
+ * factorization is performed in place within \a square_root, hence, no
+ * memory is allocated if \a square_root has the correct size already.
  */
 template <typename RegularMatrix, typename SquareRootMatrix>
 void square_root(const RegularMatrix& regular_matrix,
                  SquareRootMatrix& square_root)
 {
-    square_root = regular_matrix.llt().matrixL();
+    square_root = regular_matrix;
+
+    Eigen::LLT<Eigen::Ref<SquareRootMatrix>> llt(square_root);
+    square_root.template triangularView<Eigen::StrictlyUpper>().setZero();
 }
 
 /**
@@ -425,6 +431,116 @@ VectorsB solve(
     return x; //RVO
 }
 
+/**
+ * \ingroup linear_algebra
+ *
+ * \brief Factorization of a symmetric matrix \f$A\f$ such as an innovation
+ * covariance for repeated solves of \f$AX = B\f$.
+ *
+ * The matrix is factorized by a Cholesky decomposition \f$A = LL^T\f$ which
+ * succeeds if \f$A\f$ is numerically positive definite. Otherwise it falls
+ * back to the pivoting \f$LDL^T\f$ decomposition which also copes with
+ * semi-definite matrices. In contrast to solve() the factor is computed only
+ * once for any number of right-hand sides and it keeps its storage between
+ * subsequent compute() calls of the same size.
+ */
+template <typename Matrix>
+class SymmetricFactorization
+{
+public:
+    typedef typename Matrix::Scalar Scalar;
+
+    SymmetricFactorization()
+        : positive_definite_(false)
+    { }
+
+    /**
+     * \brief Factorizes the symmetric matrix \a A of which only the lower
+     *        triangle is accessed
+     */
+    template <typename Derived>
+    void compute(const Eigen::MatrixBase<Derived>& A)
+    {
+        llt_.compute(A);
+        positive_definite_ = (llt_.info() == Eigen::Success);
+
+        if (!positive_definite_) ldlt_.compute(A);
+    }
+
+    /**
+     * \brief Overwrites \a b_and_x with the solution \f$X = A^{-1}B\f$
+     */
+    template <typename Derived>
+    void solve_in_place(Eigen::MatrixBase<Derived>& b_and_x) const
+    {
+        if (positive_definite_)
+        {
+            llt_.solveInPlace(b_and_x);
+        }
+        else
+        {
+            ldlt_.solveInPlace(b_and_x);
+        }
+    }
+
+    /**
+     * \return The quadratic form \f$x^TA^{-1}x\f$
+     */
+    template <typename Derived>
+    Scalar inverse_quadratic_form(const Eigen::MatrixBase<Derived>& x) const
+    {
+        if (positive_definite_)
+        {
+            return llt_.matrixL().solve(x).squaredNorm();
+        }
+
+        return x.dot(ldlt_.solve(x));
+    }
+
+    /**
+     * \return The log. determinant \f$\log|A|\f$. For a singular matrix
+     *         this is \f$-\infty\f$.
+     */
+    Scalar log_determinant() const
+    {
+        if (positive_definite_)
+        {
+            return Scalar(2) * llt_.matrixLLT().diagonal().array().log().sum();
+        }
+
+        return ldlt_.vectorD().array().abs().log().sum();
+    }
+
+    /**
+     * \return The log. density \f$\log {\cal N}(x; 0, A)\f$ of the zero
+     *         mean Gaussian with covariance \f$A\f$, e.g. of an innovation
+     *         \f$x\f$ with the innovation covariance \f$A\f$
+     */
+    template <typename Derived>
+    Scalar log_normal_density(const Eigen::MatrixBase<Derived>& x) const
+    {
+        return -Scalar(0.5) * (inverse_quadratic_form(x)
+                               + log_determinant()
+                               + x.size() * std::log(Scalar(2) * M_PI));
+    }
+
+    /**
+     * \return True if the Cholesky factorization of the last computed matrix
+     *         succeeded
+     */
+    bool positive_definite() const
+    {
+        return positive_definite_;
+    }
+
+protected:
+    /** \cond internal */
+    Eigen::LLT<Matrix> llt_;
+    Eigen::LDLT<Matrix> ldlt_;
+    bool positive_definite_;
+    /** \endcond */
+};
+
 }
 
 
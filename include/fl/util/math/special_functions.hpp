@@ -25,6 +25,7 @@
 #include <cmath>
 #include <vector>
 #include <random>
+#include <type_traits>
 
 #include <iostream>
 
@@ -197,7 +198,325 @@ inline double exponential_integral(double z)
  *
  * \return evaluates the erfinv at \f$ x \in (-1; 1) \f$
  */
-template <typename RealType> inline RealType erfinv(RealType x);
+template <typename RealType>
+inline typename std::enable_if<
+    std::is_floating_point<RealType>::value, RealType
+>::type erfinv(RealType x);
+
+/** \cond internal */
+namespace internal
+{
+
+enum : int { ErfinvCentralCount = 23, ErfinvMiddleCount = 19,
+             ErfinvTailCount = 17 };
+
+/**
+ * \internal
+ * Coefficients of the double precision erfinv approximation
+ * \cite giles2010approximating for \f$w < 6.25\f$, highest order first
+ */
+inline const double* erfinv_central_coefficients()
+{
+    static const double coefficients[ErfinvCentralCount] =
+    {
+        -3.6444120640178196996e-21, -1.685059138182016589e-19,
+        1.2858480715256400167e-18,   1.115787767802518096e-17,
+        -1.333171662854620906e-16,   2.0972767875968561637e-17,
+        6.6376381343583238325e-15,  -4.0545662729752068639e-14,
+        -8.1519341976054721522e-14,  2.6335093153082322977e-12,
+        -1.2975133253453532498e-11, -5.4154120542946279317e-11,
+        1.051212273321532285e-09,   -4.1126339803469836976e-09,
+        -2.9070369957882005086e-08,  4.2347877827932403518e-07,
+        -1.3654692000834678645e-06, -1.3882523362786468719e-05,
+        0.0001867342080340571352,   -0.00074070253416626697512,
+        -0.0060336708714301490533,   0.24015818242558961693,
+        1.6536545626831027356
+    };
+
+    return coefficients;
+}
+
+/**
+ * \internal
+ * Coefficients of the double precision erfinv approximation
+ * \cite giles2010approximating for \f$6.25 \le w < 16\f$, highest order first
+ */
+inline const double* erfinv_middle_coefficients()
+{
+    static const double coefficients[ErfinvMiddleCount] =
+    {
+        2.2137376921775787049e-09,   9.0756561938885390979e-08,
+        -2.7517406297064545428e-07,  1.8239629214389227755e-08,
+        1.5027403968909827627e-06,  -4.013867526981545969e-06,
+        2.9234449089955446044e-06,   1.2475304481671778723e-05,
+        -4.7318229009055733981e-05,  6.8284851459573175448e-05,
+        2.4031110387097893999e-05,  -0.0003550375203628474796,
+        0.00095328937973738049703,  -0.0016882755560235047313,
+        0.0024914420961078508066,   -0.0037512085075692412107,
+        0.005370914553590063617,     1.0052589676941592334,
+        3.0838856104922207635
+    };
+
+    return coefficients;
+}
+
+/**
+ * \internal
+ * Coefficients of the double precision erfinv approximation
+ * \cite giles2010approximating for \f$w \ge 16\f$, highest order first
+ */
+inline const double* erfinv_tail_coefficients()
+{
+    static const double coefficients[ErfinvTailCount] =
+    {
+        -2.7109920616438573243e-11, -2.5556418169965252055e-10,
+        1.5076572693500548083e-09,  -3.7894654401267369937e-09,
+        7.6157012080783393804e-09,  -1.4960026627149240478e-08,
+        2.9147953450901080826e-08,  -6.7711997758452339498e-08,
+        2.2900482228026654717e-07,  -9.9298272942317002539e-07,
+        4.5260625972231537039e-06,  -1.9681778105531670567e-05,
+        7.5995277030017761139e-05,  -0.00021503011930044477347,
+        -0.00013871931833623122026,  1.0103004648645343977,
+        4.8499064014085844221
+    };
+
+    return coefficients;
+}
+
+/**
+ * \internal
+ * Coefficients of \f$\log(\text{erfc}(z)\, e^{z^2} / t)\f$ as a polynomial
+ * in \f$2t - 1\f$ with \f$t = 2 / (2 + z)\f$ and \f$z \ge 0\f$, highest
+ * order first. This is the 28 term Chebyshev series of
+ * \cite press2007numerical converted to the monomial basis which is well
+ * conditioned on \f$[-1; 1]\f$ for this series.
+ */
+enum : int { ErfcPolynomialCount = 28 };
+
+inline const double* erfc_polynomial_coefficients()
+{
+    static const double coefficients[ErfcPolynomialCount] =
+    {
+        -1.8902306008944537e-09,  4.0608821469697202e-09,
+        1.1172352263623759e-08,   -3.9171820510271855e-08,
+        1.4448658046252676e-09,   1.5334345920908177e-07,
+        -2.4958327617196671e-07,  -1.6849800720653297e-07,
+        1.2500276612569754e-06,   -1.2723119048688699e-06,
+        -2.9479868769982591e-06,  8.5626234201212856e-06,
+        1.3772664134464417e-07,   -3.0187884551394243e-05,
+        3.1745179749437403e-05,   7.1401014127570305e-05,
+        -0.00017430294720307621,  -9.3735031170981699e-05,
+        0.00067367879558023498,   -0.00014624686337800336,
+        -0.0023458125004828531,   0.001758933557799016,
+        0.0088249385570606225,    -0.0098726893663899588,
+        -0.046895610231175298,    0.04734330684190443,
+        0.67264322397765675,      -0.67179408405669228
+    };
+
+    return coefficients;
+}
+
+/**
+ * \internal
+ * Taylor coefficients of \f$\text{erf}(x) / x\f$ in \f$x^2\f$, highest order
+ * first
+ */
+enum : int { ErfTaylorCount = 13 };
+
+inline const double* erf_taylor_coefficients()
+{
+    static const double coefficients[ErfTaylorCount] =
+    {
+        9.4227590646504112529e-11, -1.2290555301717928351e-09,
+        1.4807192815879217565e-08, -1.6365844691234924468e-07,
+        1.6462114365889248456e-06, -1.4925650358406250353e-05,
+        1.2055332981789663603e-04, -8.5483270234508533340e-04,
+        5.2239776254421879317e-03, -2.6866170645131252220e-02,
+        1.1283791670955126141e-01, -3.7612638903183753802e-01,
+        1.1283791670955125586e+00
+    };
+
+    return coefficients;
+}
+
+/**
+ * \internal
+ * Evaluates the polynomial with the given coefficients (highest order first)
+ * at \a w using Horner's scheme
+ */
+inline double horner(const double* coefficients, int count, double w)
+{
+    double p = coefficients[0];
+    for (int i = 1; i < count; ++i)
+    {
+        p = coefficients[i] + p * w;
+    }
+    return p;
+}
+
+/**
+ * \internal
+ * Coefficient-wise Horner scheme over an Eigen array
+ */
+template <typename Derived>
+inline typename Derived::PlainObject
+horner(const double* coefficients, int count, const Eigen::ArrayBase<Derived>& w)
+{
+    typedef typename Derived::Scalar Scalar;
+    typedef typename Derived::PlainObject Array;
+
+    Array p = Array::Constant(w.rows(), w.cols(), Scalar(coefficients[0]));
+    for (int i = 1; i < count; ++i)
+    {
+        p = Scalar(coefficients[i]) + p * w;
+    }
+    return p;
+}
+
+/**
+ * \internal
+ * Number of entries processed at once by the coefficient-wise special
+ * functions. The temporaries of a block remain in the L1 cache.
+ */
+enum : int { SpecialFunctionBlockSize = 16 };
+
+/**
+ * \internal
+ * Fixed-size block of entries processed at once
+ */
+template <typename Scalar>
+struct SpecialFunctionBlock
+{
+    typedef Eigen::Array<Scalar, SpecialFunctionBlockSize, 1> Type;
+};
+
+/**
+ * \internal
+ * Evaluates \a x into a plain array and applies the in-place \a kernel to it
+ * block by block. The last partial block is padded with \a padding which
+ * must be a valid argument of the kernel.
+ */
+template <typename Derived, typename Kernel>
+inline typename Derived::PlainObject
+apply_blockwise(const Eigen::ArrayBase<Derived>& x,
+                typename Derived::Scalar padding,
+                Kernel kernel)
+{
+    typedef typename Derived::Scalar Scalar;
+    typedef typename SpecialFunctionBlock<Scalar>::Type Block;
+    typedef Eigen::Array<Scalar, Eigen::Dynamic, 1> Segment;
+
+    typename Derived::PlainObject result = x;
+
+    Scalar* data = result.data();
+    const int size = result.size();
+
+    Block block;
+    int i = 0;
+    for (; i + SpecialFunctionBlockSize <= size;
+         i += SpecialFunctionBlockSize)
+    {
+        Eigen::Map<Block> chunk(data + i);
+        block = chunk;
+        kernel(block);
+        chunk = block;
+    }
+
+    if (i < size)
+    {
+        Eigen::Map<Segment> chunk(data + i, size - i);
+        block.setConstant(padding);
+        block.head(size - i) = chunk;
+        kernel(block);
+        chunk = block.head(size - i);
+    }
+
+    return result;
+}
+
+/**
+ * \internal
+ * In-place erfinv of the block \a x given \f$w = -\log((1-x)(1+x))\f$.
+ * Passing \a w separately allows callers to compute it without the
+ * cancellation in \f$1 \pm x\f$, e.g. fl::uniform_to_normal.
+ *
+ * All entries are evaluated with the central polynomial. The middle and tail
+ * polynomials are only evaluated if at least one entry requires them.
+ */
+template <typename Block>
+inline void erfinv_kernel(Block& x, const Block& w)
+{
+    typedef typename Block::Scalar Scalar;
+
+    Block p = horner(erfinv_central_coefficients(), ErfinvCentralCount,
+                     w - Scalar(3.125));
+
+    if ((w >= Scalar(6.25)).any())
+    {
+        const Block s = w.sqrt();
+
+        const Block p_middle = horner(erfinv_middle_coefficients(),
+                                      ErfinvMiddleCount,
+                                      s - Scalar(3.25));
+
+        const Block p_tail = horner(erfinv_tail_coefficients(),
+                                    ErfinvTailCount,
+                                    s - Scalar(5));
+
+        p = (w < Scalar(6.25)).select(
+                p, (w < Scalar(16)).select(p_middle, p_tail));
+    }
+
+    x *= p;
+}
+
+/**
+ * \internal
+ * In-place erfc of the block \a x, see fl::erfc
+ */
+template <typename Block>
+inline void erfc_kernel(Block& x)
+{
+    typedef typename Block::Scalar Scalar;
+
+    const Block z = x.abs();
+    const Block t = Scalar(2) / (Scalar(2) + z);
+    const Block g = horner(erfc_polynomial_coefficients(), ErfcPolynomialCount,
+                           Scalar(2) * t - Scalar(1));
+
+    const Block r = t * (g - z.square()).exp();
+
+    x = (x < Scalar(0)).select(Scalar(2) - r, r);
+}
+
+/**
+ * \internal
+ * In-place erf of the block \a x, see fl::erf
+ */
+template <typename Block>
+inline void erf_kernel(Block& x)
+{
+    typedef typename Block::Scalar Scalar;
+
+    const Block small =
+        x * horner(erf_taylor_coefficients(), ErfTaylorCount, x.square());
+
+    if ((x.abs() < Scalar(0.5)).all())
+    {
+        x = small;
+        return;
+    }
+
+    Block large = x.abs();
+    erfc_kernel(large);
+    large = (Scalar(1) - large) * x.sign();
+
+    x = (x.abs() < Scalar(0.5)).select(small, large);
+}
+
+}
+/** \endcond */
+
 
 /**
  * Single precision implementation of erfinv according to
@@ -240,15 +559,16 @@ template <> inline float erfinv<float>(float x)
     return p*x;
 }
 
+
 /**
- * Single precision implementation of erfinv according to
+ * Double precision implementation of erfinv according to
  * \cite giles2010approximating
  *
  * \ingroup special_functions
  *
  * \return evaluates the erfinv at \f$ x \in (-1; 1) \f$
  */
-template <> inline  double erfinv<double>(double x)
+template <> inline double erfinv<double>(double x)
 {
     double w, p;
 
@@ -256,79 +576,104 @@ template <> inline  double erfinv<double>(double x)
 
     if ( w < 6.250000 )
     {
-        w = w - 3.125000;
-        p =  -3.6444120640178196996e-21;
-        p =   -1.685059138182016589e-19 + p * w;
-        p =   1.2858480715256400167e-18 + p * w;
-        p =    1.115787767802518096e-17 + p * w;
-        p =   -1.333171662854620906e-16 + p * w;
-        p =   2.0972767875968561637e-17 + p * w;
-        p =   6.6376381343583238325e-15 + p * w;
-        p =  -4.0545662729752068639e-14 + p * w;
-        p =  -8.1519341976054721522e-14 + p * w;
-        p =   2.6335093153082322977e-12 + p * w;
-        p =  -1.2975133253453532498e-11 + p * w;
-        p =  -5.4154120542946279317e-11 + p * w;
-        p =    1.051212273321532285e-09 + p * w;
-        p =  -4.1126339803469836976e-09 + p * w;
-        p =  -2.9070369957882005086e-08 + p * w;
-        p =   4.2347877827932403518e-07 + p * w;
-        p =  -1.3654692000834678645e-06 + p * w;
-        p =  -1.3882523362786468719e-05 + p * w;
-        p =    0.0001867342080340571352 + p * w;
-        p =  -0.00074070253416626697512 + p * w;
-        p =   -0.0060336708714301490533 + p * w;
-        p =      0.24015818242558961693 + p * w;
-        p =       1.6536545626831027356 + p * w;
+        p = internal::horner(internal::erfinv_central_coefficients(),
+                             internal::ErfinvCentralCount,
+                             w - 3.125000);
     }
     else if ( w < 16.000000 )
     {
-        w = std::sqrt(w) - 3.250000;
-        p =   2.2137376921775787049e-09;
-        p =   9.0756561938885390979e-08 + p * w;
-        p =  -2.7517406297064545428e-07 + p * w;
-        p =   1.8239629214389227755e-08 + p * w;
-        p =   1.5027403968909827627e-06 + p * w;
-        p =   -4.013867526981545969e-06 + p * w;
-        p =   2.9234449089955446044e-06 + p * w;
-        p =   1.2475304481671778723e-05 + p * w;
-        p =  -4.7318229009055733981e-05 + p * w;
-        p =   6.8284851459573175448e-05 + p * w;
-        p =   2.4031110387097893999e-05 + p * w;
-        p =   -0.0003550375203628474796 + p * w;
-        p =   0.00095328937973738049703 + p * w;
-        p =   -0.0016882755560235047313 + p * w;
-        p =    0.0024914420961078508066 + p * w;
-        p =   -0.0037512085075692412107 + p * w;
-        p =     0.005370914553590063617 + p * w;
-        p =       1.0052589676941592334 + p * w;
-        p =       3.0838856104922207635 + p * w;
+        p = internal::horner(internal::erfinv_middle_coefficients(),
+                             internal::ErfinvMiddleCount,
+                             std::sqrt(w) - 3.250000);
     }
     else
     {
-        w = std::sqrt(w) - 5.000000;
-        p =  -2.7109920616438573243e-11;
-        p =  -2.5556418169965252055e-10 + p * w;
-        p =   1.5076572693500548083e-09 + p * w;
-        p =  -3.7894654401267369937e-09 + p * w;
-        p =   7.6157012080783393804e-09 + p * w;
-        p =  -1.4960026627149240478e-08 + p * w;
-        p =   2.9147953450901080826e-08 + p * w;
-        p =  -6.7711997758452339498e-08 + p * w;
-        p =   2.2900482228026654717e-07 + p * w;
-        p =  -9.9298272942317002539e-07 + p * w;
-        p =   4.5260625972231537039e-06 + p * w;
-        p =  -1.9681778105531670567e-05 + p * w;
-        p =   7.5995277030017761139e-05 + p * w;
-        p =  -0.00021503011930044477347 + p * w;
-        p =  -0.00013871931833623122026 + p * w;
-        p =       1.0103004648645343977 + p * w;
-        p =       4.8499064014085844221 + p * w;
+        p = internal::horner(internal::erfinv_tail_coefficients(),
+                             internal::ErfinvTailCount,
+                             std::sqrt(w) - 5.000000);
     }
 
     return p*x;
 }
 
+/**
+ * \ingroup special_functions
+ *
+ * Coefficient-wise inverse error function of an Eigen array. The kernel
+ * is the double precision polynomial approximation
+ * \cite giles2010approximating evaluated branch-free on blocks of entries,
+ * with the rarely needed tail polynomials skipped if no entry of a block
+ * requires them.
+ *
+ * The maximum relative error over \f$(-1; 1)\f$ is below
+ * \f$10^{-15}\f$.
+ *
+ * \return evaluates the erfinv at each \f$ x_i \in (-1; 1) \f$
+ */
+template <typename Derived>
+inline typename Derived::PlainObject erfinv(const Eigen::ArrayBase<Derived>& x)
+{
+    typedef typename Derived::Scalar Scalar;
+    typedef typename internal::SpecialFunctionBlock<Scalar>::Type Block;
+
+    return internal::apply_blockwise(
+        x, Scalar(0),
+        [](Block& block)
+        {
+            const Block w =
+                -((Scalar(1) - block) * (Scalar(1) + block)).log();
+            internal::erfinv_kernel(block, w);
+        });
+}
+
+/**
+ * \ingroup special_functions
+ *
+ * Coefficient-wise complementary error function of an Eigen array.
+ *
+ * For \f$z = |x|\f$ the function is evaluated as
+ * \f$\text{erfc}(z) = t \exp(-z^2 + P(2t - 1))\f$ with \f$t = 2 / (2 + z)\f$
+ * and a 28 term series \f$P\f$ \cite press2007numerical, and
+ * \f$\text{erfc}(-z) = 2 - \text{erfc}(z)\f$.
+ *
+ * The relative error is bounded by \f$(4 + z^2)\,\epsilon\f$ where the
+ * \f$z^2 \epsilon\f$ part stems from rounding \f$z^2\f$ in the exponent.
+ * That is, it is below \f$10^{-15}\f$ for \f$|x| \le 2\f$, below
+ * \f$7 \cdot 10^{-15}\f$ for \f$|x| \le 5\f$ and below \f$1.6 \cdot
+ * 10^{-13}\f$ as long as the result is not subnormal, i.e. for
+ * \f$x < 26.5\f$.
+ *
+ * \return \f$\text{erfc}(x_i)\f$ for all entries
+ */
+template <typename Derived>
+inline typename Derived::PlainObject erfc(const Eigen::ArrayBase<Derived>& x)
+{
+    typedef typename Derived::Scalar Scalar;
+    typedef typename internal::SpecialFunctionBlock<Scalar>::Type Block;
+
+    return internal::apply_blockwise(
+        x, Scalar(0), [](Block& block) { internal::erfc_kernel(block); });
 }
 
+/**
+ * \ingroup special_functions
+ *
+ * Coefficient-wise error function of an Eigen array. For \f$|x| < 0.5\f$ a
+ * Taylor polynomial is used, otherwise \f$\text{erf}(x) = \text{sign}(x)
+ * (1 - \text{erfc}(|x|))\f$ with fl::erfc.
+ *
+ * The maximum relative error is below \f$10^{-15}\f$.
+ *
+ * \return \f$\text{erf}(x_i)\f$ for all entries
+ */
+template <typename Derived>
+inline typename Derived::PlainObject erf(const Eigen::ArrayBase<Derived>& x)
+{
+    typedef typename Derived::Scalar Scalar;
+    typedef typename internal::SpecialFunctionBlock<Scalar>::Type Block;
+
+    return internal::apply_blockwise(
+        x, Scalar(0), [](Block& block) { internal::erf_kernel(block); });
+}
 
+}
@@ -21,24 +21,19 @@
 #pragma once
 
 
+#include <cmath>
+#include <cassert>
 #include <ctime>
+#include <atomic>
 #include <chrono>
 #include <random>
+#include <cstdint>
 #include <iostream>
 #include <iomanip>
-/**
- * \brief global seed
- *
- * \ingroup random
- */
-//#ifdef fl_USE_RANDOM_SEED
-//    #define RANDOM_SEED (unsigned int) std::time(0)
-//#else
-//    #define RANDOM_SEED 1
-//#endif
+#include <type_traits>
 
-#undef RANDOM_SEED
-#define RANDOM_SEED (unsigned int) std::time(0)
+#include <fl/util/types.hpp>
+#include <fl/exception/exception.hpp>
 
 namespace fl
 {
@@ -61,23 +56,602 @@ typedef std::mersenne_twister_engine<
 
 /**
  * \ingroup random
- * \brief A seed. If fl_USE_RANDOM_SEED was set true the seed is set to the
- * current time, otherwise, the seed will be 1.
  *
+ * \brief Counter-based random number generator Philox4x32-10
+ * \cite salmon2011parallel.
+ *
+ * The n-th output block of the generator is a pure function of the key, the
+ * stream id and n. A generator is therefore fully determined by the pair
+ * (seed, stream id) and the number of draws taken from it. Generators with
+ * distinct stream ids are statistically independent, which allows each
+ * thread, filter or particle to own its own stream without any shared state.
+ *
+ * The 64 bit seed forms the key. The 128 bit counter holds the 64 bit block
+ * index in the lower and the stream in the upper half. Each block yields four
+ * 32 bit words. The stream half consists of the 62 bit stream id and, in the
+ * two most significant bits, the substream. A sampler which draws from more
+ * than one generator, e.g. fl::TDistribution, gives each generator its own
+ * substream of the caller's stream id. Stream ids which use the reserved bits
+ * are rejected.
+ *
+ * Philox4x32 satisfies the C++11 UniformRandomBitGenerator requirements and
+ * may be used with the standard distributions.
+ */
+class Philox4x32
+{
+public:
+    typedef std::uint32_t result_type;
+
+    static constexpr result_type min() { return 0; }
+    static constexpr result_type max() { return 0xffffffffu; }
+
+    enum : int
+    {
+        SubstreamBits = 2,
+        SubstreamCount = 1 << SubstreamBits
+    };
+
+    /**
+     * \return The largest stream id. The remaining bits of the counter's
+     * stream half are reserved for the substream.
+     */
+    static constexpr std::uint64_t max_stream_id()
+    {
+        return (std::uint64_t(1) << (64 - SubstreamBits)) - 1;
+    }
+
+    /**
+     * \brief Creates the generator of the substream \a substream of the
+     * stream \a stream_id of \a seed
+     */
+    explicit Philox4x32(std::uint64_t seed = 1,
+                        std::uint64_t stream_id = 0,
+                        int substream = 0)
+    {
+        this->seed(seed, stream_id, substream);
+    }
+
+    /**
+     * \brief Resets the generator to the beginning of the substream
+     * \a substream of the stream \a stream_id of \a seed
+     *
+     * \throws Exception if \a stream_id exceeds max_stream_id() or
+     *         \a substream is not within [0, SubstreamCount)
+     */
+    void seed(std::uint64_t seed,
+              std::uint64_t stream_id = 0,
+              int substream = 0)
+    {
+        if (stream_id > max_stream_id())
+        {
+            fl_throw(Exception("Stream id uses the reserved substream bits"));
+        }
+
+        if (substream < 0 || substream >= SubstreamCount)
+        {
+            fl_throw(OutOfBoundsException(substream, SubstreamCount));
+        }
+
+        key_[0] = std::uint32_t(seed);
+        key_[1] = std::uint32_t(seed >> 32);
+        stream_id_ = stream_id;
+        substream_ = substream;
+        block_ = 0;
+        index_ = 4;
+    }
+
+    /**
+     * \return Stream id of this generator
+     */
+    std::uint64_t stream_id() const
+    {
+        return stream_id_;
+    }
+
+    /**
+     * \return Substream of the stream of this generator
+     */
+    int substream() const
+    {
+        return substream_;
+    }
+
+    result_type operator()()
+    {
+        if (index_ == 4)
+        {
+            generate_block(block_++, output_);
+            index_ = 0;
+        }
+
+        return output_[index_++];
+    }
+
+    /**
+     * \brief Advances the generator by \a n draws in constant time
+     */
+    void discard(unsigned long long n)
+    {
+        const unsigned long long buffered = 4 - index_;
+
+        if (n <= buffered)
+        {
+            index_ += int(n);
+            return;
+        }
+
+        n -= buffered;
+        block_ += std::uint64_t(n / 4);
+        index_ = 4;
+
+        if (n % 4)
+        {
+            generate_block(block_++, output_);
+            index_ = int(n % 4);
+        }
+    }
+
+    /**
+     * \brief Computes the output block of the given counter and key.
+     *
+     * This is the raw Philox4x32-10 bijection. It is exposed for known-answer
+     * testing.
+     */
+    static void philox(const std::uint32_t (&counter)[4],
+                       const std::uint32_t (&key)[2],
+                       std::uint32_t (&output)[4])
+    {
+        std::uint32_t c[4] = { counter[0], counter[1], counter[2], counter[3] };
+        std::uint32_t k[2] = { key[0], key[1] };
+
+        for (int round = 0; round < 10; ++round)
+        {
+            if (round > 0)
+            {
+                k[0] += 0x9E3779B9u;
+                k[1] += 0xBB67AE85u;
+            }
+
+            const std::uint64_t p0 = std::uint64_t(0xD2511F53u) * c[0];
+            const std::uint64_t p1 = std::uint64_t(0xCD9E8D57u) * c[2];
+
+            const std::uint32_t c0 = std::uint32_t(p1 >> 32) ^ c[1] ^ k[0];
+            const std::uint32_t c2 = std::uint32_t(p0 >> 32) ^ c[3] ^ k[1];
+
+            c[1] = std::uint32_t(p1);
+            c[3] = std::uint32_t(p0);
+            c[0] = c0;
+            c[2] = c2;
+        }
+
+        output[0] = c[0];
+        output[1] = c[1];
+        output[2] = c[2];
+        output[3] = c[3];
+    }
+
+    friend bool operator==(const Philox4x32& a, const Philox4x32& b)
+    {
+        return a.key_[0] == b.key_[0] && a.key_[1] == b.key_[1]
+               && a.stream_id_ == b.stream_id_
+               && a.substream_ == b.substream_
+               && a.block_ == b.block_ && a.index_ == b.index_;
+    }
+
+    friend bool operator!=(const Philox4x32& a, const Philox4x32& b)
+    {
+        return !(a == b);
+    }
+
+private:
+    void generate_block(std::uint64_t block, std::uint32_t (&output)[4]) const
+    {
+        const std::uint64_t stream =
+            stream_id_
+            | (std::uint64_t(substream_) << (64 - SubstreamBits));
+
+        const std::uint32_t counter[4] =
+        {
+            std::uint32_t(block), std::uint32_t(block >> 32),
+            std::uint32_t(stream), std::uint32_t(stream >> 32)
+        };
+
+        philox(counter, key_, output);
+    }
+
+private:
+    std::uint32_t key_[2];
+    std::uint64_t stream_id_;
+    int substream_;
+    std::uint64_t block_;
+    std::uint32_t output_[4];
+    int index_;
+};
+
+/**
+ * \ingroup random
+ *
+ * \brief Random engine used by all samplers of the library
+ */
+typedef Philox4x32 RandomEngine;
+
+namespace internal
+{
+
+/**
+ * \internal
+ */
+inline std::atomic<std::uint64_t>& random_seed_storage()
+{
+#ifdef fl_USE_RANDOM_SEED
+    static std::atomic<std::uint64_t> seed(std::uint64_t(std::time(0)));
+#else
+    static std::atomic<std::uint64_t> seed(1);
+#endif
+    return seed;
+}
+
+/**
+ * \internal
+ */
+inline std::atomic<std::uint64_t>& stream_id_storage()
+{
+    static std::atomic<std::uint64_t> stream_id(0);
+    return stream_id;
+}
+
+}
+
+/**
+ * \ingroup random
+ *
+ * \return The global seed from which all default constructed samplers draw.
+ * If fl_USE_RANDOM_SEED is defined the seed is initialized with the current
+ * time, otherwise the seed is 1 and runs are reproducible.
+ */
+inline std::uint64_t random_seed()
+{
+    return internal::random_seed_storage().load();
+}
+
+/**
+ * \ingroup random
+ *
+ * \brief Sets the global seed. Only affects samplers created afterwards.
+ */
+inline void random_seed(std::uint64_t seed)
+{
+    internal::random_seed_storage().store(seed);
+}
+
+/**
+ * \ingroup random
+ *
+ * \return A new stream id. Stream ids are handed out by a thread-safe counter
+ * in order of the calls. Default constructed samplers obtain their streams
+ * from here, so a single threaded program is reproducible as is. Samplers
+ * created concurrently should be assigned explicit stream ids to be
+ * independent of the scheduling.
+ *
+ * \throws Exception once the ids exceed Philox4x32::max_stream_id()
+ */
+inline std::uint64_t next_stream_id()
+{
+    const std::uint64_t stream_id = internal::stream_id_storage().fetch_add(1);
+
+    if (stream_id > Philox4x32::max_stream_id())
+    {
+        fl_throw(Exception("Stream ids exhausted"));
+    }
+
+    return stream_id;
+}
+
+/**
+ * \ingroup random
+ *
+ * \brief Resets the stream id counter, e.g. at the beginning of a run
+ */
+inline void reset_stream_ids(std::uint64_t first_stream_id = 0)
+{
+    internal::stream_id_storage().store(first_stream_id);
+}
+
+/**
+ * \ingroup random
+ *
+ * \return A seed for generators which are not stream aware, such as
+ * fl::mt11213b. The seed is derived from the global seed and a new stream id.
+ *
+ * \deprecated Use fl::RandomEngine(fl::random_seed(), fl::next_stream_id())
  */
 inline unsigned int seed()
 {
-//#ifdef fl_USE_RANDOM_SEED
-//    static unsigned int seed_inc = std::time(0);
-//    return seed_inc++;
-//#else
-//    return 1;
-//#endif
-
-    static unsigned int seed_inc = std::time(0);
-    return seed_inc++;
+    RandomEngine engine(random_seed(), next_stream_id());
+
+    return engine();
 }
 
+namespace internal
+{
+
+/**
+ * \internal
+ * \ingroup random
+ *
+ * \brief Layer tables of the 256 layer ziggurat of the standard normal
+ * density \f$f(x) = \exp(-x^2/2)\f$ \cite marsaglia2000ziggurat.
+ *
+ * Layer \f$i\f$ covers \f$[0, x_i] \times [f(x_i), f(x_{i+1})]\f$ and all
+ * layers have the same area. Layer 0 is the base strip which includes the
+ * tail beyond \f$r = x_1\f$. The tables are built once on first use.
+ */
+struct ZigguratTables
+{
+    enum : int { Layers = 256 };
+
+    ZigguratTables()
+    {
+        const Real r = Real(3.6541528853610088);
+        const Real v = Real(4.92867323399e-3);
+
+        x[0] = v / std::exp(Real(-0.5) * r * r);
+        x[1] = r;
+        for (int i = 1; i < Layers - 1; ++i)
+        {
+            x[i + 1] = std::sqrt(
+                Real(-2) * std::log(v / x[i] + std::exp(Real(-0.5) * x[i] * x[i])));
+        }
+        x[Layers] = Real(0);
+
+        for (int i = 0; i <= Layers; ++i)
+        {
+            f[i] = std::exp(Real(-0.5) * x[i] * x[i]);
+        }
+
+        for (int i = 0; i < Layers; ++i)
+        {
+            ratio[i] = x[i + 1] / x[i];
+        }
+    }
+
+    static const ZigguratTables& instance()
+    {
+        static const ZigguratTables tables;
+        return tables;
+    }
+
+    Real x[Layers + 1];
+    Real f[Layers + 1];
+    Real ratio[Layers];
+};
+
 }
 
+/**
+ * \ingroup random
+ *
+ * \brief Ziggurat sampler of standard normal variates
+ * \cite marsaglia2000ziggurat.
+ *
+ * Drop-in replacement for \c std::normal_distribution<Real> with mean 0 and
+ * standard deviation 1. About 99% of the draws are accepted on the fast path
+ * which costs a single 64 bit draw, a table lookup and a multiplication.
+ * Unlike the original RNOR the layer index and the 52 bit abscissa are taken
+ * from disjoint bits of the draw which avoids the correlation reported by
+ * Doornik.
+ *
+ * The generator must produce 32 bit words such as fl::mt11213b.
+ */
+class ZigguratNormalDistribution
+{
+public:
+    typedef Real result_type;
+
+    ZigguratNormalDistribution()
+        : tables_(&internal::ZigguratTables::instance())
+    { }
+
+    /**
+     * \brief Does nothing. The sampler does not cache any state between draws.
+     * Provided for compatibility with \c std::normal_distribution.
+     */
+    void reset() { }
+
+    template <typename Generator>
+    Real operator()(Generator& generator)
+    {
+        static_assert(Generator::max() - Generator::min() == 0xffffffffu,
+                      "ZigguratNormalDistribution requires a 32 bit generator");
+
+        const internal::ZigguratTables& t = *tables_;
+
+        for (;;)
+        {
+            const std::uint64_t bits =
+                (std::uint64_t(generator() - Generator::min()) << 32)
+                | std::uint64_t(generator() - Generator::min());
+
+            const int i = int(bits & 0xff);
+            const Real u = Real(std::int64_t(bits >> 11)
+                                - (std::int64_t(1) << 52))
+                           * Real(2.220446049250313080847e-16); // 2^-52
 
+            if (std::fabs(u) < t.ratio[i]) return u * t.x[i];
+
+            if (i == 0) return tail(generator, u < Real(0));
+
+            const Real x = u * t.x[i];
+            const Real y = t.f[i] + uniform(generator) * (t.f[i + 1] - t.f[i]);
+
+            if (y < std::exp(Real(-0.5) * x * x)) return x;
+        }
+    }
+
+private:
+    /**
+     * \return Uniform variate in the open interval (0, 1)
+     */
+    template <typename Generator>
+    static Real uniform(Generator& generator)
+    {
+        return (Real(generator() - Generator::min()) + Real(0.5))
+               * Real(2.3283064365386962890625e-10); // 2^-32
+    }
+
+    /**
+     * \brief Samples from the normal tail beyond \f$r = x_1\f$ using
+     * Marsaglia's exponential rejection method.
+     */
+    template <typename Generator>
+    Real tail(Generator& generator, bool negative) const
+    {
+        const Real r = tables_->x[1];
+        Real x, y;
+
+        do
+        {
+            x = -std::log(uniform(generator)) / r;
+            y = -std::log(uniform(generator));
+        } while (y + y < x * x);
+
+        return negative ? -(r + x) : r + x;
+    }
+
+private:
+    const internal::ZigguratTables* tables_;
+};
+
+/**
+ * \ingroup random
+ *
+ * \brief Standard normal sampler used by fl::StandardGaussian and thereby by
+ * all distributions which sample by mapping standard normal variates.
+ *
+ * Defaults to fl::ZigguratNormalDistribution. Compile with
+ * \c fl_USE_STD_NORMAL_DISTRIBUTION to fall back to
+ * \c std::normal_distribution<Real>.
+ */
+#ifdef fl_USE_STD_NORMAL_DISTRIBUTION
+typedef std::normal_distribution<Real> StandardNormalDistribution;
+#else
+typedef ZigguratNormalDistribution StandardNormalDistribution;
+#endif
+
+/**
+ * \ingroup random
+ *
+ * \brief Samples \f$\Gamma(\alpha, 1)\f$ distributed variates with shape
+ * \f$\alpha > 0\f$ using the squeeze and rejection method of Marsaglia and
+ * Tsang \cite marsaglia2000simple.
+ *
+ * For \f$\alpha \ge 1\f$ a sample costs one standard normal and one uniform
+ * variate. The rejection rate is below 5% for all \f$\alpha \ge 1\f$ and
+ * the squeeze avoids the logarithms in about 98% of the cases. For
+ * \f$\alpha < 1\f$ a \f$\Gamma(\alpha + 1, 1)\f$ sample is scaled by
+ * \f$U^{1/\alpha}\f$. Scaling \f$\Gamma(k/2, 1)\f$ by 2 yields a
+ * \f$\chi^2_k\f$ variate.
+ *
+ * The generator must produce 32 bit words such as fl::RandomEngine.
+ */
+class StandardGammaDistribution
+{
+public:
+    typedef Real result_type;
+
+    explicit StandardGammaDistribution(Real shape = Real(1))
+    {
+        this->shape(shape);
+    }
+
+    /**
+     * \brief Resets the cached state of the underlying normal sampler
+     */
+    void reset()
+    {
+        normal_.reset();
+    }
+
+    /**
+     * \return The shape parameter \f$\alpha\f$
+     */
+    Real shape() const
+    {
+        return shape_;
+    }
+
+    /**
+     * \brief Sets the shape parameter \f$\alpha > 0\f$
+     */
+    void shape(Real new_shape)
+    {
+        assert(new_shape > Real(0));
+
+        shape_ = new_shape;
+        d_ = (shape_ < Real(1) ? shape_ + Real(1) : shape_) - Real(1) / Real(3);
+        c_ = Real(1) / std::sqrt(Real(9) * d_);
+    }
+
+    template <typename Generator>
+    Real operator()(Generator& generator)
+    {
+        static_assert(Generator::max() - Generator::min() == 0xffffffffu,
+                      "StandardGammaDistribution requires a 32 bit generator");
+
+        Real gamma;
+
+        for (;;)
+        {
+            Real x, v;
+
+            do
+            {
+                x = normal_(generator);
+                v = Real(1) + c_ * x;
+            } while (v <= Real(0));
+
+            v = v * v * v;
+            const Real u = uniform(generator);
+            const Real x2 = x * x;
+
+            // squeeze
+            if (u < Real(1) - Real(0.0331) * x2 * x2)
+            {
+                gamma = d_ * v;
+                break;
+            }
+
+            if (std::log(u) < Real(0.5) * x2 + d_ * (Real(1) - v + std::log(v)))
+            {
+                gamma = d_ * v;
+                break;
+            }
+        }
+
+        if (shape_ < Real(1))
+        {
+            gamma *= std::pow(uniform(generator), Real(1) / shape_);
+        }
+
+        return gamma;
+    }
+
+private:
+    /**
+     * \return Uniform variate in the open interval (0, 1)
+     */
+    template <typename Generator>
+    static Real uniform(Generator& generator)
+    {
+        return (Real(generator() - Generator::min()) + Real(0.5))
+               * Real(2.3283064365386962890625e-10); // 2^-32
+    }
+
+private:
+    Real shape_;
+    Real d_;
+    Real c_;
+    StandardNormalDistribution normal_;
+};
+
+}
@@ -20,6 +20,8 @@
 #pragma once
 
 
+#include <type_traits>
+
 #include <Eigen/Dense>
 
 #include "types.hpp"
@@ -425,6 +427,110 @@ struct RemoveAdditivityOf<NonAdditive<Model>>
     typedef Model Type;
 };
 
+template <typename Model>
+struct RemoveAdditivityOf<Linear<Model>>
+{
+    typedef Model Type;
+};
+
+template <typename Model>
+struct RemoveAdditivityOf<ConditionallyLinear<Model>>
+{
+    typedef Model Type;
+};
+
+/**
+ * \ingroup traits
+ *
+ * \brief Determines whether \a Model is derived from one of the linear
+ *        models such as LinearStateTransitionModel. Only such models may be
+ *        marked as Linear<Model>.
+ */
+template <typename Model> struct IsLinear
+{
+    enum: bool
+    {
+        Value = std::is_base_of<internal::LinearModelType, Model>::value
+    };
+};
+
+/**
+ * \ingroup traits
+ *
+ * \brief Determines whether \a Model is linear in a substate given the
+ *        remaining substate, i.e. whether it is derived from
+ *        ConditionallyLinearStateTransitionFunction or
+ *        ConditionallyLinearObservationFunction
+ */
+template <typename Model> struct IsConditionallyLinear
+{
+    enum: bool
+    {
+        Value = std::is_base_of<
+                    internal::ConditionallyLinearModelType, Model
+                >::value
+    };
+};
+
+/**
+ * \internal
+ * \ingroup traits
+ *
+ * \brief Provides ConditionallyLinear<Model> for conditionally linear models
+ *        and the additivity of the model, see AdditivityOf, otherwise.
+ *        Models which are explicitly marked by Additive,
+ *        AdditiveUncorrelated, NonAdditive or Linear are kept as they are.
+ *
+ * The closed form integration of linear models is opt-in, i.e. a linear
+ * model has to be marked as Linear<Model>. Classes derived from the linear
+ * models may override the virtual model functions with nonlinear ones and
+ * are therefore integrated according to their additivity by default.
+ */
+template <
+    typename Model,
+    bool IsConditionallyLinearModel = IsConditionallyLinear<Model>::Value
+>
+struct LinearityOf
+{
+    typedef typename AdditivityOf<Model>::Type Type;
+};
+
+/**
+ * \internal
+ * \ingroup traits
+ */
+template <typename Model>
+struct LinearityOf<Model, true>
+{
+    typedef ConditionallyLinear<Model> Type;
+};
+
+/**
+ * \internal
+ * \ingroup traits
+ *
+ * Linear models with uncorrelated noise, e.g. the
+ * LinearDecorrelatedGaussianObservationModel, keep AdditiveUncorrelated
+ * since its update exploits the diagonal noise covariance instead of
+ * factorizing the dense innovation covariance.
+ */
+template <typename Model>
+struct LinearityOf<Linear<Model>, false>
+{
+    static_assert(IsLinear<Model>::Value,
+                  "Linear<Model> requires a model derived from a linear "
+                  "model");
+
+    typedef typename std::conditional<
+                std::is_same<
+                    typename AdditivityOf<Model>::Type,
+                    AdditiveUncorrelated<Model>
+                >::value,
+                AdditiveUncorrelated<Model>,
+                Linear<Model>
+            >::type Type;
+};
+
 /**
  * \internal
  *
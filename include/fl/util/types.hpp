@@ -75,6 +75,29 @@ template <typename Model_> struct NonAdditive
     typedef Model_ Model;
 };
 
+/**
+ * \ingroup types
+ *
+ * \brief Marks a linear model, e.g. a LinearStateTransitionModel, of which
+ *        the moments are propagated in closed form
+ */
+template <typename Model_> struct Linear
+{
+    typedef Model_ Model;
+};
+
+/**
+ * \ingroup types
+ *
+ * \brief Marks a model which is linear in a substate of the state given the
+ *        remaining nonlinear substate, e.g. a
+ *        ConditionallyLinearStateTransitionFunction
+ */
+template <typename Model_> struct ConditionallyLinear
+{
+    typedef Model_ Model;
+};
+
 /**
  * \internal
  */
@@ -89,6 +112,24 @@ namespace internal
  */
 struct LinearModelType { };
 
+/**
+ * \internal
+ * \ingroup types
+ *
+ * \brief Conditionally linear model type identifier
+ */
+struct ConditionallyLinearModelType { };
+
+/**
+ * \internal
+ * \ingroup types
+ *
+ * \brief Identifies prediction policies which propagate the moments of the
+ * belief directly, e.g. in closed form or by linearization. These provide no
+ * predicted points.
+ */
+struct MomentPredictionPolicyType { };
+
 /**
  * \internal
  * \ingroup types
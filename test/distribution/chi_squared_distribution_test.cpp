@@ -122,12 +122,58 @@ TYPED_TEST_P(ChiSquaredTests, map_standard_uniform)
     }
 }
 
+TYPED_TEST_P(ChiSquaredTests, sample_moments)
+{
+    typedef TestFixture This;
+
+    auto chi2 = fl::ChiSquared(This::DegreesOfFreedom);
+
+    Eigen::Array<fl::Real, Eigen::Dynamic, 1> samples(200000);
+    chi2.fill(samples);
+
+    const fl::Real k = This::DegreesOfFreedom;
+    const fl::Real mean = samples.mean();
+    const fl::Real variance = (samples - mean).square().mean();
+
+    // mean k and variance 2k
+    EXPECT_NEAR(mean, k, 0.02 * k);
+    EXPECT_NEAR(variance, 2 * k, 0.05 * 2 * k);
+
+    EXPECT_GT(samples.minCoeff(), 0.0);
+}
+
+TYPED_TEST_P(ChiSquaredTests, sample_distribution)
+{
+    typedef TestFixture This;
+
+    auto chi2 = fl::ChiSquared(This::DegreesOfFreedom);
+    auto reference =
+        boost::math::chi_squared_distribution<fl::Real>(This::DegreesOfFreedom);
+
+    const int n = 100000;
+    Eigen::Array<fl::Real, Eigen::Dynamic, 1> samples(n);
+    for (int i = 0; i < n; ++i)
+    {
+        samples(i) = chi2.sample();
+    }
+
+    // compare the empirical CDF at a few quantiles against the exact one
+    for (fl::Real p: { 0.01, 0.1, 0.25, 0.5, 0.75, 0.9, 0.99 })
+    {
+        const fl::Real x = boost::math::quantile(reference, p);
+        const fl::Real p_hat = (samples <= x).count() / fl::Real(n);
+
+        EXPECT_NEAR(p_hat, p, 5.0 * std::sqrt(p * (1.0 - p) / n));
+    }
+}
 
 REGISTER_TYPED_TEST_CASE_P(ChiSquaredTests,
                            initial_degrees_of_freedom,
                            degrees_of_freedom,
                            probability,
-                           map_standard_uniform);
+                           map_standard_uniform,
+                           sample_moments,
+                           sample_distribution);
 
 template <int DOF>
 struct TestConfiguration
@@ -213,7 +213,80 @@ TEST(discrete_distribution, sampling_index)
 }
 
 
+TEST(discrete_distribution, map_standard_normal_batch)
+{
+    typedef Eigen::Matrix<int, 1, 1> Variate;
+    typedef fl::DiscreteDistribution<Variate> DiscreteDistribution;
+    typedef DiscreteDistribution::Function Function;
+
+    int N_locations = 10;
+
+    Function pmf = Function::Random(N_locations).abs() + 0.01;
+
+    DiscreteDistribution discrete_distribution;
+    discrete_distribution.log_unnormalized_prob_mass(pmf.log());
+
+    for(int i = 0; i < N_locations; i++)
+        discrete_distribution.location(i)(0) = i;
+
+    Eigen::Array<fl::Real, Eigen::Dynamic, 1> gaussian_samples =
+        4.0 * Eigen::Array<fl::Real, Eigen::Dynamic, 1>::Random(1000);
+
+    DiscreteDistribution::IndexArray indices;
+    discrete_distribution.map_standard_normal(gaussian_samples, indices);
+
+    ASSERT_EQ(indices.size(), gaussian_samples.size());
+
+    for(int i = 0; i < gaussian_samples.size(); i++)
+    {
+        int index;
+        fl::ScalarMatrix sample(gaussian_samples(i));
+        Variate location =
+            discrete_distribution.map_standard_normal(sample, index);
+
+        EXPECT_EQ(indices(i), index);
+        EXPECT_EQ(location(0), indices(i));
+    }
 
+    // uniform variates beyond the accumulated mass select the last location
+    discrete_distribution.map_standard_uniform(
+        Eigen::Array<fl::Real, 2, 1>(0.0, 1.0 + 1e-12), indices);
 
+    EXPECT_EQ(indices(0), 0);
+    EXPECT_EQ(indices(1), N_locations - 1);
+}
+
+TEST(discrete_distribution, from_discrete_distribution)
+{
+    typedef Eigen::Matrix<int, 1, 1> Variate;
+    typedef fl::DiscreteDistribution<Variate> DiscreteDistribution;
+    typedef DiscreteDistribution::Function Function;
+
+    int N_locations = 4;
+    int N_samples = 100000;
+
+    Function pmf(N_locations);
+    pmf << 0.1, 0.2, 0.3, 0.4;
+
+    DiscreteDistribution discrete_distribution(N_locations);
+    discrete_distribution.log_unnormalized_prob_mass(pmf.log());
+
+    for(int i = 0; i < N_locations; i++)
+        discrete_distribution.location(i)(0) = i;
+
+    // resample in-place
+    discrete_distribution.from_distribution(discrete_distribution, N_samples);
 
+    ASSERT_EQ(discrete_distribution.size(), N_samples);
 
+    Function frequency = Function::Zero(N_locations);
+    for(int i = 0; i < N_samples; i++)
+    {
+        frequency(discrete_distribution.location(i)(0)) += 1.0 / N_samples;
+    }
+
+    for(int i = 0; i < N_locations; i++)
+    {
+        EXPECT_NEAR(frequency(i), pmf(i), 0.01);
+    }
+}
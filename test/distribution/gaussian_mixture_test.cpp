@@ -0,0 +1,200 @@
+/*
+ * This is part of the fl library, a C++ Bayesian filtering library
+ * (https://github.com/filtering-library)
+ *
+ * Copyright (c) 2015 Max Planck Society,
+ * 				 Autonomous Motion Department,
+ * 			     Institute for Intelligent Systems
+ *
+ * This Source Code Form is subject to the terms of the MIT License (MIT).
+ * A copy of the license can be found in the LICENSE file distributed with this
+ * source code.
+ */
+
+/**
+ * \file gaussian_mixture_test.cpp
+ * \date October 2026
+ * \author agent (agent@local)
+ */
+
+#include <gtest/gtest.h>
+
+#include <Eigen/Dense>
+
+#include <cmath>
+#include <limits>
+#include <algorithm>
+
+#include <fl/util/types.hpp>
+#include <fl/exception/exception.hpp>
+#include <fl/distribution/gaussian_mixture.hpp>
+
+typedef Eigen::Matrix<fl::Real, 2, 1> Vector;
+typedef Eigen::Matrix<fl::Real, 2, 2> Matrix;
+
+class GaussianMixtureTests
+    : public testing::Test
+{
+public:
+    typedef fl::GaussianMixture<Vector> Mixture;
+    typedef Mixture::Component Component;
+
+    GaussianMixtureTests()
+    {
+        Component a;
+        a.mean(Vector(-2.0, 1.0));
+        Matrix cov_a; cov_a << 1.0, 0.3, 0.3, 0.5;
+        a.covariance(cov_a);
+
+        Component b;
+        b.mean(Vector(3.0, -1.0));
+        Matrix cov_b; cov_b << 0.4, -0.1, -0.1, 2.0;
+        b.covariance(cov_b);
+
+        Component c;
+        c.mean(Vector(0.5, 4.0));
+        c.covariance(Matrix::Identity() * 0.2);
+
+        // unnormalized weights
+        mixture.add_component(a, 2.0);
+        mixture.add_component(b, 5.0);
+        mixture.add_component(c, 3.0);
+    }
+
+    Mixture mixture;
+};
+
+TEST_F(GaussianMixtureTests, weights_are_normalized)
+{
+    EXPECT_EQ(mixture.count(), 3);
+    EXPECT_NEAR(mixture.weights()(0), 0.2, 1.e-12);
+    EXPECT_NEAR(mixture.weights()(1), 0.5, 1.e-12);
+    EXPECT_NEAR(mixture.weights()(2), 0.3, 1.e-12);
+
+    EXPECT_THROW(mixture.weights(Mixture::Weights::Zero(3)), fl::Exception);
+    EXPECT_THROW(mixture.weights(Mixture::Weights::Ones(2)), fl::Exception);
+}
+
+TEST_F(GaussianMixtureTests, moments)
+{
+    Vector mean = Vector::Zero();
+    for (int k = 0; k < 3; ++k)
+    {
+        mean += mixture.weights()(k) * mixture.component(k).mean();
+    }
+
+    Matrix second = Matrix::Zero();
+    for (int k = 0; k < 3; ++k)
+    {
+        const Component& c = mixture.component(k);
+        second += mixture.weights()(k)
+                  * (c.covariance() + c.mean() * c.mean().transpose());
+    }
+
+    EXPECT_TRUE(mixture.mean().isApprox(mean, 1.e-12));
+    EXPECT_TRUE(mixture.covariance().isApprox(
+                    second - mean * mean.transpose(), 1.e-12));
+
+    // replacing a component invalidates the cached moments
+    Component moved = mixture.component(0);
+    moved.mean(Vector(10.0, 10.0));
+    mixture.component(0, moved);
+    EXPECT_NEAR(mixture.mean()(0), mean(0) + 0.2 * 12.0, 1.e-12);
+}
+
+TEST_F(GaussianMixtureTests, log_probability)
+{
+    const Vector x(0.3, -0.2);
+
+    fl::Real p = 0;
+    for (int k = 0; k < 3; ++k)
+    {
+        p += mixture.weights()(k) * mixture.component(k).probability(x);
+    }
+
+    EXPECT_NEAR(mixture.log_probability(x), std::log(p), 1.e-12);
+
+    // far from all components the direct sum underflows whereas the
+    // log-sum-exp evaluation remains finite and dominated by the most
+    // likely component
+    const Vector far(60.0, -1.0);
+    fl::Real expected = -std::numeric_limits<fl::Real>::infinity();
+    for (int k = 0; k < 3; ++k)
+    {
+        expected = std::max(expected,
+                            std::log(mixture.weights()(k))
+                            + mixture.component(k).log_probability(far));
+    }
+
+    EXPECT_EQ(mixture.probability(far), 0.0);
+
+    EXPECT_TRUE(std::isfinite(mixture.log_probability(far)));
+    EXPECT_NEAR(mixture.log_probability(far), expected, 1.e-9);
+}
+
+TEST_F(GaussianMixtureTests, batch_matches_single)
+{
+    Eigen::Matrix<fl::Real, 2, Eigen::Dynamic> points =
+        4.0 * Eigen::Matrix<fl::Real, 2, Eigen::Dynamic>::Random(2, 50);
+    points.col(0) = Vector(60.0, -1.0);
+
+    auto log_probs = mixture.log_probabilities(points);
+
+    ASSERT_EQ(log_probs.size(), 50);
+    for (int i = 0; i < points.cols(); ++i)
+    {
+        EXPECT_NEAR(log_probs(i),
+                    mixture.log_probability(points.col(i)),
+                    1.e-9 * std::fabs(log_probs(i)) + 1.e-12);
+    }
+}
+
+TEST_F(GaussianMixtureTests, alias_selection_frequencies)
+{
+    Eigen::Array<fl::Real, Eigen::Dynamic, 1> selectors(100000);
+    fl::StandardGaussian<fl::Real>().fill(selectors);
+
+    Eigen::Array<fl::Real, 3, 1> frequencies =
+        Eigen::Array<fl::Real, 3, 1>::Zero();
+    for (int i = 0; i < selectors.size(); ++i)
+    {
+        frequencies(mixture.select_component(selectors(i))) += 1;
+    }
+    frequencies /= selectors.size();
+
+    for (int k = 0; k < 3; ++k)
+    {
+        const fl::Real w = mixture.weights()(k);
+        EXPECT_NEAR(frequencies(k), w,
+                    5.0 * std::sqrt(w * (1.0 - w) / selectors.size()));
+    }
+}
+
+TEST_F(GaussianMixtureTests, sample_moments)
+{
+    const int n = 100000;
+
+    Vector mean = Vector::Zero();
+    Matrix second = Matrix::Zero();
+    for (int i = 0; i < n; ++i)
+    {
+        const Vector x = mixture.sample();
+        mean += x;
+        second += x * x.transpose();
+    }
+    mean /= n;
+    second /= n;
+
+    EXPECT_TRUE(fl::are_similar(mean, mixture.mean(), 0.05));
+    EXPECT_TRUE(fl::are_similar(second - mean * mean.transpose(),
+                                mixture.covariance(), 0.15));
+}
+
+TEST(GaussianMixtureEmptyTests, throws)
+{
+    fl::GaussianMixture<Vector> mixture;
+
+    EXPECT_THROW(mixture.mean(), fl::Exception);
+    EXPECT_THROW(mixture.select_component(0.0), fl::Exception);
+    EXPECT_TRUE(std::isinf(mixture.log_probability(Vector::Zero())));
+}
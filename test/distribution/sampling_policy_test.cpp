@@ -0,0 +1,104 @@
+/*
+ * This is part of the fl library, a C++ Bayesian filtering library
+ * (https://github.com/filtering-library)
+ *
+ * Copyright (c) 2015 Max Planck Society,
+ * 				 Autonomous Motion Department,
+ * 			     Institute for Intelligent Systems
+ *
+ * This Source Code Form is subject to the terms of the MIT License (MIT).
+ * A copy of the license can be found in the LICENSE file distributed with this
+ * source code.
+ */
+
+/**
+ * \file sampling_policy_test.cpp
+ * \date October 2026
+ * \author agent (agent@local)
+ */
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <vector>
+
+#include <fl/util/math.hpp>
+#include <fl/distribution/sampling_policy.hpp>
+#include <fl/distribution/standard_gaussian.hpp>
+
+typedef Eigen::Matrix<fl::Real, Eigen::Dynamic, 1> Vector;
+typedef Eigen::Matrix<fl::Real, Eigen::Dynamic, Eigen::Dynamic> Matrix;
+
+/**
+ * Root mean squared error of the estimate of E[sum_k exp(x_k / 2)] under
+ * N(0, I) over a number of independent repetitions
+ */
+template <typename SamplingPolicy>
+fl::Real rms_error(int dimension, int count)
+{
+    const int repetitions = 200;
+    const fl::Real expected = dimension * std::exp(0.125);
+
+    fl::StandardGaussian<Vector> standard_gaussian;
+    Matrix samples(dimension, count);
+
+    fl::Real squared_error = 0;
+    for (int r = 0; r < repetitions; ++r)
+    {
+        SamplingPolicy::fill(standard_gaussian, samples);
+
+        const fl::Real estimate = (samples.array() * 0.5).exp().sum() / count;
+        squared_error += std::pow(estimate - expected, 2);
+    }
+
+    return std::sqrt(squared_error / repetitions);
+}
+
+TEST(SamplingPolicyTests, antithetic_pairs)
+{
+    fl::StandardGaussian<Vector> standard_gaussian;
+    Matrix samples(3, 11);
+
+    fl::AntitheticSamplingPolicy::fill(standard_gaussian, samples);
+
+    for (int k = 0; k < 5; ++k)
+    {
+        EXPECT_TRUE(samples.col(2 * k + 1) == -samples.col(2 * k));
+    }
+
+    EXPECT_NEAR(samples.leftCols(10).rowwise().sum().norm(), 0.0, 1.e-12);
+}
+
+TEST(SamplingPolicyTests, latin_hypercube_strata)
+{
+    const int count = 50;
+
+    fl::StandardGaussian<Vector> standard_gaussian;
+    Matrix samples(4, count);
+
+    fl::LatinHypercubeSamplingPolicy::fill(standard_gaussian, samples);
+
+    for (int k = 0; k < samples.rows(); ++k)
+    {
+        std::vector<int> hits(count, 0);
+
+        for (int i = 0; i < count; ++i)
+        {
+            const fl::Real u = fl::normal_to_uniform(samples(k, i));
+            hits[std::min(int(u * count), count - 1)]++;
+        }
+
+        for (int stratum = 0; stratum < count; ++stratum)
+        {
+            EXPECT_EQ(hits[stratum], 1);
+        }
+    }
+}
+
+TEST(SamplingPolicyTests, variance_reduction)
+{
+    const fl::Real iid = rms_error<fl::IidSamplingPolicy>(3, 100);
+
+    EXPECT_LT(rms_error<fl::AntitheticSamplingPolicy>(3, 100), 0.5 * iid);
+    EXPECT_LT(rms_error<fl::LatinHypercubeSamplingPolicy>(3, 100), 0.5 * iid);
+}
@@ -0,0 +1,107 @@
+/*
+ * This is part of the fl library, a C++ Bayesian filtering library
+ * (https://github.com/filtering-library)
+ *
+ * Copyright (c) 2015 Max Planck Society,
+ * 				 Autonomous Motion Department,
+ * 			     Institute for Intelligent Systems
+ *
+ * This Source Code Form is subject to the terms of the MIT License (MIT).
+ * A copy of the license can be found in the LICENSE file distributed with this
+ * source code.
+ */
+
+/**
+ * \file standard_gaussian_test.cpp
+ * \date October 2026
+ * \author agent (agent@local)
+ */
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <iostream>
+
+#include <fl/util/math.hpp>
+#include <fl/distribution/standard_gaussian.hpp>
+
+typedef Eigen::Matrix<fl::Real, Eigen::Dynamic, 1> DynamicVector;
+typedef Eigen::Matrix<fl::Real, Eigen::Dynamic, Eigen::Dynamic> DynamicMatrix;
+
+TEST(StandardGaussianTests, sample_dimension)
+{
+    fl::StandardGaussian<DynamicVector> standard_gaussian(7);
+
+    EXPECT_EQ(standard_gaussian.sample().rows(), 7);
+    EXPECT_EQ(standard_gaussian.sample().cols(), 1);
+}
+
+TEST(StandardGaussianTests, fill_moments)
+{
+    fl::StandardGaussian<DynamicVector> standard_gaussian(10);
+
+    DynamicMatrix samples(10, 100000);
+    standard_gaussian.fill(samples);
+
+    auto x = samples.array();
+    const fl::Real n = x.size();
+
+    const fl::Real mean = x.sum() / n;
+    const fl::Real variance = (x - mean).square().sum() / n;
+    const fl::Real kurtosis = (x - mean).pow(4).sum() / n
+                              / (variance * variance);
+
+    EXPECT_NEAR(mean, 0.0, 0.005);
+    EXPECT_NEAR(variance, 1.0, 0.01);
+    EXPECT_NEAR(kurtosis, 3.0, 0.05);
+}
+
+TEST(StandardGaussianTests, fill_distribution)
+{
+    fl::StandardGaussian<DynamicVector> standard_gaussian(1);
+
+    DynamicMatrix samples(1000, 1000);
+    standard_gaussian.fill(samples);
+
+    const fl::Real n = samples.size();
+
+    // compare the empirical CDF against the exact one, including the tail
+    // beyond the ziggurat base layer (x > 3.654)
+    for (fl::Real t = -4.0; t <= 4.0; t += 0.25)
+    {
+        const fl::Real p = fl::normal_to_uniform(t);
+        const fl::Real p_hat = (samples.array() <= t).count() / n;
+
+        EXPECT_NEAR(p_hat, p, 5.0 * std::sqrt(p * (1.0 - p) / n) + 1.e-5);
+    }
+}
+
+TEST(StandardGaussianTests, fill_scalar)
+{
+    fl::StandardGaussian<fl::Real> standard_gaussian;
+
+    DynamicMatrix samples(100, 1000);
+    standard_gaussian.fill(samples);
+
+    const fl::Real mean = samples.mean();
+    const fl::Real variance = (samples.array() - mean).square().mean();
+
+    EXPECT_NEAR(mean, 0.0, 0.015);
+    EXPECT_NEAR(variance, 1.0, 0.03);
+}
+
+TEST(StandardGaussianTests, fill_block)
+{
+    fl::StandardGaussian<DynamicVector> standard_gaussian(3);
+    fl::StandardGaussian<fl::Real> scalar_standard_gaussian;
+
+    DynamicMatrix samples = DynamicMatrix::Zero(3, 4);
+    standard_gaussian.fill(samples.col(1));
+    scalar_standard_gaussian.fill(samples.col(3).head(2));
+
+    EXPECT_TRUE(samples.col(0).isZero());
+    EXPECT_TRUE(samples.col(2).isZero());
+    EXPECT_EQ(samples(2, 3), 0.0);
+    EXPECT_TRUE((samples.col(1).array() != 0.0).all());
+    EXPECT_TRUE((samples.col(3).head(2).array() != 0.0).all());
+}
@@ -145,3 +145,141 @@ typedef ::testing::Types<
 INSTANTIATE_TYPED_TEST_CASE_P(TDistributionTestCases,
                               TDistributionTests,
                               TestTypes);
+
+TEST(TDistributionSamplingTests, fill_moments)
+{
+    typedef Eigen::Matrix<fl::Real, 3, 1> Variate;
+    typedef Eigen::Matrix<fl::Real, 3, 3> Covariance;
+
+    const fl::Real dof = 6;
+    auto t_distr = fl::TDistribution<Variate>(dof);
+
+    Variate location;
+    location << 1, -2, 3;
+
+    Covariance scaling;
+    scaling << 2.0, 0.5, 0.0,
+               0.5, 1.0, 0.2,
+               0.0, 0.2, 3.0;
+
+    t_distr.location(location);
+    t_distr.scaling_matrix(scaling);
+
+    const int n = 400000;
+    Eigen::Matrix<fl::Real, 3, Eigen::Dynamic> samples(3, n);
+    t_distr.fill(samples);
+
+    Variate mean = samples.rowwise().mean();
+    Covariance covariance =
+        (samples.colwise() - mean) * (samples.colwise() - mean).transpose() / n;
+
+    // the covariance of a t-distribution is dof / (dof - 2) * scaling
+    EXPECT_TRUE(mean.isApprox(location, 0.01));
+    EXPECT_TRUE(covariance.isApprox(dof / (dof - 2) * scaling, 0.05));
+}
+
+TEST(TDistributionSamplingTests, sample_matches_mapping)
+{
+    typedef Eigen::Matrix<fl::Real, 2, 1> Variate;
+
+    const fl::Real dof = 3;
+    auto t_distr = fl::TDistribution<Variate>(dof);
+
+    Variate location;
+    location << 5, -5;
+    t_distr.location(location);
+
+    // the fast path and the standard normal mapping sample the same
+    // distribution. Compare the marginal CDFs at the location.
+    const int n = 50000;
+    fl::Real below_sampled = 0;
+    fl::Real below_mapped = 0;
+
+    fl::StandardGaussian<Eigen::Matrix<fl::Real, 3, 1>> standard_gaussian;
+
+    for (int i = 0; i < n; ++i)
+    {
+        below_sampled += (t_distr.sample()(0) < location(0));
+        below_mapped +=
+            (t_distr.map_standard_normal(standard_gaussian.sample())(0)
+             < location(0));
+    }
+
+    EXPECT_NEAR(below_sampled / n, 0.5, 0.01);
+    EXPECT_NEAR(below_mapped / n, 0.5, 0.01);
+}
+
+TEST(TDistributionLogProbabilityTests, univariate_reference)
+{
+    typedef Eigen::Matrix<fl::Real, 1, 1> Variate;
+
+    const fl::Real dof = 4;
+    const fl::Real location = 1.5;
+    const fl::Real scale = 2.0;
+
+    auto t_distr = fl::TDistribution<Variate>(dof);
+    t_distr.location(Variate::Constant(location));
+    t_distr.scaling_matrix(Variate::Constant(scale * scale));
+
+    boost::math::students_t_distribution<fl::Real> reference(dof);
+
+    Eigen::Matrix<fl::Real, 1, Eigen::Dynamic> points =
+        Eigen::Matrix<fl::Real, 1, Eigen::Dynamic>::LinSpaced(101, -20, 20);
+
+    auto log_probabilities = t_distr.log_probabilities(points);
+
+    ASSERT_EQ(log_probabilities.size(), points.cols());
+
+    for (int i = 0; i < points.cols(); ++i)
+    {
+        const fl::Real expected = std::log(
+            boost::math::pdf(reference, (points(i) - location) / scale) / scale);
+
+        EXPECT_NEAR(log_probabilities(i), expected, 1.e-12);
+        EXPECT_NEAR(t_distr.log_probability(points.col(i)), expected, 1.e-12);
+    }
+}
+
+TEST(TDistributionLogProbabilityTests, batch_matches_single)
+{
+    typedef Eigen::Matrix<fl::Real, Eigen::Dynamic, 1> Variate;
+    typedef Eigen::Matrix<fl::Real, Eigen::Dynamic, Eigen::Dynamic> Matrix;
+
+    const int dim = 5;
+    const fl::Real dof = 3;
+
+    auto t_distr = fl::TDistribution<Variate>(dof, dim);
+
+    Matrix a = Matrix::Random(dim, dim);
+    Matrix scaling = a * a.transpose() + Matrix::Identity(dim, dim);
+    Variate location = Variate::Random(dim);
+
+    t_distr.scaling_matrix(scaling);
+    t_distr.location(location);
+
+    Matrix points = 3 * Matrix::Random(dim, 200);
+
+    auto log_probabilities = t_distr.log_probabilities(points);
+
+    const fl::Real log_normalizer =
+        std::lgamma((dof + dim) / 2) - std::lgamma(dof / 2)
+        - dim / 2.0 * std::log(M_PI * dof)
+        - 0.5 * std::log(scaling.determinant());
+
+    for (int i = 0; i < points.cols(); ++i)
+    {
+        Variate z = points.col(i) - location;
+        const fl::Real quad_term = z.dot(scaling.inverse() * z);
+        const fl::Real expected =
+            log_normalizer - (dof + dim) / 2 * std::log(1 + quad_term / dof);
+
+        EXPECT_NEAR(log_probabilities(i), expected, 1.e-10);
+        EXPECT_NEAR(t_distr.log_probability(points.col(i)), expected, 1.e-10);
+    }
+
+    // moving the location keeps the cached factor valid
+    t_distr.location(Variate::Zero(dim));
+    auto moved = t_distr.log_probabilities((points.colwise() - location).eval());
+
+    EXPECT_TRUE(moved.isApprox(log_probabilities, 1.e-12));
+}
@@ -0,0 +1,29 @@
+/*
+ * This is part of the fl library, a C++ Bayesian filtering library
+ * (https://github.com/filtering-library)
+ *
+ * Copyright (c) 2015 Max Planck Society,
+ * 				 Autonomous Motion Department,
+ * 			     Institute for Intelligent Systems
+ *
+ * This Source Code Form is subject to the terms of the MIT License (MIT).
+ * A copy of the license can be found in the LICENSE file distributed with this
+ * source code.
+ */
+
+/**
+ * \file cubature_transform_test.cpp
+ * \date October 2026
+ * \author agent (agent@local)
+ */
+
+#include <gtest/gtest.h>
+
+#include <Eigen/Dense>
+
+#include <fl/filter/gaussian/transform/cubature_transform.hpp>
+
+TEST(CubatureTransformTest, number_of_points)
+{
+    EXPECT_EQ(fl::CubatureTransform::number_of_points(7), 2 * 7);
+}
@@ -0,0 +1,491 @@
+/*
+ * This is part of the fl library, a C++ Bayesian filtering library
+ * (https://github.com/filtering-library)
+ *
+ * Copyright (c) 2015 Max Planck Society,
+ * 				 Autonomous Motion Department,
+ * 			     Institute for Intelligent Systems
+ *
+ * This Source Code Form is subject to the terms of the MIT License (MIT).
+ * A copy of the license can be found in the LICENSE file distributed with this
+ * source code.
+ */
+
+/**
+ * \file extended_kalman_filter_test.cpp
+ * \date October 2026
+ * \author agent (agent@local)
+ */
+
+#include <gtest/gtest.h>
+
+#include <Eigen/Dense>
+
+#include "gaussian_filter_test_helpers.hpp"
+
+#include <cmath>
+
+#include <fl/util/types.hpp>
+#include <fl/util/descriptor.hpp>
+#include <fl/util/math/linear_algebra.hpp>
+#include <fl/filter/gaussian/gaussian_filter.hpp>
+#include <fl/model/process/linear_state_transition_model.hpp>
+#include <fl/model/observation/linear_gaussian_observation_model.hpp>
+#include <fl/model/observation/linear_decorrelated_gaussian_observation_model.hpp>
+#include <fl/model/process/interface/additive_state_transition_function.hpp>
+#include <fl/model/observation/interface/additive_observation_function.hpp>
+
+using namespace fl;
+
+enum : signed int
+{
+    StateDim = 2,
+    InputDim = 1,
+    ObsrvDim = 2,
+    Steps = 10
+};
+
+static constexpr Real dt = 0.05;
+
+typedef Eigen::Matrix<Real, InputDim, 1> Input;
+
+struct ModelEvaluations
+{
+    static int& count() { static int evaluations = 0; return evaluations; }
+};
+
+/**
+ * Pendulum \f$x_{t+1} = f(x_t, u_t) + v_t\f$ written generically in its
+ * scalar type
+ */
+template <int Size>
+class PendulumTransition
+    : public AdditiveStateTransitionFunction<
+                 Eigen::Matrix<Real, Size, 1>,
+                 Eigen::Matrix<Real, Size, 1>,
+                 Input>,
+      public Descriptor
+{
+public:
+    typedef Eigen::Matrix<Real, Size, 1> State;
+    typedef typename AdditiveStateTransitionFunction<
+                State, State, Input
+            >::NoiseMatrix NoiseMatrix;
+
+    PendulumTransition()
+        : noise_matrix_(NoiseMatrix::Identity(StateDim, StateDim) * 0.1),
+          noise_covariance_(noise_matrix_ * noise_matrix_.transpose())
+    { }
+
+    template <typename S>
+    Eigen::Matrix<S, Size, 1> expected_state(
+        const Eigen::Matrix<S, Size, 1>& x, const Input& u) const
+    {
+        using std::sin;
+
+        ++ModelEvaluations::count();
+
+        Eigen::Matrix<S, Size, 1> x_next = x;
+        x_next(0) = x(0) + dt * x(1);
+        x_next(1) = x(1) - dt * 9.81 * sin(x(0)) + dt * u(0);
+        return x_next;
+    }
+
+    State expected_state(const State& x, const Input& u) const override
+    {
+        return expected_state<Real>(x, u);
+    }
+
+    const NoiseMatrix& noise_matrix() const override
+    {
+        return noise_matrix_;
+    }
+
+    const NoiseMatrix& noise_covariance() const override
+    {
+        return noise_covariance_;
+    }
+
+    int state_dimension() const override { return StateDim; }
+    int noise_dimension() const override { return StateDim; }
+    int input_dimension() const override { return InputDim; }
+
+    std::string name() const override { return "PendulumTransition"; }
+    std::string description() const override { return "Pendulum"; }
+
+private:
+    NoiseMatrix noise_matrix_;
+    NoiseMatrix noise_covariance_;
+};
+
+/**
+ * Range and bearing \f$y = h(x) + w\f$ of a landmark at \f$(-2, 0)\f$
+ */
+template <int Size>
+class RangeBearingSensor
+    : public AdditiveObservationFunction<
+                 Eigen::Matrix<Real, ObsrvDim, 1>,
+                 Eigen::Matrix<Real, Size, 1>,
+                 Gaussian<Eigen::Matrix<Real, ObsrvDim, 1>>>,
+      public Descriptor
+{
+public:
+    typedef Eigen::Matrix<Real, Size, 1> State;
+    typedef Eigen::Matrix<Real, ObsrvDim, 1> Obsrv;
+    typedef typename AdditiveObservationFunction<
+                Obsrv, State, Gaussian<Obsrv>
+            >::NoiseMatrix NoiseMatrix;
+
+    RangeBearingSensor()
+        : noise_matrix_(NoiseMatrix::Identity() * 0.3),
+          noise_covariance_(noise_matrix_ * noise_matrix_.transpose())
+    { }
+
+    template <typename S>
+    Eigen::Matrix<S, ObsrvDim, 1> expected_observation(
+        const Eigen::Matrix<S, Size, 1>& x) const
+    {
+        using std::sqrt;
+        using std::atan2;
+
+        ++ModelEvaluations::count();
+
+        Eigen::Matrix<S, ObsrvDim, 1> y;
+        y(0) = sqrt(1.0 + (2.0 + x(0)) * (2.0 + x(0)) + x(1) * x(1));
+        y(1) = atan2(x(1), 2.0 + x(0));
+        return y;
+    }
+
+    Obsrv expected_observation(const State& x) const override
+    {
+        return expected_observation<Real>(x);
+    }
+
+    NoiseMatrix noise_matrix() const override
+    {
+        return noise_matrix_;
+    }
+
+    NoiseMatrix noise_covariance() const override
+    {
+        return noise_covariance_;
+    }
+
+    int state_dimension() const override { return StateDim; }
+    int noise_dimension() const override { return ObsrvDim; }
+    int obsrv_dimension() const override { return ObsrvDim; }
+
+    std::string name() const override { return "RangeBearingSensor"; }
+    std::string description() const override { return "Range and bearing"; }
+
+private:
+    NoiseMatrix noise_matrix_;
+    NoiseMatrix noise_covariance_;
+};
+
+/**
+ * Non-additive form \f$f(x, v, u) = f(x, u) + Nv\f$ of the pendulum
+ */
+class NonAdditivePendulumTransition
+    : public StateTransitionFunction<
+                 Eigen::Matrix<Real, StateDim, 1>,
+                 Eigen::Matrix<Real, StateDim, 1>,
+                 Input>,
+      public Descriptor
+{
+public:
+    typedef Eigen::Matrix<Real, StateDim, 1> State;
+    typedef Eigen::Matrix<Real, StateDim, 1> Noise;
+
+    template <typename S>
+    Eigen::Matrix<S, StateDim, 1> state(
+        const Eigen::Matrix<S, StateDim, 1>& x,
+        const Eigen::Matrix<S, StateDim, 1>& v,
+        const Input& u) const
+    {
+        return additive_.expected_state(x, u) + additive_.noise_matrix() * v;
+    }
+
+    State state(const State& x, const Noise& v, const Input& u) const override
+    {
+        return state<Real>(x, v, u);
+    }
+
+    int state_dimension() const override { return StateDim; }
+    int noise_dimension() const override { return StateDim; }
+    int input_dimension() const override { return InputDim; }
+
+    std::string name() const override { return "NonAdditivePendulum"; }
+    std::string description() const override { return "Pendulum"; }
+
+private:
+    PendulumTransition<StateDim> additive_;
+};
+
+/**
+ * Non-additive form \f$h(x, w) = h(x) + Nw\f$ of the range and bearing sensor
+ */
+class NonAdditiveRangeBearingSensor
+    : public ObservationFunction<
+                 Eigen::Matrix<Real, ObsrvDim, 1>,
+                 Eigen::Matrix<Real, StateDim, 1>,
+                 Eigen::Matrix<Real, ObsrvDim, 1>>,
+      public Descriptor
+{
+public:
+    typedef Eigen::Matrix<Real, StateDim, 1> State;
+    typedef Eigen::Matrix<Real, ObsrvDim, 1> Obsrv;
+    typedef Eigen::Matrix<Real, ObsrvDim, 1> Noise;
+
+    template <typename S>
+    Eigen::Matrix<S, ObsrvDim, 1> observation(
+        const Eigen::Matrix<S, StateDim, 1>& x,
+        const Eigen::Matrix<S, ObsrvDim, 1>& w) const
+    {
+        return additive_.expected_observation(x)
+               + additive_.noise_matrix() * w;
+    }
+
+    Obsrv observation(const State& x, const Noise& w) const override
+    {
+        return observation<Real>(x, w);
+    }
+
+    int state_dimension() const override { return StateDim; }
+    int noise_dimension() const override { return ObsrvDim; }
+    int obsrv_dimension() const override { return ObsrvDim; }
+
+    std::string name() const override { return "NonAdditiveRangeBearing"; }
+    std::string description() const override { return "Range and bearing"; }
+
+private:
+    RangeBearingSensor<StateDim> additive_;
+};
+
+typedef Eigen::Matrix<Real, StateDim, 1> State;
+typedef Eigen::Matrix<Real, ObsrvDim, 1> Obsrv;
+typedef Eigen::Matrix<Real, StateDim, StateDim> StateMatrix;
+
+typedef GaussianFilter<
+            PendulumTransition<StateDim>,
+            RangeBearingSensor<StateDim>,
+            AutoDiffLinearization
+        > ExtendedKalmanFilter;
+
+Obsrv observation(int step)
+{
+    return Obsrv(2.2 + 0.1 * std::sin(step), 0.05 * step);
+}
+
+/**
+ * Extended Kalman filter step using the analytic Jacobians of the models
+ *
+ * \return Log. likelihood of \a y under the linearized observation model
+ */
+Real reference_step(Gaussian<State>& belief, const Input& u, const Obsrv& y)
+{
+    PendulumTransition<StateDim> transition;
+    RangeBearingSensor<StateDim> sensor;
+
+    State x = belief.mean();
+    StateMatrix F;
+    F << 1.0,                         dt,
+         -dt * 9.81 * std::cos(x(0)), 1.0;
+
+    StateMatrix cov = F * belief.covariance() * F.transpose()
+                      + transition.noise_covariance();
+    x = transition.expected_state(x, u);
+
+    const Real a = 2.0 + x(0);
+    const Real r2 = a * a + x(1) * x(1);
+    const Real r = std::sqrt(1.0 + r2);
+
+    Eigen::Matrix<Real, ObsrvDim, StateDim> H;
+    H << a / r,       x(1) / r,
+         -x(1) / r2,  a / r2;
+
+    const Eigen::Matrix<Real, ObsrvDim, ObsrvDim> S =
+        H * cov * H.transpose() + sensor.noise_covariance();
+    const Eigen::Matrix<Real, StateDim, ObsrvDim> K =
+        cov * H.transpose() * S.inverse();
+
+    Gaussian<Obsrv> prediction;
+    prediction.mean(sensor.expected_observation(x));
+    prediction.covariance(S);
+
+    belief.mean(x + K * (y - sensor.expected_observation(x)));
+    belief.covariance(cov - K * H * cov);
+
+    return prediction.log_probability(y);
+}
+
+TEST(ExtendedKalmanFilterTests, matches_analytic_linearization)
+{
+    auto filter = ExtendedKalmanFilter(
+        PendulumTransition<StateDim>(), RangeBearingSensor<StateDim>());
+
+    auto belief = filter.create_belief();
+    auto reference_belief = filter.create_belief();
+
+    const Input u = Input::Ones();
+
+    for (int i = 0; i < Steps; ++i)
+    {
+        const Obsrv y = observation(i);
+
+        filter.predict(belief, u, belief);
+        filter.update(belief, y, belief);
+        const Real log_likelihood = reference_step(reference_belief, u, y);
+
+        ASSERT_TRUE(fl::are_similar(belief.mean(), reference_belief.mean()));
+        ASSERT_TRUE(fl::are_similar(belief.covariance(),
+                                    reference_belief.covariance()));
+        ASSERT_NEAR(filter.log_likelihood(), log_likelihood, 1.e-9);
+    }
+}
+
+TEST(ExtendedKalmanFilterTests, single_model_evaluation_per_step)
+{
+    auto filter = ExtendedKalmanFilter(
+        PendulumTransition<StateDim>(), RangeBearingSensor<StateDim>());
+
+    auto belief = filter.create_belief();
+
+    ModelEvaluations::count() = 0;
+    for (int i = 0; i < Steps; ++i)
+    {
+        filter.predict(belief, Input::Ones(), belief);
+        filter.update(belief, observation(i), belief);
+    }
+
+    // one linearization of each model per step instead of one evaluation
+    // per sigma point
+    EXPECT_EQ(2 * Steps, ModelEvaluations::count());
+}
+
+TEST(ExtendedKalmanFilterTests, dynamic_size_matches_fixed_size)
+{
+    typedef GaussianFilter<
+                PendulumTransition<Eigen::Dynamic>,
+                RangeBearingSensor<Eigen::Dynamic>,
+                AutoDiffLinearization
+            > DynamicFilter;
+
+    auto filter = DynamicFilter(
+        PendulumTransition<Eigen::Dynamic>(),
+        RangeBearingSensor<Eigen::Dynamic>());
+    auto reference_filter = ExtendedKalmanFilter(
+        PendulumTransition<StateDim>(), RangeBearingSensor<StateDim>());
+
+    expect_same_beliefs(
+        filter, reference_filter, Input::Ones(), observation, Steps);
+}
+
+TEST(ExtendedKalmanFilterTests, non_additive_models_match_additive_models)
+{
+    typedef GaussianFilter<
+                NonAdditivePendulumTransition,
+                NonAdditiveRangeBearingSensor,
+                AutoDiffLinearization
+            > NonAdditiveFilter;
+
+    auto filter = NonAdditiveFilter(
+        NonAdditivePendulumTransition(), NonAdditiveRangeBearingSensor());
+    auto reference_filter = ExtendedKalmanFilter(
+        PendulumTransition<StateDim>(), RangeBearingSensor<StateDim>());
+
+    expect_same_beliefs(
+        filter, reference_filter, Input::Ones(), observation, Steps);
+}
+
+TEST(ExtendedKalmanFilterTests, linear_models_match_kalman_filter)
+{
+    typedef Eigen::Matrix<Real, Eigen::Dynamic, 1> Vector;
+    typedef LinearStateTransitionModel<Vector, Vector> Transition;
+    typedef LinearGaussianObservationModel<Vector, Vector> Sensor;
+
+    Transition transition(StateDim, InputDim);
+    Sensor sensor(ObsrvDim, StateDim);
+
+    transition.dynamics_matrix(
+        transition.create_dynamics_matrix().setRandom() * 0.5);
+    sensor.sensor_matrix(sensor.create_sensor_matrix().setRandom());
+
+    auto filter = GaussianFilter<
+                      Linear<Transition>, Linear<Sensor>, AutoDiffLinearization
+                  >(transition, sensor);
+    auto reference_filter = GaussianFilter<Transition, Sensor>(
+        transition, sensor);
+
+    auto belief = filter.create_belief();
+    auto reference_belief = reference_filter.create_belief();
+
+    const Vector u = Vector::Ones(InputDim);
+
+    for (int i = 0; i < Steps; ++i)
+    {
+        const Vector y = observation(i);
+
+        filter.predict(belief, u, belief);
+        filter.update(belief, y, belief);
+
+        reference_filter.predict(reference_belief, u, reference_belief);
+        reference_filter.update(reference_belief, y, reference_belief);
+
+        ASSERT_TRUE(fl::are_similar(belief.mean(), reference_belief.mean()));
+        ASSERT_TRUE(fl::are_similar(belief.covariance(),
+                                    reference_belief.covariance()));
+    }
+}
+
+/**
+ * Linear model with uncorrelated noise whose expected observation is
+ * additionally written generically in order to be linearized
+ */
+class GenericLinearSensor
+    : public LinearDecorrelatedGaussianObservationModel<Obsrv, State>
+{
+public:
+    typedef LinearDecorrelatedGaussianObservationModel<Obsrv, State> Base;
+
+    using Base::expected_observation;
+
+    template <typename S>
+    Eigen::Matrix<S, ObsrvDim, 1> expected_observation(
+        const Eigen::Matrix<S, StateDim, 1>& x) const
+    {
+        return this->sensor_matrix() * x;
+    }
+};
+
+TEST(ExtendedKalmanFilterTests, uncorrelated_noise_matches_sigma_point_filter)
+{
+    typedef LinearStateTransitionModel<State, Input> Transition;
+
+    Transition transition;
+    transition.dynamics_matrix(
+        transition.create_dynamics_matrix().setRandom() * 0.5);
+
+    GenericLinearSensor sensor;
+    sensor.sensor_matrix(GenericLinearSensor::SensorMatrix::Random());
+
+    auto R = sensor.noise_diagonal_covariance();
+    R.diagonal() = Obsrv::Random().array().abs() + Real(0.1);
+    sensor.noise_diagonal_covariance(R);
+
+    // linearizing the linear model is exact as is the sigma point update
+    auto filter = GaussianFilter<
+                      Linear<Transition>,
+                      AdditiveUncorrelated<GenericLinearSensor>,
+                      AutoDiffLinearization
+                  >(transition, sensor);
+
+    auto reference_filter = GaussianFilter<
+                                Transition,
+                                AdditiveUncorrelated<GenericLinearSensor>,
+                                UnscentedQuadrature
+                            >(transition, sensor, UnscentedQuadrature());
+
+    expect_same_beliefs(
+        filter, reference_filter, Input::Ones(), observation, Steps);
+}
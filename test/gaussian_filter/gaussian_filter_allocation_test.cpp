@@ -0,0 +1,368 @@
+/*
+ * This is part of the fl library, a C++ Bayesian filtering library
+ * (https://github.com/filtering-library)
+ *
+ * Copyright (c) 2015 Max Planck Society,
+ * 				 Autonomous Motion Department,
+ * 			     Institute for Intelligent Systems
+ *
+ * This Source Code Form is subject to the terms of the MIT License (MIT).
+ * A copy of the license can be found in the LICENSE file distributed with this
+ * source code.
+ */
+
+/**
+ * \file gaussian_filter_allocation_test.cpp
+ * \date October 2026
+ * \author agent (agent@local)
+ */
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+
+/*
+ * Eigen allocates through std::malloc rather than operator new. With
+ * EIGEN_RUNTIME_NO_MALLOC each of its heap allocations is checked by an
+ * assertion which is redirected here to count them while counting is enabled.
+ * All replaced global allocation functions below share allocate() and
+ * deallocate() such that every path is counted alike.
+ */
+namespace allocation_counter
+{
+bool enabled = false;
+int heap_allocations = 0;
+
+inline void eigen_assertion(bool condition,
+                            const char* expression,
+                            const char* file,
+                            int line)
+{
+    if (condition) return;
+
+    if (std::strstr(expression, "heap allocation is forbidden"))
+    {
+        ++heap_allocations;
+        return;
+    }
+
+    std::fprintf(
+        stderr, "%s:%d: Assertion failed: %s\n", file, line, expression);
+    std::abort();
+}
+
+inline void* allocate(std::size_t size) noexcept
+{
+    if (enabled) ++heap_allocations;
+
+    return std::malloc(size > 0 ? size : 1);
+}
+
+/*
+ * Kept out of line such that the compiler does not pair the std::free with
+ * the operator new of the caller of operator delete.
+ */
+#ifdef __GNUC__
+__attribute__((noinline))
+#endif
+void deallocate(void* memory) noexcept
+{
+    std::free(memory);
+}
+}
+
+#define EIGEN_RUNTIME_NO_MALLOC
+#define eigen_assert(x) \
+    allocation_counter::eigen_assertion(bool(x), #x, __FILE__, __LINE__)
+
+void* operator new(std::size_t size)
+{
+    void* memory = allocation_counter::allocate(size);
+    if (!memory) throw std::bad_alloc();
+
+    return memory;
+}
+
+void* operator new[](std::size_t size)
+{
+    void* memory = allocation_counter::allocate(size);
+    if (!memory) throw std::bad_alloc();
+
+    return memory;
+}
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept
+{
+    return allocation_counter::allocate(size);
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept
+{
+    return allocation_counter::allocate(size);
+}
+
+void operator delete(void* memory) noexcept
+{
+    allocation_counter::deallocate(memory);
+}
+
+void operator delete[](void* memory) noexcept
+{
+    allocation_counter::deallocate(memory);
+}
+
+void operator delete(void* memory, const std::nothrow_t&) noexcept
+{
+    allocation_counter::deallocate(memory);
+}
+
+void operator delete[](void* memory, const std::nothrow_t&) noexcept
+{
+    allocation_counter::deallocate(memory);
+}
+
+#ifdef __cpp_sized_deallocation
+void operator delete(void* memory, std::size_t) noexcept
+{
+    allocation_counter::deallocate(memory);
+}
+
+void operator delete[](void* memory, std::size_t) noexcept
+{
+    allocation_counter::deallocate(memory);
+}
+#endif
+
+#include <gtest/gtest.h>
+
+#include <Eigen/Dense>
+
+#include "gaussian_filter_test_helpers.hpp"
+
+#include <fl/util/types.hpp>
+#include <fl/filter/gaussian/gaussian_filter.hpp>
+#include <fl/model/process/linear_state_transition_model.hpp>
+#include <fl/model/observation/linear_gaussian_observation_model.hpp>
+
+using namespace fl;
+
+/**
+ * \brief Counts the heap allocations of the enclosing scope
+ */
+class AllocationScope
+{
+public:
+    AllocationScope()
+    {
+        allocation_counter::heap_allocations = 0;
+        allocation_counter::enabled = true;
+        Eigen::internal::set_is_malloc_allowed(false);
+    }
+
+    ~AllocationScope()
+    {
+        stop();
+    }
+
+    int stop()
+    {
+        Eigen::internal::set_is_malloc_allowed(true);
+        allocation_counter::enabled = false;
+        return allocation_counter::heap_allocations;
+    }
+};
+
+enum : signed int
+{
+    StateDim = 6,
+    InputDim = 1,
+    ObsrvDim = 4,
+    Steps = 10
+};
+
+/**
+ * \return Number of heap allocations of the filter steps following the
+ *         first one
+ */
+template <typename Filter>
+int count_steady_state_allocations(Filter& filter)
+{
+    typedef typename Filter::Obsrv Obsrv;
+    typedef typename Filter::Input Input;
+
+    auto belief = filter.create_belief();
+    const Obsrv y = Obsrv::Random(filter.obsrv_model().obsrv_dimension());
+    const Input u = Input::Zero(filter.process_model().input_dimension());
+
+    // the first step sizes all workspaces
+    filter.predict(belief, u, belief);
+    filter.update(belief, y, belief);
+
+    AllocationScope scope;
+    for (int i = 0; i < Steps; ++i)
+    {
+        filter.predict(belief, u, belief);
+        filter.update(belief, y, belief);
+    }
+    return scope.stop();
+}
+
+TEST(GaussianFilterAllocationTests, kalman_filter_dynamic_size)
+{
+    typedef Eigen::Matrix<Real, Eigen::Dynamic, 1> Vector;
+    typedef GaussianFilter<
+                LinearStateTransitionModel<Vector, Vector>,
+                LinearGaussianObservationModel<Vector, Vector>
+            > Filter;
+
+    auto filter = Filter(
+        LinearStateTransitionModel<Vector, Vector>(StateDim, InputDim),
+        LinearGaussianObservationModel<Vector, Vector>(ObsrvDim, StateDim));
+    setup_models(filter);
+
+    EXPECT_EQ(0, count_steady_state_allocations(filter));
+}
+
+TEST(GaussianFilterAllocationTests, sigma_point_filter_fixed_size)
+{
+    typedef Eigen::Matrix<Real, StateDim, 1> State;
+    typedef Eigen::Matrix<Real, InputDim, 1> Input;
+    typedef Eigen::Matrix<Real, ObsrvDim, 1> Obsrv;
+
+    typedef LinearStateTransitionModel<State, Input> Transition;
+    typedef LinearGaussianObservationModel<Obsrv, State> Sensor;
+    typedef GaussianFilter<Transition, Sensor, UnscentedQuadrature> Filter;
+
+    auto filter = Filter(Transition(), Sensor(), UnscentedQuadrature());
+    setup_models(filter);
+
+    EXPECT_EQ(0, count_steady_state_allocations(filter));
+}
+
+/*
+ * The batch model interface returns the propagated points in a matrix of a
+ * dynamic number of columns. This result is the only allocation of each
+ * non-additive prediction and update.
+ */
+TEST(GaussianFilterAllocationTests, sigma_point_filter_non_additive)
+{
+    typedef Eigen::Matrix<Real, StateDim, 1> State;
+    typedef Eigen::Matrix<Real, InputDim, 1> Input;
+    typedef Eigen::Matrix<Real, ObsrvDim, 1> Obsrv;
+
+    typedef LinearStateTransitionModel<State, Input> Transition;
+    typedef LinearGaussianObservationModel<Obsrv, State> Sensor;
+    typedef GaussianFilter<
+                Transition,
+                Sensor,
+                UnscentedQuadrature,
+                SigmaPointPredictPolicy<
+                    UnscentedQuadrature, NonAdditive<Transition>>,
+                SigmaPointUpdatePolicy<
+                    UnscentedQuadrature, NonAdditive<Sensor>>
+            > Filter;
+
+    auto filter = Filter(Transition(), Sensor(), UnscentedQuadrature());
+    setup_models(filter);
+
+    EXPECT_EQ(2 * Steps, count_steady_state_allocations(filter));
+}
+
+TEST(GaussianFilterAllocationTests, sigma_point_filter_linear_models)
+{
+    typedef Eigen::Matrix<Real, Eigen::Dynamic, 1> Vector;
+    typedef GaussianFilter<
+                Linear<LinearStateTransitionModel<Vector, Vector>>,
+                Linear<LinearGaussianObservationModel<Vector, Vector>>,
+                UnscentedQuadrature
+            > Filter;
+
+    auto filter = Filter(
+        LinearStateTransitionModel<Vector, Vector>(StateDim, InputDim),
+        LinearGaussianObservationModel<Vector, Vector>(ObsrvDim, StateDim),
+        UnscentedQuadrature());
+    setup_models(filter);
+
+    EXPECT_EQ(0, count_steady_state_allocations(filter));
+}
+
+/*
+ * Dynamic-size models return their results by value and take their arguments
+ * as complete vectors. The following models count their evaluations and the
+ * heap allocations made within them in order to separate them from the
+ * allocations of the filter.
+ */
+typedef Eigen::Matrix<Real, Eigen::Dynamic, 1> DynamicVector;
+
+struct ModelAllocations
+{
+    static int& evaluations() { static int count = 0; return count; }
+    static int& allocations() { static int count = 0; return count; }
+
+    template <typename F>
+    static auto evaluate(F&& f) -> decltype(f())
+    {
+        const int before = allocation_counter::heap_allocations;
+        decltype(f()) result = f();
+        allocations() += allocation_counter::heap_allocations - before;
+        ++evaluations();
+        return result;
+    }
+};
+
+class CountingTransition
+    : public LinearStateTransitionModel<DynamicVector, DynamicVector>
+{
+public:
+    typedef LinearStateTransitionModel<DynamicVector, DynamicVector> Base;
+
+    CountingTransition() : Base(StateDim, InputDim) { }
+
+    State expected_state(const State& state,
+                         const Input& input) const override
+    {
+        return ModelAllocations::evaluate(
+            [&]() { return Base::expected_state(state, input); });
+    }
+};
+
+class CountingSensor
+    : public LinearGaussianObservationModel<DynamicVector, DynamicVector>
+{
+public:
+    typedef LinearGaussianObservationModel<DynamicVector, DynamicVector> Base;
+
+    CountingSensor() : Base(ObsrvDim, StateDim) { }
+
+    Obsrv expected_observation(const State& state) const override
+    {
+        return ModelAllocations::evaluate(
+            [&]() { return Base::expected_observation(state); });
+    }
+};
+
+TEST(GaussianFilterAllocationTests, sigma_point_filter_dynamic_size)
+{
+    typedef GaussianFilter<
+                CountingTransition, CountingSensor, UnscentedQuadrature
+            > Filter;
+
+    auto filter = Filter(
+        CountingTransition(), CountingSensor(), UnscentedQuadrature());
+    setup_models(filter);
+
+    ModelAllocations::evaluations() = 0;
+    ModelAllocations::allocations() = 0;
+
+    const int allocations = count_steady_state_allocations(filter);
+    const int point_count = UnscentedQuadrature::number_of_points(StateDim);
+
+    EXPECT_EQ((Steps + 1) * 2 * point_count, ModelAllocations::evaluations());
+
+    // apart from the models, the filter only materializes the sigma point
+    // passed to each model evaluation and the observation noise covariance
+    // which the model interface returns by value
+    EXPECT_EQ(Steps * (2 * point_count + 1),
+              allocations - ModelAllocations::allocations());
+}
@@ -0,0 +1,134 @@
+/*
+ * This is part of the fl library, a C++ Bayesian filtering library
+ * (https://github.com/filtering-library)
+ *
+ * Copyright (c) 2015 Max Planck Society,
+ * 				 Autonomous Motion Department,
+ * 			     Institute for Intelligent Systems
+ *
+ * This Source Code Form is subject to the terms of the MIT License (MIT).
+ * A copy of the license can be found in the LICENSE file distributed with this
+ * source code.
+ */
+
+/**
+ * \file gaussian_filter_predict_and_update_test.cpp
+ * \date October 2026
+ * \author agent (agent@local)
+ */
+
+#include <gtest/gtest.h>
+
+#include <Eigen/Dense>
+
+#include "gaussian_filter_test_helpers.hpp"
+
+#include <fl/util/types.hpp>
+#include <fl/filter/gaussian/gaussian_filter.hpp>
+#include <fl/model/process/linear_state_transition_model.hpp>
+#include <fl/model/observation/linear_gaussian_observation_model.hpp>
+#include <fl/model/observation/linear_decorrelated_gaussian_observation_model.hpp>
+
+using namespace fl;
+
+enum : signed int
+{
+    StateDim = 4,
+    InputDim = 1,
+    ObsrvDim = 3,
+    Steps = 10
+};
+
+typedef Eigen::Matrix<Real, StateDim, 1> State;
+typedef Eigen::Matrix<Real, InputDim, 1> Input;
+typedef Eigen::Matrix<Real, ObsrvDim, 1> Obsrv;
+
+typedef LinearStateTransitionModel<State, Input> Transition;
+typedef LinearGaussianObservationModel<Obsrv, State> Sensor;
+typedef LinearDecorrelatedGaussianObservationModel<Obsrv, State>
+        DecorrelatedSensor;
+
+typedef GaussianFilter<Transition, Sensor> KalmanFilter;
+
+/**
+ * Runs predict_and_update() on \a filter and predict() followed by update() on
+ * the \a reference_filter and expects the same beliefs in each step
+ */
+template <typename Filter, typename ReferenceFilter>
+void expect_same_fused_beliefs(Filter& filter,
+                               ReferenceFilter& reference_filter)
+{
+    setup_models(filter);
+    setup_models(reference_filter);
+
+    expect_same_beliefs(filter,
+                        reference_filter,
+                        Input::Zero(),
+                        random_observation<Obsrv>,
+                        Steps,
+                        true);
+}
+
+TEST(GaussianFilterPredictAndUpdateTests, reuse_disabled_by_default)
+{
+    typedef GaussianFilter<Transition, Sensor, UnscentedQuadrature> Filter;
+
+    auto filter = Filter(Transition(), Sensor(), UnscentedQuadrature());
+    auto reference_filter =
+        Filter(Transition(), Sensor(), UnscentedQuadrature());
+
+    EXPECT_FALSE(filter.reuse_predicted_points());
+
+    expect_same_fused_beliefs(filter, reference_filter);
+}
+
+/*
+ * For linear models the reused points yield the exact moments, hence, the
+ * fused step recovers the Kalman filter
+ */
+TEST(GaussianFilterPredictAndUpdateTests, additive_prediction_reuse)
+{
+    typedef GaussianFilter<Transition, Sensor, UnscentedQuadrature> Filter;
+
+    auto filter = Filter(Transition(), Sensor(), UnscentedQuadrature());
+    filter.reuse_predicted_points(true);
+
+    auto reference_filter = KalmanFilter(Transition(), Sensor());
+
+    expect_same_fused_beliefs(filter, reference_filter);
+}
+
+TEST(GaussianFilterPredictAndUpdateTests, non_additive_prediction_reuse)
+{
+    typedef GaussianFilter<
+                Transition,
+                Sensor,
+                UnscentedQuadrature,
+                SigmaPointPredictPolicy<
+                    UnscentedQuadrature, NonAdditive<Transition>>,
+                SigmaPointUpdatePolicy<
+                    UnscentedQuadrature, Additive<Sensor>>
+            > Filter;
+
+    auto filter = Filter(Transition(), Sensor(), UnscentedQuadrature());
+    filter.reuse_predicted_points(true);
+
+    auto reference_filter = KalmanFilter(Transition(), Sensor());
+
+    expect_same_fused_beliefs(filter, reference_filter);
+}
+
+TEST(GaussianFilterPredictAndUpdateTests, uncorrelated_update_reuse)
+{
+    typedef GaussianFilter<
+                Transition, DecorrelatedSensor, UnscentedQuadrature
+            > Filter;
+
+    auto filter =
+        Filter(Transition(), DecorrelatedSensor(), UnscentedQuadrature());
+    filter.reuse_predicted_points(true);
+
+    auto reference_filter = KalmanFilter(Transition(), Sensor());
+
+    expect_same_fused_beliefs(filter, reference_filter);
+}
@@ -0,0 +1,105 @@
+/*
+ * This is part of the fl library, a C++ Bayesian filtering library
+ * (https://github.com/filtering-library)
+ *
+ * Copyright (c) 2015 Max Planck Society,
+ * 				 Autonomous Motion Department,
+ * 			     Institute for Intelligent Systems
+ *
+ * This Source Code Form is subject to the terms of the MIT License (MIT).
+ * A copy of the license can be found in the LICENSE file distributed with this
+ * source code.
+ */
+
+/**
+ * \file gaussian_filter_test_helpers.hpp
+ * \date October 2026
+ * \author agent (agent@local)
+ */
+
+#pragma once
+
+#include <gtest/gtest.h>
+
+#include <Eigen/Dense>
+
+#include <cstdlib>
+
+#include <fl/util/types.hpp>
+#include <fl/util/math/linear_algebra.hpp>
+
+/**
+ * Sets up random stable linear models for a filter with a linear state
+ * transition and a linear Gaussian observation model. The models are
+ * reproducible such that all filters of a test share the same models.
+ */
+template <typename Filter>
+void setup_models(Filter& filter)
+{
+    auto A = filter.process_model().create_dynamics_matrix();
+    auto Q = filter.process_model().create_noise_matrix();
+    auto H = filter.obsrv_model().create_sensor_matrix();
+    auto R = filter.obsrv_model().create_noise_matrix();
+
+    std::srand(42);
+
+    A.setRandom();
+    A *= 0.5;
+    H.setRandom();
+
+    filter.process_model().dynamics_matrix(A);
+    filter.process_model().noise_matrix(Q * 0.3);
+    filter.obsrv_model().sensor_matrix(H);
+    filter.obsrv_model().noise_matrix(R * 0.2);
+}
+
+/**
+ * \return A random observation, independent of the step \a i
+ */
+template <typename Obsrv>
+Obsrv random_observation(int i)
+{
+    return Obsrv::Random();
+}
+
+/**
+ * Runs both filters for \a steps steps on the input \a u and the observations
+ * \a observation(i) and expects the same beliefs in each step.
+ *
+ * The reference filter runs predict() followed by update(). The \a filter
+ * does the same unless \a predict_and_update is set, in which case it runs
+ * predict_and_update().
+ */
+template <typename Filter, typename ReferenceFilter, typename Observations>
+void expect_same_beliefs(Filter& filter,
+                         ReferenceFilter& reference_filter,
+                         const typename Filter::Input& u,
+                         Observations observation,
+                         int steps,
+                         bool predict_and_update = false)
+{
+    auto belief = filter.create_belief();
+    auto reference_belief = reference_filter.create_belief();
+
+    for (int i = 0; i < steps; ++i)
+    {
+        const typename Filter::Obsrv y = observation(i);
+
+        if (predict_and_update)
+        {
+            filter.predict_and_update(belief, u, y, belief);
+        }
+        else
+        {
+            filter.predict(belief, u, belief);
+            filter.update(belief, y, belief);
+        }
+
+        reference_filter.predict(reference_belief, u, reference_belief);
+        reference_filter.update(reference_belief, y, reference_belief);
+
+        ASSERT_TRUE(fl::are_similar(belief.mean(), reference_belief.mean()));
+        ASSERT_TRUE(fl::are_similar(belief.covariance(),
+                                    reference_belief.covariance()));
+    }
+}
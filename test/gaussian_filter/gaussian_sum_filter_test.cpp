@@ -0,0 +1,298 @@
+/*
+ * This is part of the fl library, a C++ Bayesian filtering library
+ * (https://github.com/filtering-library)
+ *
+ * Copyright (c) 2015 Max Planck Society,
+ * 				 Autonomous Motion Department,
+ * 			     Institute for Intelligent Systems
+ *
+ * This Source Code Form is subject to the terms of the MIT License (MIT).
+ * A copy of the license can be found in the LICENSE file distributed with this
+ * source code.
+ */
+
+/**
+ * \file gaussian_sum_filter_test.cpp
+ * \date October 2026
+ * \author agent (agent@local)
+ */
+
+#include <gtest/gtest.h>
+
+#include <Eigen/Dense>
+
+#include <cmath>
+
+#include <fl/util/types.hpp>
+#include <fl/filter/gaussian/gaussian_filter.hpp>
+#include <fl/filter/gaussian/gaussian_sum_filter.hpp>
+#include <fl/filter/gaussian/transform/monte_carlo_transform.hpp>
+#include <fl/model/process/linear_state_transition_model.hpp>
+#include <fl/model/observation/linear_gaussian_observation_model.hpp>
+
+using namespace fl;
+
+class GaussianSumFilterTests
+    : public testing::Test
+{
+public:
+    typedef Eigen::Matrix<Real, 2, 1> State;
+    typedef Eigen::Matrix<Real, 1, 1> Input;
+    typedef Eigen::Matrix<Real, 1, 1> Obsrv;
+
+    typedef LinearStateTransitionModel<State, Input> Transition;
+    typedef LinearGaussianObservationModel<Obsrv, State> Sensor;
+    typedef GaussianFilter<Transition, Sensor, UnscentedQuadrature> Filter;
+    typedef GaussianSumFilter<Filter> SumFilter;
+    typedef SumFilter::Belief Belief;
+    typedef SumFilter::Component Component;
+
+    GaussianSumFilterTests()
+        : sum_filter(create_filter(), 8, 0.0, 0.0)
+    { }
+
+    static Filter create_filter()
+    {
+        Transition transition(2, 1);
+        transition.noise_matrix(transition.create_noise_matrix() * 0.3);
+
+        Sensor sensor(1, 2);
+        auto H = sensor.create_sensor_matrix();
+        H << 1.0, 0.0;
+        sensor.sensor_matrix(H);
+        sensor.noise_matrix(sensor.create_noise_matrix() * 0.5);
+
+        return Filter(transition, sensor, UnscentedQuadrature());
+    }
+
+    static Component component(Real x, Real y, Real variance)
+    {
+        Component c;
+        c.mean(State(x, y));
+        c.covariance(Eigen::Matrix<Real, 2, 2>::Identity() * variance);
+        return c;
+    }
+
+    static Belief bimodal()
+    {
+        Belief belief;
+        belief.add_component(component(-2.0, 1.0, 1.0), 0.4);
+        belief.add_component(component(3.0, 0.0, 0.5), 0.6);
+        return belief;
+    }
+
+    /**
+     * Updates the bimodal belief with \a filter. For a linear Gaussian model
+     * the Kalman update of each component and the marginal likelihood
+     * weights are exact.
+     */
+    template <typename SumFilterType>
+    static void expect_exact_update(SumFilterType& filter)
+    {
+        Belief prior = bimodal();
+        Belief posterior;
+        const Obsrv y = Obsrv::Constant(2.5);
+        const Real R = 0.25;
+
+        filter.update(prior, y, posterior);
+
+        ASSERT_EQ(posterior.count(), 2);
+
+        Eigen::Array<Real, 2, 1> weights;
+        for (int k = 0; k < 2; ++k)
+        {
+            const Component& c = prior.component(k);
+            const Real P = c.covariance()(0, 0);
+            const Real S = P + R;
+            const Real innovation = y(0) - c.mean()(0);
+
+            weights(k) = prior.weights()(k)
+                         * std::exp(-0.5 * innovation * innovation / S)
+                         / std::sqrt(2.0 * M_PI * S);
+
+            const Eigen::Matrix<Real, 2, 1> K = c.covariance().col(0) / S;
+            const State mean = c.mean() + K * innovation;
+            const Eigen::Matrix<Real, 2, 2> cov =
+                c.covariance() - K * S * K.transpose();
+
+            EXPECT_TRUE(
+                posterior.component(k).mean().isApprox(mean, 1.e-9));
+            EXPECT_TRUE(
+                posterior.component(k).covariance().isApprox(cov, 1.e-9));
+        }
+        weights /= weights.sum();
+
+        EXPECT_NEAR(posterior.weights()(0), weights(0), 1.e-9);
+        EXPECT_NEAR(posterior.weights()(1), weights(1), 1.e-9);
+    }
+
+    SumFilter sum_filter;
+};
+
+TEST_F(GaussianSumFilterTests, predict_components)
+{
+    Belief prior = bimodal();
+    Belief predicted;
+
+    sum_filter.predict(prior, Input::Zero(), predicted);
+
+    ASSERT_EQ(predicted.count(), 2);
+    for (int k = 0; k < 2; ++k)
+    {
+        EXPECT_NEAR(predicted.weights()(k), prior.weights()(k), 1.e-12);
+        EXPECT_TRUE(predicted.component(k).mean().isApprox(
+                        prior.component(k).mean(), 1.e-9));
+        EXPECT_TRUE(predicted.component(k).covariance().isApprox(
+                        prior.component(k).covariance()
+                        + Eigen::Matrix<Real, 2, 2>::Identity() * 0.09,
+                        1.e-9));
+    }
+}
+
+TEST_F(GaussianSumFilterTests, update_matches_exact_posterior)
+{
+    expect_exact_update(sum_filter);
+}
+
+TEST_F(GaussianSumFilterTests, update_of_other_component_filters)
+{
+    const Filter filter = create_filter();
+
+    typedef GaussianFilter<
+                Transition, Additive<Sensor>, UnscentedQuadrature
+            > AdditiveFilter;
+    typedef GaussianFilter<
+                Transition, NonAdditive<Sensor>, UnscentedQuadrature
+            > NonAdditiveFilter;
+
+    GaussianSumFilter<AdditiveFilter> additive_sum_filter(
+        AdditiveFilter(filter.process_model(),
+                       filter.obsrv_model(),
+                       UnscentedQuadrature()),
+        8, 0.0, 0.0);
+    expect_exact_update(additive_sum_filter);
+
+    GaussianSumFilter<NonAdditiveFilter> non_additive_sum_filter(
+        NonAdditiveFilter(filter.process_model(),
+                          filter.obsrv_model(),
+                          UnscentedQuadrature()),
+        8, 0.0, 0.0);
+    expect_exact_update(non_additive_sum_filter);
+}
+
+TEST_F(GaussianSumFilterTests, prototype_changes_apply_to_components)
+{
+    Belief prior = bimodal();
+    Belief posterior;
+    const Obsrv y = Obsrv::Constant(2.5);
+
+    // creates the component filters
+    sum_filter.update(prior, y, posterior);
+
+    auto& sensor = sum_filter.filter().obsrv_model();
+    sensor.noise_matrix(sensor.create_noise_matrix() * 2.0);
+
+    sum_filter.update(prior, y, posterior);
+
+    const Component& c = prior.component(0);
+    const Real S = c.covariance()(0, 0) + 4.0;
+    const State mean =
+        c.mean() + c.covariance().col(0) / S * (y(0) - c.mean()(0));
+
+    EXPECT_TRUE(posterior.component(0).mean().isApprox(mean, 1.e-9));
+}
+
+TEST_F(GaussianSumFilterTests, random_transform_streams)
+{
+    typedef SigmaPointQuadrature<
+                MonteCarloTransform<ConstantPointCountPolicy<50>>
+            > RandomQuadrature;
+    typedef GaussianFilter<
+                Additive<Transition>, Additive<Sensor>, RandomQuadrature
+            > RandomFilter;
+
+    const Filter filter = create_filter();
+
+    GaussianSumFilter<RandomFilter> random_sum_filter(
+        RandomFilter(filter.process_model(),
+                     filter.obsrv_model(),
+                     RandomQuadrature()),
+        8, 0.0, 0.0);
+
+    // two identical components
+    Belief prior;
+    prior.add_component(component(1.0, 0.0, 1.0), 0.5);
+    prior.add_component(component(1.0, 0.0, 1.0), 0.5);
+
+    Belief first;
+    Belief second;
+    random_sum_filter.predict(prior, Input::Zero(), first);
+    random_sum_filter.predict(prior, Input::Zero(), second);
+
+    ASSERT_EQ(first.count(), 2);
+    ASSERT_EQ(second.count(), 2);
+
+    // each component filter samples on its own stream
+    EXPECT_FALSE(first.component(0).covariance().isApprox(
+                     first.component(1).covariance(), 1.e-12));
+
+    // and the streams advance from step to step
+    for (int k = 0; k < 2; ++k)
+    {
+        EXPECT_FALSE(first.component(k).covariance().isApprox(
+                         second.component(k).covariance(), 1.e-12));
+    }
+}
+
+TEST_F(GaussianSumFilterTests, reduce_preserves_moments)
+{
+    Belief mixture;
+    mixture.add_component(component(-2.0, 1.0, 1.0), 0.2);
+    mixture.add_component(component(-1.8, 1.1, 0.9), 0.2);
+    mixture.add_component(component(3.0, 0.0, 0.5), 0.3);
+    mixture.add_component(component(3.1, 0.2, 0.4), 0.2);
+    mixture.add_component(component(0.0, 5.0, 2.0), 0.1);
+
+    const State mean = mixture.mean();
+    const Eigen::Matrix<Real, 2, 2> covariance = mixture.covariance();
+
+    sum_filter.max_components(2);
+    sum_filter.reduce(mixture);
+
+    EXPECT_EQ(mixture.count(), 2);
+    EXPECT_TRUE(mixture.mean().isApprox(mean, 1.e-9));
+    EXPECT_TRUE(mixture.covariance().isApprox(covariance, 1.e-9));
+}
+
+TEST_F(GaussianSumFilterTests, reduce_merges_close_and_prunes_light)
+{
+    Belief mixture;
+    mixture.add_component(component(-2.0, 1.0, 1.0), 0.5);
+    mixture.add_component(component(-2.0, 1.0 + 1.e-4, 1.0), 0.4);
+    mixture.add_component(component(3.0, 0.0, 0.5), 0.1 - 1.e-6);
+    mixture.add_component(component(9.0, 9.0, 0.5), 1.e-6);
+
+    sum_filter.prune_weight(1.e-5);
+    sum_filter.merge_threshold(1.e-3);
+    sum_filter.reduce(mixture);
+
+    // the light component is pruned, the two nearly identical ones are
+    // merged although the budget is not exceeded
+    ASSERT_EQ(mixture.count(), 2);
+    EXPECT_NEAR(mixture.weights().maxCoeff(), 0.9, 1.e-5);
+}
+
+TEST_F(GaussianSumFilterTests, bimodal_tracking)
+{
+    Belief belief = bimodal();
+
+    // observations generated from the second mode select it
+    for (int t = 0; t < 5; ++t)
+    {
+        sum_filter.predict(belief, Input::Zero(), belief);
+        sum_filter.update(belief, Obsrv::Constant(3.0), belief);
+    }
+
+    EXPECT_NEAR(belief.mean()(0), 3.0, 0.2);
+    EXPECT_GT(belief.weights().maxCoeff(), 0.999);
+}
@@ -0,0 +1,174 @@
+/*
+ * This is part of the fl library, a C++ Bayesian filtering library
+ * (https://github.com/filtering-library)
+ *
+ * Copyright (c) 2015 Max Planck Society,
+ * 				 Autonomous Motion Department,
+ * 			     Institute for Intelligent Systems
+ *
+ * This Source Code Form is subject to the terms of the MIT License (MIT).
+ * A copy of the license can be found in the LICENSE file distributed with this
+ * source code.
+ */
+
+/**
+ * \file multi_sensor_sigma_point_update_policy_test.cpp
+ * \date October 2026
+ * \author agent (agent@local)
+ */
+
+#include <gtest/gtest.h>
+
+#include <Eigen/Dense>
+
+#include <cmath>
+
+#include <fl/util/types.hpp>
+#include <fl/util/math/linear_algebra.hpp>
+#include <fl/distribution/gaussian.hpp>
+#include <fl/filter/gaussian/quadrature/unscented_quadrature.hpp>
+#include <fl/filter/gaussian/update_policy/multi_sensor_sigma_point_update_policy.hpp>
+
+using namespace fl;
+
+typedef Eigen::Matrix<Real, 3, 1> State;
+typedef Eigen::Matrix<Real, 1, 1> LocalObsrv;
+typedef Eigen::Matrix<Real, 1, 1> LocalNoise;
+
+/**
+ * Sensor model with an expensive state dependent part, the rendering, which
+ * is the same for all sensors
+ */
+class RenderingSensor
+    : public ObservationFunction<LocalObsrv, State, LocalNoise>,
+      public Descriptor
+{
+public:
+    typedef Eigen::Matrix<Real, 2, 1> Rendering;
+
+    RenderingSensor() : id_(0) { }
+
+    LocalObsrv observation(const State& x, const LocalNoise& w) const override
+    {
+        return observation_of(render(x), w);
+    }
+
+    Rendering render(const State& x) const
+    {
+        ++renderings;
+
+        return Rendering(std::sin(x(0) + x(1)), x(2) * x(2));
+    }
+
+    LocalObsrv observation_of(const Rendering& r, const LocalNoise& w) const
+    {
+        return LocalObsrv(
+            (1.0 + 0.2 * id_) * r(0) + (0.5 - 0.1 * id_) * r(1) + 0.3 * w(0));
+    }
+
+    int id() const override { return id_; }
+    void id(int new_id) override { id_ = new_id; }
+
+    int state_dimension() const override { return 3; }
+    int noise_dimension() const override { return 1; }
+    int obsrv_dimension() const override { return 1; }
+
+    std::string name() const override { return "RenderingSensor"; }
+    std::string description() const override { return "Rendering sensor"; }
+
+    static int renderings;
+
+protected:
+    int id_;
+};
+
+int RenderingSensor::renderings = 0;
+
+/**
+ * The same sensor providing the precomputation hook
+ */
+class PrecomputingSensor
+    : public RenderingSensor
+{
+public:
+    typedef Rendering Precomputation;
+
+    Precomputation precompute(const State& x) const
+    {
+        return render(x);
+    }
+
+    LocalObsrv precomputed_observation(const Precomputation& r,
+                                       const LocalNoise& w) const
+    {
+        return observation_of(r, w);
+    }
+};
+
+static_assert(!HasObservationPrecomputation<RenderingSensor>::Value,
+              "RenderingSensor does not provide a precomputation");
+static_assert(HasObservationPrecomputation<PrecomputingSensor>::Value,
+              "PrecomputingSensor provides a precomputation");
+
+class MultiSensorSigmaPointUpdatePolicyTests
+    : public testing::Test
+{
+public:
+    enum : signed int { SensorCount = 6 };
+
+    typedef Gaussian<State> Belief;
+
+    MultiSensorSigmaPointUpdatePolicyTests()
+    {
+        prior.mean(State(0.3, -0.2, 0.8));
+
+        auto cov = prior.covariance();
+        cov << 0.5, 0.1, 0.0,
+               0.1, 0.4, 0.1,
+               0.0, 0.1, 0.3;
+        prior.covariance(cov);
+
+        y.setRandom(SensorCount);
+    }
+
+    template <typename Sensor>
+    Belief update()
+    {
+        typedef JointObservationModel<MultipleOf<Sensor, SensorCount>> Model;
+
+        Model model((Sensor()));
+        MultiSensorSigmaPointUpdatePolicy<UnscentedQuadrature, Model> policy;
+
+        Belief posterior;
+        policy(model, UnscentedQuadrature(), prior, y, posterior);
+
+        return posterior;
+    }
+
+protected:
+    Belief prior;
+    Eigen::Matrix<Real, SensorCount, 1> y;
+};
+
+TEST_F(MultiSensorSigmaPointUpdatePolicyTests, precomputation_posterior)
+{
+    Belief plain = update<RenderingSensor>();
+    Belief precomputed = update<PrecomputingSensor>();
+
+    EXPECT_TRUE(fl::are_similar(plain.mean(), precomputed.mean()));
+    EXPECT_TRUE(fl::are_similar(plain.covariance(), precomputed.covariance()));
+}
+
+TEST_F(MultiSensorSigmaPointUpdatePolicyTests, renderings_per_point)
+{
+    // unscented transform of the joint (state, local noise) Gaussian
+    const int point_count = 2 * (3 + 1) + 1;
+
+    RenderingSensor::renderings = 0;
+    update<RenderingSensor>();
+    EXPECT_EQ(RenderingSensor::renderings, point_count * SensorCount);
+
+    RenderingSensor::renderings = 0;
+    update<PrecomputingSensor>();
+    EXPECT_EQ(RenderingSensor::renderings, point_count);
+}
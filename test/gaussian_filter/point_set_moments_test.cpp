@@ -0,0 +1,92 @@
+/*
+ * This is part of the fl library, a C++ Bayesian filtering library
+ * (https://github.com/filtering-library)
+ *
+ * Copyright (c) 2015 Max Planck Society,
+ * 				 Autonomous Motion Department,
+ * 			     Institute for Intelligent Systems
+ *
+ * This Source Code Form is subject to the terms of the MIT License (MIT).
+ * A copy of the license can be found in the LICENSE file distributed with this
+ * source code.
+ */
+
+/**
+ * \file point_set_moments_test.cpp
+ * \date October 2026
+ * \author agent (agent@local)
+ */
+
+#include <gtest/gtest.h>
+
+#include <Eigen/Dense>
+
+#include <fl/util/math/linear_algebra.hpp>
+#include <fl/filter/gaussian/transform/point_set.hpp>
+#include <fl/filter/gaussian/transform/point_set_moments.hpp>
+
+typedef Eigen::Matrix<fl::Real, 4, 1> PointX;
+typedef Eigen::Matrix<fl::Real, Eigen::Dynamic, 1> PointY;
+
+class PointSetMomentsTest
+    : public testing::Test
+{
+public:
+    PointSetMomentsTest()
+        : Y(3, 9)
+    {
+        X.points(Eigen::Matrix<fl::Real, 4, 9>::Random());
+        Y.points(Eigen::Matrix<fl::Real, 3, 9>::Random());
+
+        for (int i = 0; i < 9; ++i)
+        {
+            // unequal mean and covariance weights as in the unscented
+            // transform
+            const fl::Real w_mean = (i == 0) ? -0.6 : 0.2;
+            const fl::Real w_cov = (i == 0) ? 1.4 : 0.2;
+            X.weight(i, w_mean, w_cov);
+            Y.weight(i, w_mean, w_cov);
+        }
+    }
+
+protected:
+    fl::PointSet<PointX, 9> X;
+    fl::PointSet<PointY> Y;
+};
+
+TEST_F(PointSetMomentsTest, joint_moments)
+{
+    auto W = X.covariance_weights_vector();
+    auto X_c = X.centered_points();
+    auto Y_c = Y.centered_points();
+
+    fl::PointSetMoments moments;
+    moments.compute(X, Y);
+
+    EXPECT_TRUE(fl::are_similar(moments.mean_x(), X.mean()));
+    EXPECT_TRUE(fl::are_similar(moments.mean_y(), Y.mean()));
+    EXPECT_TRUE(fl::are_similar(moments.centered_x(), X_c));
+    EXPECT_TRUE(fl::are_similar(moments.centered_y(), Y_c));
+    EXPECT_TRUE(fl::are_similar(moments.cov_xx(),
+                                X_c * W.asDiagonal() * X_c.transpose()));
+    EXPECT_TRUE(fl::are_similar(moments.cov_xy(),
+                                X_c * W.asDiagonal() * Y_c.transpose()));
+    EXPECT_TRUE(fl::are_similar(moments.cov_yy(),
+                                Y_c * W.asDiagonal() * Y_c.transpose()));
+}
+
+TEST_F(PointSetMomentsTest, single_point_set)
+{
+    auto W = Y.covariance_weights_vector();
+    auto Y_c = Y.centered_points();
+
+    fl::PointSetMoments moments;
+    moments.compute(X, Y);
+    moments.compute(Y);
+
+    EXPECT_TRUE(fl::are_similar(moments.mean_x(), Y.mean()));
+    EXPECT_TRUE(fl::are_similar(moments.cov_xx(),
+                                Y_c * W.asDiagonal() * Y_c.transpose()));
+    EXPECT_EQ(moments.mean_y().size(), 0);
+    EXPECT_EQ(moments.cov_yy().size(), 0);
+}
@@ -0,0 +1,112 @@
+/*
+ * This is part of the fl library, a C++ Bayesian filtering library
+ * (https://github.com/filtering-library)
+ *
+ * Copyright (c) 2015 Max Planck Society,
+ * 				 Autonomous Motion Department,
+ * 			     Institute for Intelligent Systems
+ *
+ * This Source Code Form is subject to the terms of the MIT License (MIT).
+ * A copy of the license can be found in the LICENSE file distributed with this
+ * source code.
+ */
+
+/**
+ * \file quasi_monte_carlo_transform_test.cpp
+ * \date October 2026
+ * \author agent (agent@local)
+ */
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+
+#include <Eigen/Dense>
+
+#include <fl/filter/gaussian/transform/point_set.hpp>
+#include <fl/filter/gaussian/transform/monte_carlo_transform.hpp>
+#include <fl/filter/gaussian/transform/quasi_monte_carlo_transform.hpp>
+
+typedef Eigen::Matrix<fl::Real, 4, 1> Point;
+typedef fl::PointSet<Point, Eigen::Dynamic> Points;
+
+/**
+ * Root mean squared error of the estimate of E[sum_k exp(x_k / 2)] under
+ * N(mu, I) over a number of independent repetitions
+ */
+template <typename Transform>
+fl::Real rms_error(Transform& transform, const fl::Gaussian<Point>& gaussian)
+{
+    const int repetitions = 50;
+
+    const fl::Real expected =
+        (gaussian.mean().array() * 0.5).exp().sum() * std::exp(0.125);
+
+    fl::Real squared_error = 0;
+    Points point_set;
+
+    for (int r = 0; r < repetitions; ++r)
+    {
+        transform.forward(gaussian, point_set);
+
+        const fl::Real estimate =
+            (point_set.points().array() * 0.5).exp().sum()
+            / point_set.count_points();
+
+        squared_error += std::pow(estimate - expected, 2);
+    }
+
+    return std::sqrt(squared_error / repetitions);
+}
+
+TEST(QuasiMonteCarloTransformTest, moments)
+{
+    fl::QuasiMonteCarloTransform<fl::LinearPointCountPolicy<1000>> qmc;
+
+    fl::Gaussian<Point> gaussian;
+    Eigen::Matrix<fl::Real, 4, 4> cov = Eigen::Matrix<fl::Real, 4, 4>::Random();
+    gaussian.mean(Point::Random());
+    gaussian.covariance(cov * cov.transpose());
+
+    Points point_set;
+    qmc.forward(gaussian, point_set);
+
+    EXPECT_EQ(point_set.count_points(), 4000);
+    EXPECT_TRUE(fl::are_similar(point_set.mean(), gaussian.mean(), 1.e-2));
+
+    auto X_c = point_set.centered_points();
+    auto W = point_set.covariance_weights_vector();
+    Eigen::Matrix<fl::Real, 4, 4> point_cov =
+        X_c * W.asDiagonal() * X_c.transpose();
+
+    EXPECT_TRUE(fl::are_similar(point_cov, gaussian.covariance(), 5.e-2));
+}
+
+TEST(QuasiMonteCarloTransformTest, fewer_points_than_monte_carlo)
+{
+    fl::Gaussian<Point> gaussian;
+    gaussian.mean(Point::Random());
+
+    // RQMC with 4 times fewer points than plain Monte Carlo
+    fl::QuasiMonteCarloTransform<fl::LinearPointCountPolicy<64>> qmc;
+    fl::MonteCarloTransform<fl::LinearPointCountPolicy<256>> mc;
+
+    EXPECT_LT(rms_error(qmc, gaussian), rms_error(mc, gaussian));
+}
+
+TEST(QuasiMonteCarloTransformTest, seeded_transforms_are_deterministic)
+{
+    fl::QuasiMonteCarloTransform<fl::LinearPointCountPolicy<10>> a;
+    fl::QuasiMonteCarloTransform<fl::LinearPointCountPolicy<10>> b;
+    a.seed(3, 1);
+    b.seed(3, 1);
+
+    fl::Gaussian<Point> gaussian;
+    Points points_a;
+    Points points_b;
+
+    a.forward(gaussian, points_a);
+    b.forward(gaussian, points_b);
+
+    EXPECT_TRUE(points_a.points() == points_b.points());
+}
@@ -0,0 +1,479 @@
+/*
+ * This is part of the fl library, a C++ Bayesian filtering library
+ * (https://github.com/filtering-library)
+ *
+ * Copyright (c) 2015 Max Planck Society,
+ * 				 Autonomous Motion Department,
+ * 			     Institute for Intelligent Systems
+ *
+ * This Source Code Form is subject to the terms of the MIT License (MIT).
+ * A copy of the license can be found in the LICENSE file distributed with this
+ * source code.
+ */
+
+/**
+ * \file rao_blackwellized_sigma_point_filter_test.cpp
+ * \date October 2026
+ * \author agent (agent@local)
+ */
+
+#include <gtest/gtest.h>
+
+#include <Eigen/Dense>
+
+#include <cmath>
+#include <type_traits>
+
+#include <fl/util/types.hpp>
+#include <fl/util/traits.hpp>
+#include <fl/util/descriptor.hpp>
+#include <fl/util/math/linear_algebra.hpp>
+#include <fl/filter/gaussian/gaussian_filter.hpp>
+#include <fl/model/process/linear_state_transition_model.hpp>
+#include <fl/model/observation/linear_gaussian_observation_model.hpp>
+#include <fl/model/process/interface/conditionally_linear_state_transition_function.hpp>
+#include <fl/model/observation/interface/conditionally_linear_observation_function.hpp>
+
+using namespace fl;
+
+enum : signed int
+{
+    NonlinearDim = 1,
+    LinearDim = 4,
+    StateDim = NonlinearDim + LinearDim,
+    InputDim = 1,
+    ObsrvDim = 5,
+    Steps = 10
+};
+
+static constexpr Real dt = 0.1;
+
+typedef Eigen::Matrix<Real, StateDim, 1> State;
+typedef Eigen::Matrix<Real, InputDim, 1> Input;
+typedef Eigen::Matrix<Real, ObsrvDim, 1> Obsrv;
+
+typedef ConditionallyLinearStateTransitionFunction<
+            State, State, Input
+        > TransitionInterface;
+typedef ConditionallyLinearObservationFunction<
+            Obsrv, State, Gaussian<Obsrv>
+        > SensorInterface;
+
+struct ModelEvaluations
+{
+    static int& count() { static int evaluations = 0; return evaluations; }
+};
+
+Eigen::Matrix<Real, 2, 2> rotation(Real heading)
+{
+    Eigen::Matrix<Real, 2, 2> R;
+    R << std::cos(heading), -std::sin(heading),
+         std::sin(heading),  std::cos(heading);
+    return R;
+}
+
+/**
+ * Planar body with the heading \f$\theta\f$, the position \f$p\f$ and the
+ * body frame velocity \f$v\f$, i.e. \f$x = [\theta; p; v]\f$ with
+ *
+ * \f$ \theta_{t+1} = \theta_t + dt\,u_t, \quad
+ *     p_{t+1} = p_t + dt\,R(\theta_t)v_t, \quad
+ *     v_{t+1} = 0.95\,v_t \f$
+ *
+ * which is linear in \f$[p; v]\f$ given \f$\theta\f$
+ */
+class HeadingTransition
+    : public TransitionInterface,
+      public Descriptor
+{
+public:
+    HeadingTransition()
+        : noise_matrix_(NoiseMatrix::Identity() * 0.1),
+          noise_covariance_(noise_matrix_ * noise_matrix_.transpose())
+    { }
+
+    State expected_state(const State& x, const Input& u) const override
+    {
+        ++ModelEvaluations::count();
+
+        State x_next = linear_matrix(x, u) * x.tail<LinearDim>();
+        x_next(0) = x(0) + dt * u(0);
+        return x_next;
+    }
+
+    LinearMatrix linear_matrix(const State& x, const Input& u) const override
+    {
+        LinearMatrix B = LinearMatrix::Zero(StateDim, LinearDim);
+        B.block<2, 2>(1, 0).setIdentity();
+        B.block<2, 2>(1, 2) = dt * rotation(x(0));
+        B.block<2, 2>(3, 2) = 0.95 * Eigen::Matrix<Real, 2, 2>::Identity();
+        return B;
+    }
+
+    int nonlinear_dimension() const override { return NonlinearDim; }
+
+    const NoiseMatrix& noise_matrix() const override
+    {
+        return noise_matrix_;
+    }
+
+    const NoiseMatrix& noise_covariance() const override
+    {
+        return noise_covariance_;
+    }
+
+    int state_dimension() const override { return StateDim; }
+    int noise_dimension() const override { return StateDim; }
+    int input_dimension() const override { return InputDim; }
+
+    std::string name() const override { return "HeadingTransition"; }
+    std::string description() const override { return "Heading"; }
+
+private:
+    NoiseMatrix noise_matrix_;
+    NoiseMatrix noise_covariance_;
+};
+
+/**
+ * Observes \f$y = [\sin\theta; p; R(\theta)v] + w\f$ which is linear in
+ * \f$[p; v]\f$ given \f$\theta\f$
+ */
+class HeadingSensor
+    : public SensorInterface,
+      public Descriptor
+{
+public:
+    HeadingSensor()
+        : noise_matrix_(NoiseMatrix::Identity() * 0.2),
+          noise_covariance_(noise_matrix_ * noise_matrix_.transpose())
+    { }
+
+    Obsrv expected_observation(const State& x) const override
+    {
+        ++ModelEvaluations::count();
+
+        Obsrv y = linear_matrix(x) * x.tail<LinearDim>();
+        y(0) = std::sin(x(0));
+        return y;
+    }
+
+    LinearMatrix linear_matrix(const State& x) const override
+    {
+        LinearMatrix C = LinearMatrix::Zero(ObsrvDim, LinearDim);
+        C.block<2, 2>(1, 0).setIdentity();
+        C.block<2, 2>(3, 2) = rotation(x(0));
+        return C;
+    }
+
+    int nonlinear_dimension() const override { return NonlinearDim; }
+
+    NoiseMatrix noise_matrix() const override
+    {
+        return noise_matrix_;
+    }
+
+    NoiseMatrix noise_covariance() const override
+    {
+        return noise_covariance_;
+    }
+
+    int state_dimension() const override { return StateDim; }
+    int noise_dimension() const override { return ObsrvDim; }
+    int obsrv_dimension() const override { return ObsrvDim; }
+
+    std::string name() const override { return "HeadingSensor"; }
+    std::string description() const override { return "Heading"; }
+
+private:
+    NoiseMatrix noise_matrix_;
+    NoiseMatrix noise_covariance_;
+};
+
+/**
+ * Linear transition \f$x_{t+1} = Ax_t + v_t\f$ declared as conditionally
+ * linear in all but the first component
+ */
+class AffineTransition
+    : public TransitionInterface,
+      public Descriptor
+{
+public:
+    typedef Eigen::Matrix<Real, StateDim, StateDim> DynamicsMatrix;
+
+    AffineTransition(const DynamicsMatrix& A, const NoiseMatrix& N)
+        : A_(A), noise_matrix_(N), noise_covariance_(N * N.transpose())
+    { }
+
+    State expected_state(const State& x, const Input& u) const override
+    {
+        return A_ * x;
+    }
+
+    LinearMatrix linear_matrix(const State& x, const Input& u) const override
+    {
+        return A_.rightCols<LinearDim>();
+    }
+
+    int nonlinear_dimension() const override { return NonlinearDim; }
+
+    const NoiseMatrix& noise_matrix() const override
+    {
+        return noise_matrix_;
+    }
+
+    const NoiseMatrix& noise_covariance() const override
+    {
+        return noise_covariance_;
+    }
+
+    int state_dimension() const override { return StateDim; }
+    int noise_dimension() const override { return StateDim; }
+    int input_dimension() const override { return InputDim; }
+
+    std::string name() const override { return "AffineTransition"; }
+    std::string description() const override { return "Affine"; }
+
+private:
+    DynamicsMatrix A_;
+    NoiseMatrix noise_matrix_;
+    NoiseMatrix noise_covariance_;
+};
+
+/**
+ * Linear observation \f$y = Hx + w\f$ declared as conditionally linear in
+ * all but the first component
+ */
+class AffineSensor
+    : public SensorInterface,
+      public Descriptor
+{
+public:
+    typedef Eigen::Matrix<Real, ObsrvDim, StateDim> SensorMatrix;
+
+    AffineSensor(const SensorMatrix& H, const NoiseMatrix& N)
+        : H_(H), noise_matrix_(N), noise_covariance_(N * N.transpose())
+    { }
+
+    Obsrv expected_observation(const State& x) const override
+    {
+        return H_ * x;
+    }
+
+    LinearMatrix linear_matrix(const State& x) const override
+    {
+        return H_.rightCols<LinearDim>();
+    }
+
+    int nonlinear_dimension() const override { return NonlinearDim; }
+
+    NoiseMatrix noise_matrix() const override
+    {
+        return noise_matrix_;
+    }
+
+    NoiseMatrix noise_covariance() const override
+    {
+        return noise_covariance_;
+    }
+
+    int state_dimension() const override { return StateDim; }
+    int noise_dimension() const override { return ObsrvDim; }
+    int obsrv_dimension() const override { return ObsrvDim; }
+
+    std::string name() const override { return "AffineSensor"; }
+    std::string description() const override { return "Affine"; }
+
+private:
+    SensorMatrix H_;
+    NoiseMatrix noise_matrix_;
+    NoiseMatrix noise_covariance_;
+};
+
+static_assert(IsConditionallyLinear<HeadingTransition>::Value,
+              "HeadingTransition must be conditionally linear");
+static_assert(IsConditionallyLinear<HeadingSensor>::Value,
+              "HeadingSensor must be conditionally linear");
+
+static_assert(
+    std::is_same<
+        LinearityOf<HeadingTransition>::Type,
+        ConditionallyLinear<HeadingTransition>
+    >::value,
+    "Conditionally linear models are Rao-Blackwellized");
+
+static_assert(
+    std::is_same<
+        LinearityOf<Additive<HeadingSensor>>::Type, Additive<HeadingSensor>
+    >::value,
+    "Explicitly marked models are integrated over the full state");
+
+template <typename Filter>
+typename Filter::Belief initial_belief(Filter& filter)
+{
+    auto belief = filter.create_belief();
+
+    State mean;
+    mean << 0.3, 1.0, -1.0, 0.5, 0.2;
+
+    Eigen::Matrix<Real, StateDim, StateDim> sqrt;
+    sqrt.setRandom();
+    sqrt *= 0.3;
+
+    belief.mean(mean);
+    belief.covariance(sqrt * sqrt.transpose()
+                      + 0.1 * decltype(sqrt)::Identity());
+
+    return belief;
+}
+
+TEST(RaoBlackwellizedSigmaPointFilterTests, linear_models_match_kalman_filter)
+{
+    typedef LinearStateTransitionModel<State, Input> KalmanTransition;
+    typedef LinearGaussianObservationModel<Obsrv, State> KalmanSensor;
+
+    typedef GaussianFilter<
+                AffineTransition, AffineSensor, UnscentedQuadrature
+            > Filter;
+    typedef GaussianFilter<KalmanTransition, KalmanSensor> KalmanFilter;
+
+    const AffineTransition::DynamicsMatrix A =
+        AffineTransition::DynamicsMatrix::Random() * 0.5;
+    const AffineSensor::SensorMatrix H = AffineSensor::SensorMatrix::Random();
+    const AffineTransition::NoiseMatrix N =
+        AffineTransition::NoiseMatrix::Identity() * 0.3;
+    const AffineSensor::NoiseMatrix M =
+        AffineSensor::NoiseMatrix::Identity() * 0.2;
+
+    KalmanTransition kalman_transition;
+    kalman_transition.dynamics_matrix(A);
+    kalman_transition.input_matrix(KalmanTransition::InputMatrix::Zero());
+    kalman_transition.noise_matrix(N);
+
+    KalmanSensor kalman_sensor;
+    kalman_sensor.sensor_matrix(H);
+    kalman_sensor.noise_matrix(M);
+
+    auto filter = Filter(
+        AffineTransition(A, N), AffineSensor(H, M), UnscentedQuadrature());
+    auto kalman_filter = KalmanFilter(kalman_transition, kalman_sensor);
+
+    auto belief = initial_belief(filter);
+    auto kalman_belief = kalman_filter.create_belief();
+    kalman_belief.mean(belief.mean());
+    kalman_belief.covariance(belief.covariance());
+
+    const Input u = Input::Zero();
+
+    for (int i = 0; i < Steps; ++i)
+    {
+        const Obsrv y = Obsrv::Random();
+
+        filter.predict(belief, u, belief);
+
+        Gaussian<Obsrv> prediction;
+        prediction.mean(H * belief.mean());
+        prediction.covariance(H * belief.covariance() * H.transpose()
+                              + M * M.transpose());
+
+        filter.update(belief, y, belief);
+
+        kalman_filter.predict(kalman_belief, u, kalman_belief);
+        kalman_filter.update(kalman_belief, y, kalman_belief);
+
+        ASSERT_TRUE(fl::are_similar(belief.mean(), kalman_belief.mean()));
+        ASSERT_TRUE(fl::are_similar(belief.covariance(),
+                                    kalman_belief.covariance()));
+        ASSERT_NEAR(filter.log_likelihood(),
+                    prediction.log_probability(y),
+                    1.e-9);
+    }
+}
+
+TEST(RaoBlackwellizedSigmaPointFilterTests,
+     point_count_scales_with_nonlinear_dimension)
+{
+    typedef GaussianFilter<
+                HeadingTransition, HeadingSensor, UnscentedQuadrature
+            > Filter;
+    typedef GaussianFilter<
+                Additive<HeadingTransition>,
+                Additive<HeadingSensor>,
+                UnscentedQuadrature
+            > FullStateFilter;
+
+    auto filter = Filter(
+        HeadingTransition(), HeadingSensor(), UnscentedQuadrature());
+    auto full_state_filter = FullStateFilter(
+        HeadingTransition(), HeadingSensor(), UnscentedQuadrature());
+
+    auto belief = initial_belief(filter);
+    auto full_state_belief = belief;
+
+    const Input u = Input::Ones();
+    const Obsrv y = Obsrv::Zero();
+
+    ModelEvaluations::count() = 0;
+    filter.predict(belief, u, belief);
+    EXPECT_EQ(UnscentedQuadrature::number_of_points(NonlinearDim),
+              ModelEvaluations::count());
+
+    ModelEvaluations::count() = 0;
+    filter.update(belief, y, belief);
+    EXPECT_EQ(UnscentedQuadrature::number_of_points(NonlinearDim),
+              ModelEvaluations::count());
+
+    ModelEvaluations::count() = 0;
+    full_state_filter.predict(full_state_belief, u, full_state_belief);
+    EXPECT_EQ(UnscentedQuadrature::number_of_points(StateDim),
+              ModelEvaluations::count());
+}
+
+/**
+ * With a quadrature of high accuracy both the Rao-Blackwellized filter and
+ * the full state filter are close to the exact moments while the former
+ * integrates the heading only
+ */
+TEST(RaoBlackwellizedSigmaPointFilterTests, matches_full_state_filter)
+{
+    typedef SigmaPointQuadrature<
+                SparseGridGaussHermiteTransform<5>
+            > Quadrature;
+
+    typedef GaussianFilter<
+                HeadingTransition, HeadingSensor, Quadrature
+            > Filter;
+    typedef GaussianFilter<
+                Additive<HeadingTransition>,
+                Additive<HeadingSensor>,
+                Quadrature
+            > FullStateFilter;
+
+    auto filter = Filter(
+        HeadingTransition(), HeadingSensor(), Quadrature());
+    auto full_state_filter = FullStateFilter(
+        HeadingTransition(), HeadingSensor(), Quadrature());
+
+    auto belief = initial_belief(filter);
+    auto full_state_belief = belief;
+
+    const Input u = Input::Ones();
+
+    for (int i = 0; i < Steps; ++i)
+    {
+        const Obsrv y = Obsrv::Random() * 0.5;
+
+        filter.predict(belief, u, belief);
+        filter.update(belief, y, belief);
+
+        full_state_filter.predict(full_state_belief, u, full_state_belief);
+        full_state_filter.update(full_state_belief, y, full_state_belief);
+
+        EXPECT_NEAR(0.0,
+                    (belief.mean() - full_state_belief.mean()).norm(),
+                    1.e-3);
+        EXPECT_NEAR(0.0,
+                    (belief.covariance()
+                     - full_state_belief.covariance()).norm(),
+                    1.e-3);
+    }
+}
@@ -0,0 +1,192 @@
+/*
+ * This is part of the fl library, a C++ Bayesian filtering library
+ * (https://github.com/filtering-library)
+ *
+ * Copyright (c) 2015 Max Planck Society,
+ * 				 Autonomous Motion Department,
+ * 			     Institute for Intelligent Systems
+ *
+ * This Source Code Form is subject to the terms of the MIT License (MIT).
+ * A copy of the license can be found in the LICENSE file distributed with this
+ * source code.
+ */
+
+/**
+ * \file sigma_point_additive_uncorrelated_update_policy_test.cpp
+ * \date October 2026
+ * \author agent (agent@local)
+ */
+
+#include <gtest/gtest.h>
+
+#include <Eigen/Dense>
+
+#include <fl/util/types.hpp>
+#include <fl/util/math/linear_algebra.hpp>
+#include <fl/filter/gaussian/gaussian_filter.hpp>
+#include <fl/model/observation/linear_decorrelated_gaussian_observation_model.hpp>
+
+using namespace fl;
+
+class SigmaPointAdditiveUncorrelatedUpdatePolicyTests
+    : public testing::Test
+{
+public:
+    enum : signed int { StateDim = 3 };
+
+    typedef Eigen::Matrix<Real, StateDim, 1> State;
+    typedef Eigen::Matrix<Real, Eigen::Dynamic, 1> Obsrv;
+    typedef Gaussian<State> Belief;
+
+    typedef LinearDecorrelatedGaussianObservationModel<Obsrv, State> Sensor;
+
+    typedef SigmaPointUpdatePolicy<
+                UnscentedQuadrature,
+                AdditiveUncorrelated<Sensor>
+            > Policy;
+
+    SigmaPointAdditiveUncorrelatedUpdatePolicyTests()
+    {
+        typedef Belief::SecondMoment Covariance;
+
+        Covariance A = Covariance::Random();
+        prior.mean(State::Random());
+        prior.covariance(A * A.transpose() + Covariance::Identity());
+    }
+
+    Sensor create_sensor(int obsrv_dim)
+    {
+        Sensor sensor(obsrv_dim, StateDim);
+        sensor.sensor_matrix(Sensor::SensorMatrix::Random(obsrv_dim, StateDim));
+
+        auto R = sensor.noise_diagonal_covariance();
+        R.diagonal() =
+            Obsrv::Random(obsrv_dim).array().abs() + Real(0.1);
+        sensor.noise_diagonal_covariance(R);
+
+        return sensor;
+    }
+
+    /**
+     * Posterior of the linear Kalman filter update which the sigma point
+     * update recovers exactly for a linear model
+     */
+    Belief kalman_update(const Sensor& sensor, const Obsrv& y)
+    {
+        auto H = sensor.sensor_matrix();
+        auto R = sensor.noise_diagonal_covariance().toDenseMatrix();
+        auto P = prior.covariance();
+
+        auto S = (H * P * H.transpose() + R).eval();
+        auto K = (P * H.transpose() * S.inverse()).eval();
+
+        Belief posterior;
+        posterior.mean(prior.mean() + K * (y - H * prior.mean()));
+        posterior.covariance(P - K * S * K.transpose());
+        return posterior;
+    }
+
+    /**
+     * Marginal log. likelihood of the observation under the linear model
+     */
+    Real kalman_log_likelihood(const Sensor& sensor, const Obsrv& y)
+    {
+        auto H = sensor.sensor_matrix();
+        auto R = sensor.noise_diagonal_covariance().toDenseMatrix();
+        auto P = prior.covariance();
+
+        Gaussian<Obsrv> prediction(y.size());
+        prediction.mean(H * prior.mean());
+        prediction.covariance(H * P * H.transpose() + R);
+
+        return prediction.log_probability(y);
+    }
+
+    void expect_forms_agree(int obsrv_dim)
+    {
+        Sensor sensor = create_sensor(obsrv_dim);
+        Obsrv y = Obsrv::Random(obsrv_dim);
+
+        Belief innovation_posterior;
+        Belief woodbury_posterior;
+
+        Policy innovation_policy;
+        innovation_policy.update_form(Policy::InnovationForm);
+        innovation_policy(sensor, quadrature, prior, y, innovation_posterior);
+
+        Policy woodbury_policy;
+        woodbury_policy.update_form(Policy::WoodburyForm);
+        woodbury_policy(sensor, quadrature, prior, y, woodbury_posterior);
+
+        Belief expected = kalman_update(sensor, y);
+
+        EXPECT_TRUE(fl::are_similar(innovation_posterior.mean(),
+                                    expected.mean()));
+        EXPECT_TRUE(fl::are_similar(innovation_posterior.covariance(),
+                                    expected.covariance()));
+
+        EXPECT_TRUE(fl::are_similar(woodbury_posterior.mean(),
+                                    expected.mean()));
+        EXPECT_TRUE(fl::are_similar(woodbury_posterior.covariance(),
+                                    expected.covariance()));
+
+        const Real log_likelihood = kalman_log_likelihood(sensor, y);
+
+        EXPECT_NEAR(innovation_policy.log_likelihood(), log_likelihood, 1.e-6);
+        EXPECT_NEAR(woodbury_policy.log_likelihood(), log_likelihood, 1.e-6);
+    }
+
+protected:
+    UnscentedQuadrature quadrature;
+    Belief prior;
+};
+
+TEST_F(SigmaPointAdditiveUncorrelatedUpdatePolicyTests, small_obsrv_forms)
+{
+    expect_forms_agree(2);
+}
+
+TEST_F(SigmaPointAdditiveUncorrelatedUpdatePolicyTests, large_obsrv_forms)
+{
+    expect_forms_agree(200);
+}
+
+TEST_F(SigmaPointAdditiveUncorrelatedUpdatePolicyTests, automatic_form)
+{
+    Policy policy;
+    const int point_count = UnscentedQuadrature::number_of_points(StateDim);
+
+    EXPECT_EQ(Policy::AutomaticForm, policy.update_form());
+
+    EXPECT_EQ(Policy::InnovationForm,
+              policy.select_form(StateDim, 2, point_count));
+    EXPECT_EQ(Policy::WoodburyForm,
+              policy.select_form(StateDim, 200, point_count));
+    EXPECT_EQ(Policy::WoodburyForm,
+              policy.select_form(StateDim, 20000, point_count));
+
+    // comparable state and observation dimensions
+    EXPECT_EQ(Policy::InnovationForm, policy.select_form(50, 60, 101));
+
+    policy.update_form(Policy::InnovationForm);
+    EXPECT_EQ(Policy::InnovationForm,
+              policy.select_form(StateDim, 20000, point_count));
+}
+
+TEST_F(SigmaPointAdditiveUncorrelatedUpdatePolicyTests, automatic_update)
+{
+    for (int obsrv_dim : { 2, 200 })
+    {
+        Sensor sensor = create_sensor(obsrv_dim);
+        Obsrv y = Obsrv::Random(obsrv_dim);
+
+        Belief posterior;
+        Policy()(sensor, quadrature, prior, y, posterior);
+
+        Belief expected = kalman_update(sensor, y);
+
+        EXPECT_TRUE(fl::are_similar(posterior.mean(), expected.mean()));
+        EXPECT_TRUE(fl::are_similar(posterior.covariance(),
+                                    expected.covariance()));
+    }
+}
@@ -0,0 +1,269 @@
+/*
+ * This is part of the fl library, a C++ Bayesian filtering library
+ * (https://github.com/filtering-library)
+ *
+ * Copyright (c) 2015 Max Planck Society,
+ * 				 Autonomous Motion Department,
+ * 			     Institute for Intelligent Systems
+ *
+ * This Source Code Form is subject to the terms of the MIT License (MIT).
+ * A copy of the license can be found in the LICENSE file distributed with this
+ * source code.
+ */
+
+/**
+ * \file sigma_point_linear_policy_test.cpp
+ * \date October 2026
+ * \author agent (agent@local)
+ */
+
+#include <gtest/gtest.h>
+
+#include <Eigen/Dense>
+
+#include "gaussian_filter_test_helpers.hpp"
+
+#include <cmath>
+#include <type_traits>
+
+#include <fl/util/types.hpp>
+#include <fl/util/traits.hpp>
+#include <fl/filter/gaussian/gaussian_filter.hpp>
+#include <fl/model/process/linear_state_transition_model.hpp>
+#include <fl/model/observation/linear_gaussian_observation_model.hpp>
+#include <fl/model/observation/linear_decorrelated_gaussian_observation_model.hpp>
+
+using namespace fl;
+
+enum : signed int
+{
+    StateDim = 3,
+    InputDim = 1,
+    ObsrvDim = 2,
+    Steps = 10
+};
+
+typedef Eigen::Matrix<Real, StateDim, 1> State;
+typedef Eigen::Matrix<Real, InputDim, 1> Input;
+typedef Eigen::Matrix<Real, ObsrvDim, 1> Obsrv;
+
+/**
+ * Linear state transition model which counts its evaluations
+ */
+class CountingTransition
+    : public LinearStateTransitionModel<State, Input>
+{
+public:
+    State expected_state(const State& state,
+                         const Input& input) const override
+    {
+        ++evaluations;
+        return LinearStateTransitionModel<State, Input>::expected_state(
+            state, input);
+    }
+
+    static int evaluations;
+};
+
+int CountingTransition::evaluations = 0;
+
+/**
+ * Nonlinear observation model with additive Gaussian noise
+ */
+class RangeBearingSensor
+    : public AdditiveObservationFunction<Obsrv, State, Gaussian<Obsrv>>,
+      public Descriptor
+{
+public:
+    RangeBearingSensor()
+        : noise_matrix_(NoiseMatrix::Identity() * 0.3),
+          noise_covariance_(noise_matrix_ * noise_matrix_.transpose())
+    { }
+
+    Obsrv expected_observation(const State& x) const override
+    {
+        Obsrv y;
+        y(0) = std::sqrt(1.0 + x(0) * x(0) + x(1) * x(1));
+        y(1) = std::atan2(x(1), 2.0 + x(0)) + 0.1 * x(2);
+        return y;
+    }
+
+    NoiseMatrix noise_matrix() const override
+    {
+        return noise_matrix_;
+    }
+
+    NoiseMatrix noise_covariance() const override
+    {
+        return noise_covariance_;
+    }
+
+    int state_dimension() const override { return StateDim; }
+    int noise_dimension() const override { return ObsrvDim; }
+    int obsrv_dimension() const override { return ObsrvDim; }
+
+    std::string name() const override { return "RangeBearingSensor"; }
+    std::string description() const override { return "Range and bearing"; }
+
+private:
+    NoiseMatrix noise_matrix_;
+    NoiseMatrix noise_covariance_;
+};
+
+typedef LinearStateTransitionModel<State, Input> Transition;
+typedef LinearGaussianObservationModel<Obsrv, State> Sensor;
+typedef LinearDecorrelatedGaussianObservationModel<Obsrv, State>
+    DecorrelatedSensor;
+
+static_assert(IsLinear<Transition>::Value, "Transition must be linear");
+static_assert(IsLinear<Sensor>::Value, "Sensor must be linear");
+static_assert(IsLinear<CountingTransition>::Value,
+              "Derived models must be linear");
+static_assert(!IsLinear<RangeBearingSensor>::Value,
+              "RangeBearingSensor must not be linear");
+
+static_assert(
+    std::is_same<
+        LinearityOf<Linear<Transition>>::Type, Linear<Transition>
+    >::value,
+    "Marked linear models are integrated in closed form");
+
+static_assert(
+    std::is_same<
+        LinearityOf<Transition>::Type, Additive<Transition>
+    >::value,
+    "Unmarked linear models are integrated numerically");
+
+static_assert(
+    std::is_same<
+        LinearityOf<CountingTransition>::Type, Additive<CountingTransition>
+    >::value,
+    "Derived linear models may be nonlinear and are integrated numerically");
+
+static_assert(
+    std::is_same<
+        LinearityOf<Additive<Transition>>::Type, Additive<Transition>
+    >::value,
+    "Explicitly marked models are integrated numerically");
+
+static_assert(
+    std::is_same<
+        LinearityOf<RangeBearingSensor>::Type, Additive<RangeBearingSensor>
+    >::value,
+    "Nonlinear models are integrated numerically");
+
+static_assert(IsLinear<DecorrelatedSensor>::Value,
+              "DecorrelatedSensor must be linear");
+
+static_assert(
+    std::is_same<
+        LinearityOf<Linear<DecorrelatedSensor>>::Type,
+        AdditiveUncorrelated<DecorrelatedSensor>
+    >::value,
+    "Linear models with diagonal noise keep the uncorrelated update");
+
+static_assert(
+    std::is_base_of<
+        GaussianFilter<
+            Transition,
+            DecorrelatedSensor,
+            UnscentedQuadrature,
+            SigmaPointPredictPolicy<UnscentedQuadrature, Linear<Transition>>,
+            SigmaPointUpdatePolicy<
+                UnscentedQuadrature,
+                AdditiveUncorrelated<DecorrelatedSensor>>>,
+        GaussianFilter<
+            Linear<Transition>,
+            Linear<DecorrelatedSensor>,
+            UnscentedQuadrature>
+    >::value,
+    "The sigma point filter updates diagonal noise models with the "
+    "uncorrelated update policy");
+
+template <typename Model>
+void setup_transition(Model& model)
+{
+    auto A = model.create_dynamics_matrix();
+    A.setRandom();
+
+    model.dynamics_matrix(A * 0.5);
+    model.input_matrix(model.create_input_matrix());
+    model.noise_matrix(model.create_noise_matrix() * 0.3);
+}
+
+TEST(SigmaPointLinearPolicyTests, linear_models_match_kalman_filter)
+{
+    typedef GaussianFilter<
+                Linear<CountingTransition>, Linear<Sensor>, UnscentedQuadrature
+            > Filter;
+    typedef GaussianFilter<CountingTransition, Sensor> KalmanFilter;
+
+    CountingTransition transition;
+    setup_transition(transition);
+
+    Sensor sensor;
+    sensor.sensor_matrix(Sensor::SensorMatrix::Random());
+
+    auto filter = Filter(transition, sensor, UnscentedQuadrature());
+    auto reference_filter = KalmanFilter(transition, sensor);
+
+    CountingTransition::evaluations = 0;
+    expect_same_beliefs(
+        filter, reference_filter, Input::Ones(), random_observation<Obsrv>, Steps);
+
+    // neither filter evaluates the model point-wise
+    EXPECT_EQ(0, CountingTransition::evaluations);
+}
+
+TEST(SigmaPointLinearPolicyTests, mixed_linear_and_nonlinear_models)
+{
+    typedef GaussianFilter<
+                Linear<CountingTransition>,
+                RangeBearingSensor,
+                UnscentedQuadrature
+            > Filter;
+
+    typedef GaussianFilter<
+                CountingTransition, RangeBearingSensor, UnscentedQuadrature
+            > QuadratureFilter;
+
+    CountingTransition transition;
+    setup_transition(transition);
+
+    auto filter =
+        Filter(transition, RangeBearingSensor(), UnscentedQuadrature());
+    auto reference_filter = QuadratureFilter(
+        transition, RangeBearingSensor(), UnscentedQuadrature());
+
+    CountingTransition::evaluations = 0;
+    expect_same_beliefs(
+        filter, reference_filter, Input::Ones(), random_observation<Obsrv>, Steps);
+
+    // only the reference filter propagates sigma points through the
+    // linear transition
+    const int point_count = UnscentedQuadrature::number_of_points(StateDim);
+    EXPECT_EQ(Steps * point_count, CountingTransition::evaluations);
+}
+
+TEST(SigmaPointLinearPolicyTests, decorrelated_sensor_matches_kalman_filter)
+{
+    typedef GaussianFilter<
+                Linear<Transition>,
+                Linear<DecorrelatedSensor>,
+                UnscentedQuadrature
+            > Filter;
+    typedef GaussianFilter<Transition, DecorrelatedSensor> KalmanFilter;
+
+    Transition transition;
+    setup_transition(transition);
+
+    DecorrelatedSensor sensor;
+    sensor.sensor_matrix(DecorrelatedSensor::SensorMatrix::Random());
+    sensor.noise_matrix(sensor.create_noise_matrix() * 0.5);
+
+    auto filter = Filter(transition, sensor, UnscentedQuadrature());
+    auto reference_filter = KalmanFilter(transition, sensor);
+
+    expect_same_beliefs(
+        filter, reference_filter, Input::Ones(), random_observation<Obsrv>, Steps);
+}
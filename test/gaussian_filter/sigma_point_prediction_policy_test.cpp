@@ -0,0 +1,186 @@
+/*
+ * This is part of the fl library, a C++ Bayesian filtering library
+ * (https://github.com/filtering-library)
+ *
+ * Copyright (c) 2015 Max Planck Society,
+ * 				 Autonomous Motion Department,
+ * 			     Institute for Intelligent Systems
+ *
+ * This Source Code Form is subject to the terms of the MIT License (MIT).
+ * A copy of the license can be found in the LICENSE file distributed with this
+ * source code.
+ */
+
+/**
+ * \file sigma_point_prediction_policy_test.cpp
+ * \date October 2026
+ * \author agent (agent@local)
+ */
+
+#include <gtest/gtest.h>
+
+#include <Eigen/Dense>
+
+#include <cmath>
+
+#include <fl/util/types.hpp>
+#include <fl/util/math/linear_algebra.hpp>
+#include <fl/filter/gaussian/gaussian_filter.hpp>
+#include <fl/model/process/joint_process_model.hpp>
+#include <fl/model/observation/linear_gaussian_observation_model.hpp>
+
+using namespace fl;
+
+typedef Eigen::Matrix<Real, 2, 1> LocalState;
+typedef Eigen::Matrix<Real, 2, 1> LocalNoise;
+typedef Eigen::Matrix<Real, 1, 1> LocalInput;
+
+/**
+ * Nonlinear local model which counts its evaluations
+ */
+class PendulumModel
+    : public StateTransitionFunction<LocalState, LocalNoise, LocalInput>,
+      public Descriptor
+{
+public:
+    LocalState state(const LocalState& x,
+                     const LocalNoise& v,
+                     const LocalInput& u) const override
+    {
+        ++evaluations;
+
+        LocalState y;
+        y(0) = x(0) + 0.1 * x(1) + 0.05 * v(0);
+        y(1) = x(1) - 0.1 * std::sin(x(0)) + 0.1 * u(0) + 0.2 * v(1) * x(1);
+        return y;
+    }
+
+    int state_dimension() const override { return 2; }
+    int noise_dimension() const override { return 2; }
+    int input_dimension() const override { return 1; }
+
+    std::string name() const override { return "PendulumModel"; }
+    std::string description() const override { return "Pendulum model"; }
+
+    static int evaluations;
+};
+
+int PendulumModel::evaluations = 0;
+
+class SigmaPointPredictionPolicyTests
+    : public testing::Test
+{
+public:
+    enum : signed int { Count = 4 };
+
+    typedef JointProcessModel<MultipleOf<PendulumModel, Count>> JointModel;
+    typedef JointModel::State State;
+    typedef JointModel::Noise Noise;
+    typedef JointModel::Input Input;
+    typedef Gaussian<State> Belief;
+
+    typedef SigmaPointPredictPolicy<
+                UnscentedQuadrature,
+                NonAdditive<JointModel>
+            > StructuredPolicy;
+
+    typedef SigmaPointPredictPolicy<
+                UnscentedQuadrature,
+                NonAdditive<StateTransitionFunction<State, Noise, Input>>
+            > GenericPolicy;
+
+    SigmaPointPredictionPolicyTests()
+        : model(PendulumModel())
+    {
+        prior.mean(State::Random());
+        input = Input::Random();
+    }
+
+    void block_diagonal_prior()
+    {
+        auto cov = prior.covariance();
+        cov.setZero();
+        for (int k = 0; k < Count; ++k)
+        {
+            Eigen::Matrix<Real, 2, 2> A = Eigen::Matrix<Real, 2, 2>::Random();
+            cov.block(2 * k, 2 * k, 2, 2) =
+                A * A.transpose() + Eigen::Matrix<Real, 2, 2>::Identity();
+        }
+        prior.covariance(cov);
+    }
+
+    void dense_prior()
+    {
+        typedef typename Belief::SecondMoment Covariance;
+
+        Covariance A = Covariance::Random();
+        prior.covariance(A * A.transpose() + Covariance::Identity());
+    }
+
+    void expect_generic_moments()
+    {
+        Belief structured;
+        Belief generic;
+
+        StructuredPolicy()(model, quadrature, prior, input, structured);
+        GenericPolicy()(model, quadrature, prior, input, generic);
+
+        EXPECT_TRUE(fl::are_similar(structured.mean(), generic.mean()));
+        EXPECT_TRUE(fl::are_similar(structured.covariance(),
+                                    generic.covariance()));
+    }
+
+protected:
+    JointModel model;
+    UnscentedQuadrature quadrature;
+    Belief prior;
+    Input input;
+};
+
+TEST_F(SigmaPointPredictionPolicyTests, block_diagonal_prior_moments)
+{
+    block_diagonal_prior();
+    expect_generic_moments();
+}
+
+TEST_F(SigmaPointPredictionPolicyTests, dense_prior_moments)
+{
+    dense_prior();
+    expect_generic_moments();
+}
+
+TEST_F(SigmaPointPredictionPolicyTests, local_evaluations)
+{
+    block_diagonal_prior();
+
+    const int local_dim = 4;
+    const int point_count = 2 * Count * local_dim + 1;
+
+    Belief predicted;
+
+    PendulumModel::evaluations = 0;
+    GenericPolicy()(model, quadrature, prior, input, predicted);
+    EXPECT_EQ(PendulumModel::evaluations, Count * point_count);
+
+    // one evaluation per block of the mean and one per perturbed block
+    PendulumModel::evaluations = 0;
+    StructuredPolicy()(model, quadrature, prior, input, predicted);
+    EXPECT_EQ(PendulumModel::evaluations, Count + 2 * Count * local_dim);
+}
+
+TEST_F(SigmaPointPredictionPolicyTests, gaussian_filter_uses_local_evaluations)
+{
+    typedef Eigen::Matrix<Real, 2, 1> Obsrv;
+    typedef LinearGaussianObservationModel<Obsrv, State> Sensor;
+    typedef GaussianFilter<JointModel, Sensor, UnscentedQuadrature> Filter;
+
+    block_diagonal_prior();
+
+    Filter filter(model, Sensor(2, State::SizeAtCompileTime), quadrature);
+
+    Belief predicted = filter.create_belief();
+
+    PendulumModel::evaluations = 0;
+    filter.predict(prior, input, predicted);
+    EXPECT_EQ(PendulumModel::evaluations, Count + 2 * Count * 4);
+}
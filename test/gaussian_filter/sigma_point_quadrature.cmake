@@ -54,3 +54,28 @@ add_sigma_point_quadrature_test(${CurrentTest} DynamicTest 6 3 MonteCarlo)
 add_sigma_point_quadrature_test(${CurrentTest} DynamicTest 3 6 MonteCarlo)
 add_sigma_point_quadrature_test(${CurrentTest} DynamicTest 24 3 MonteCarlo)
 add_sigma_point_quadrature_test(${CurrentTest} DynamicTest 50 50 MonteCarlo)
+
+add_sigma_point_quadrature_test(${CurrentTest} StaticTest 2 2 QuasiMonteCarlo)
+add_sigma_point_quadrature_test(${CurrentTest} StaticTest 6 3 QuasiMonteCarlo)
+add_sigma_point_quadrature_test(${CurrentTest} DynamicTest 3 6 QuasiMonteCarlo)
+add_sigma_point_quadrature_test(${CurrentTest} DynamicTest 24 3 QuasiMonteCarlo)
+
+add_sigma_point_quadrature_test(${CurrentTest} StaticTest 2 2 AntitheticMonteCarlo)
+add_sigma_point_quadrature_test(${CurrentTest} DynamicTest 6 3 AntitheticMonteCarlo)
+
+add_sigma_point_quadrature_test(${CurrentTest} StaticTest 2 2 LatinHypercubeMonteCarlo)
+add_sigma_point_quadrature_test(${CurrentTest} DynamicTest 6 3 LatinHypercubeMonteCarlo)
+
+add_sigma_point_quadrature_test(${CurrentTest} StaticTest 2 2 Cubature)
+add_sigma_point_quadrature_test(${CurrentTest} StaticTest 6 3 Cubature)
+add_sigma_point_quadrature_test(${CurrentTest} DynamicTest 3 6 Cubature)
+add_sigma_point_quadrature_test(${CurrentTest} DynamicTest 24 3 Cubature)
+
+add_sigma_point_quadrature_test(${CurrentTest} StaticTest 2 2 SphericalSimplex)
+add_sigma_point_quadrature_test(${CurrentTest} StaticTest 6 3 SphericalSimplex)
+add_sigma_point_quadrature_test(${CurrentTest} DynamicTest 3 6 SphericalSimplex)
+add_sigma_point_quadrature_test(${CurrentTest} DynamicTest 24 3 SphericalSimplex)
+
+add_sigma_point_quadrature_test(${CurrentTest} StaticTest 2 2 SparseGrid)
+add_sigma_point_quadrature_test(${CurrentTest} StaticTest 6 3 SparseGrid)
+add_sigma_point_quadrature_test(${CurrentTest} DynamicTest 3 6 SparseGrid)
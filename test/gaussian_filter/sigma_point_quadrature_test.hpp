@@ -29,7 +29,11 @@
 #include <fl/distribution/gaussian.hpp>
 #include <fl/filter/gaussian/transform/point_set.hpp>
 #include <fl/filter/gaussian/transform/unscented_transform.hpp>
+#include <fl/filter/gaussian/transform/cubature_transform.hpp>
+#include <fl/filter/gaussian/transform/spherical_simplex_transform.hpp>
+#include <fl/filter/gaussian/transform/sparse_grid_gauss_hermite_transform.hpp>
 #include <fl/filter/gaussian/transform/monte_carlo_transform.hpp>
+#include <fl/filter/gaussian/transform/quasi_monte_carlo_transform.hpp>
 #include <fl/filter/gaussian/quadrature/sigma_point_quadrature.hpp>
 
 template <typename TestType>
@@ -387,6 +391,55 @@ public:
         EXPECT_TRUE(result_gaussian.is_approx(expect_gaussian, eps, true));
     }
 
+    void parallel_propagation()
+    {
+        using namespace fl;
+
+        typedef Eigen::Matrix<Real, SizeA, Eigen::Dynamic> PointsA;
+        typedef Eigen::Matrix<Real, SizeB, Eigen::Dynamic> PointsB;
+
+        auto f_xy = [&] (const VariateA& x, const VariateB& y)
+        {
+            return f(x, y);
+        };
+
+        auto f_XY = [&] (const PointsA& X, const PointsB& Y) -> PointsB
+        {
+            return H * X + Y;
+        };
+
+        enum { SetSize = Quadrature::template size<VariateA, VariateB>() };
+
+        auto X = PointSet<VariateA, SetSize>();
+        auto Y = PointSet<VariateB, SetSize>();
+        auto Z_sequential = PointSet<VariateB, SetSize>();
+        auto Z_parallel = PointSet<VariateB, SetSize>();
+        auto Z_batch = PointSet<VariateB, SetSize>();
+
+        quadrature.transform_to_points(p_A, p_B, X, Y);
+        quadrature.propagate_points(f_xy, X, Y, Z_sequential);
+
+        EXPECT_FALSE(quadrature.parallel_propagation());
+        quadrature.parallel_propagation(true, 2);
+        EXPECT_TRUE(quadrature.parallel_propagation());
+
+        quadrature.propagate_points(f_xy, X, Y, Z_parallel);
+        quadrature.propagate_point_matrices(f_XY, X, Y, Z_batch);
+
+        EXPECT_TRUE(Z_parallel.points().isApprox(Z_sequential.points()));
+        EXPECT_TRUE(Z_batch.points().isApprox(Z_sequential.points()));
+        EXPECT_TRUE(Z_batch.covariance_weights_vector().isApprox(
+                        Z_sequential.covariance_weights_vector()));
+
+        // the chunk buffers of the previous call are reused
+        Z_batch.points().setZero();
+        quadrature.propagate_point_matrices(f_XY, X, Y, Z_batch);
+        EXPECT_TRUE(Z_batch.points().isApprox(Z_sequential.points()));
+
+        quadrature.parallel_propagation(false);
+        EXPECT_FALSE(quadrature.parallel_propagation());
+    }
+
 protected:
     /* parameter of the linear function f(x) = A*x */
     MatrixAA F;
@@ -444,6 +497,11 @@ TYPED_TEST_P(SigmaPointQuadratureTests, integrate_moments_fxy_pxy)
     TestFixture::integrate_moments_fxy_pxy();
 }
 
+TYPED_TEST_P(SigmaPointQuadratureTests, parallel_propagation)
+{
+    TestFixture::parallel_propagation();
+}
+
 REGISTER_TYPED_TEST_CASE_P(SigmaPointQuadratureTests,
                            integrate_fx_px,
                            integrate_fxy_pxy,
@@ -452,7 +510,8 @@ REGISTER_TYPED_TEST_CASE_P(SigmaPointQuadratureTests,
                            propergate_gaussian_pxy_Z,
                            propergate_gaussian_pxy_X_Y_Z,
                            integrate_moments_fx_px,
-                           integrate_moments_fxy_pxy);
+                           integrate_moments_fxy_pxy,
+                           parallel_propagation);
 
 namespace internal
 {
@@ -461,11 +520,19 @@ namespace internal
 template <typename T> struct TransformSelection;
 
 // TransformSelection for MonteCarlo integration
-template <typename PSP>
-struct TransformSelection<fl::MonteCarloTransform<PSP>>
+template <typename PSP, typename SP>
+struct TransformSelection<fl::MonteCarloTransform<PSP, SP>>
 {
     static constexpr fl::Real epsilon = fl::Real(0.5);
-    typedef fl::MonteCarloTransform<PSP> Transform;
+    typedef fl::MonteCarloTransform<PSP, SP> Transform;
+};
+
+// TransformSelection for randomized quasi-Monte Carlo integration
+template <typename PSP>
+struct TransformSelection<fl::QuasiMonteCarloTransform<PSP>>
+{
+    static constexpr fl::Real epsilon = fl::Real(0.05);
+    typedef fl::QuasiMonteCarloTransform<PSP> Transform;
 };
 
 // TransformSelection for deterministic Unscented integration
@@ -475,6 +542,28 @@ template <> struct TransformSelection<fl::UnscentedTransform>
     typedef fl::UnscentedTransform Transform;
 };
 
+// TransformSelection for deterministic cubature integration
+template <> struct TransformSelection<fl::CubatureTransform>
+{
+    static constexpr fl::Real epsilon = fl::Real(1.e-9);
+    typedef fl::CubatureTransform Transform;
+};
+
+// TransformSelection for deterministic spherical simplex integration
+template <> struct TransformSelection<fl::SphericalSimplexTransform>
+{
+    static constexpr fl::Real epsilon = fl::Real(1.e-9);
+    typedef fl::SphericalSimplexTransform Transform;
+};
+
+// TransformSelection for deterministic sparse-grid integration
+template <int Level>
+struct TransformSelection<fl::SparseGridGaussHermiteTransform<Level>>
+{
+    static constexpr fl::Real epsilon = fl::Real(1.e-9);
+    typedef fl::SparseGridGaussHermiteTransform<Level> Transform;
+};
+
 }
 
 template <int DimensionA, int DimensionB, typename Transform>
@@ -0,0 +1,165 @@
+/*
+ * This is part of the fl library, a C++ Bayesian filtering library
+ * (https://github.com/filtering-library)
+ *
+ * Copyright (c) 2015 Max Planck Society,
+ * 				 Autonomous Motion Department,
+ * 			     Institute for Intelligent Systems
+ *
+ * This Source Code Form is subject to the terms of the MIT License (MIT).
+ * A copy of the license can be found in the LICENSE file distributed with this
+ * source code.
+ */
+
+/**
+ * \file sigma_point_transform_test.cpp
+ * \date October 2026
+ * \author agent (agent@local)
+ */
+
+#include <gtest/gtest.h>
+
+#include <Eigen/Dense>
+
+#include <fl/filter/gaussian/transform/point_set.hpp>
+#include <fl/filter/gaussian/transform/cubature_transform.hpp>
+#include <fl/filter/gaussian/transform/spherical_simplex_transform.hpp>
+#include <fl/filter/gaussian/transform/sparse_grid_gauss_hermite_transform.hpp>
+
+/**
+ * Cases shared by all deterministic point set transforms. Transform specific
+ * properties are tested in the test of the respective transform.
+ */
+template <typename Transform>
+class SigmaPointTransformTest
+    : public testing::Test
+{
+public:
+    enum : signed int { Dim = 7, DimA = 3, DimB = 4 };
+
+    typedef Eigen::Matrix<fl::Real, Dim, 1> Point;
+    typedef Eigen::Matrix<fl::Real, Dim, Dim> Covariance;
+    typedef Eigen::Matrix<fl::Real, Eigen::Dynamic, 1> DynamicPoint;
+
+    static fl::Gaussian<Point> random_gaussian()
+    {
+        Covariance cov = Covariance::Random();
+
+        fl::Gaussian<Point> gaussian;
+        gaussian.mean(Point::Random());
+        gaussian.covariance(cov * cov.transpose());
+
+        return gaussian;
+    }
+
+protected:
+    Transform transform;
+};
+
+typedef ::testing::Types<
+            fl::CubatureTransform,
+            fl::SphericalSimplexTransform,
+            fl::SparseGridGaussHermiteTransform<3>
+        > Transforms;
+
+TYPED_TEST_CASE(SigmaPointTransformTest, Transforms);
+
+TYPED_TEST(SigmaPointTransformTest, number_of_points)
+{
+    typedef typename TestFixture::DynamicPoint DynamicPoint;
+
+    EXPECT_EQ(TypeParam::number_of_points(Eigen::Dynamic), Eigen::Dynamic);
+
+    for (int dim = 1; dim <= TestFixture::Dim; ++dim)
+    {
+        fl::Gaussian<DynamicPoint> gaussian(dim);
+        fl::PointSet<DynamicPoint> point_set(dim);
+        this->transform.forward(gaussian, point_set);
+
+        EXPECT_EQ(point_set.count_points(), TypeParam::number_of_points(dim));
+    }
+}
+
+TYPED_TEST(SigmaPointTransformTest, moments)
+{
+    typedef typename TestFixture::Point Point;
+    typedef typename TestFixture::Covariance Covariance;
+
+    fl::Gaussian<Point> gaussian = TestFixture::random_gaussian();
+
+    fl::PointSet<
+        Point, TypeParam::number_of_points(TestFixture::Dim)
+    > point_set;
+    this->transform.forward(gaussian, point_set);
+
+    auto X_c = point_set.centered_points();
+    auto W = point_set.covariance_weights_vector();
+    Covariance point_cov = X_c * W.asDiagonal() * X_c.transpose();
+
+    EXPECT_NEAR(point_set.mean_weights_vector().sum(), 1., 1.e-12);
+    EXPECT_TRUE(fl::are_similar(point_set.mean(), gaussian.mean()));
+    EXPECT_TRUE(fl::are_similar(point_cov, gaussian.covariance()));
+}
+
+TYPED_TEST(SigmaPointTransformTest, joint_points_of_marginals)
+{
+    typedef typename TestFixture::Point Point;
+    typedef typename TestFixture::Covariance Covariance;
+    typedef typename TestFixture::DynamicPoint DynamicPoint;
+
+    enum : signed int
+    {
+        Dim = TestFixture::Dim,
+        DimA = TestFixture::DimA,
+        DimB = TestFixture::DimB
+    };
+
+    fl::Gaussian<Point> gaussian = TestFixture::random_gaussian();
+
+    // split the Gaussian into two independent marginals
+    Covariance cov = gaussian.covariance();
+    cov.topRightCorner(DimA, DimB).setZero();
+    cov.bottomLeftCorner(DimB, DimA).setZero();
+    gaussian.covariance(cov);
+
+    fl::Gaussian<DynamicPoint> marginal_a(DimA);
+    fl::Gaussian<DynamicPoint> marginal_b(DimB);
+    marginal_a.mean(gaussian.mean().head(DimA));
+    marginal_a.covariance(cov.topLeftCorner(DimA, DimA));
+    marginal_b.mean(gaussian.mean().tail(DimB));
+    marginal_b.covariance(cov.bottomRightCorner(DimB, DimB));
+
+    fl::PointSet<DynamicPoint> X(DimA);
+    fl::PointSet<DynamicPoint> Y(DimB);
+    this->transform.forward(marginal_a, Dim, 0, X);
+    this->transform.forward(marginal_b, Dim, DimA, Y);
+
+    ASSERT_EQ(X.count_points(), TypeParam::number_of_points(Dim));
+    ASSERT_EQ(Y.count_points(), X.count_points());
+
+    // stacking the marginal points yields the points of the joint Gaussian
+    Eigen::Matrix<fl::Real, Dim, Eigen::Dynamic> joint(Dim, X.count_points());
+    joint.topRows(DimA) = X.points();
+    joint.bottomRows(DimB) = Y.points();
+
+    Point mean = joint * X.mean_weights_vector();
+    Eigen::Matrix<fl::Real, Dim, Eigen::Dynamic> joint_c =
+        joint.colwise() - mean;
+    Covariance joint_cov =
+        joint_c * X.covariance_weights_vector().asDiagonal()
+        * joint_c.transpose();
+
+    EXPECT_TRUE(fl::are_similar(mean, gaussian.mean()));
+    EXPECT_TRUE(fl::are_similar(joint_cov, cov));
+}
+
+TYPED_TEST(SigmaPointTransformTest, fixed_point_set_of_wrong_size_throws)
+{
+    typedef typename TestFixture::Point Point;
+
+    fl::Gaussian<Point> gaussian;
+    fl::PointSet<Point, 3> point_set;
+
+    EXPECT_THROW(this->transform.forward(gaussian, point_set),
+                 fl::WrongSizeException);
+}
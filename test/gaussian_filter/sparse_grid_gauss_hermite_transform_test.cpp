@@ -0,0 +1,123 @@
+/*
+ * This is part of the fl library, a C++ Bayesian filtering library
+ * (https://github.com/filtering-library)
+ *
+ * Copyright (c) 2015 Max Planck Society,
+ * 				 Autonomous Motion Department,
+ * 			     Institute for Intelligent Systems
+ *
+ * This Source Code Form is subject to the terms of the MIT License (MIT).
+ * A copy of the license can be found in the LICENSE file distributed with this
+ * source code.
+ */
+
+/**
+ * \file sparse_grid_gauss_hermite_transform_test.cpp
+ * \date October 2026
+ * \author agent (agent@local)
+ */
+
+#include <gtest/gtest.h>
+
+#include <Eigen/Dense>
+
+#include <fl/filter/gaussian/transform/point_set.hpp>
+#include <fl/filter/gaussian/transform/unscented_transform.hpp>
+#include <fl/filter/gaussian/transform/sparse_grid_gauss_hermite_transform.hpp>
+
+typedef Eigen::Matrix<fl::Real, 5, 1> Point;
+typedef Eigen::Matrix<fl::Real, Eigen::Dynamic, 1> DynamicPoint;
+
+TEST(SparseGridGaussHermiteTransformTest, number_of_points)
+{
+    static_assert(
+        fl::SparseGridGaussHermiteTransform<1>::number_of_points(5) == 1,
+        "level 1 is the mean only");
+    static_assert(
+        fl::SparseGridGaussHermiteTransform<2>::number_of_points(5) == 11,
+        "level 2 has 2n + 1 points");
+    static_assert(
+        fl::SparseGridGaussHermiteTransform<3>::number_of_points(5) == 71,
+        "level 3 has 2n^2 + 4n + 1 points");
+
+    EXPECT_EQ(fl::SparseGridGaussHermiteTransform<3>::number_of_points(
+                  Eigen::Dynamic),
+              Eigen::Dynamic);
+
+    // the grid actually generated matches the precomputed count
+    fl::SparseGridGaussHermiteTransform<4> transform;
+    for (int dim = 1; dim <= 6; ++dim)
+    {
+        fl::Gaussian<DynamicPoint> gaussian(dim);
+        fl::PointSet<DynamicPoint> point_set(dim);
+        transform.forward(gaussian, point_set);
+
+        EXPECT_EQ(transform.weights(dim).size(),
+                  fl::SparseGridGaussHermiteTransform<4>::number_of_points(dim));
+        EXPECT_NEAR(transform.weights(dim).sum(), 1., 1.e-12);
+    }
+}
+
+TEST(SparseGridGaussHermiteTransformTest, level_2_equals_unscented_transform)
+{
+    // level 2 places the points at sqrt(3) along the axes which is the
+    // unscented transform with alpha = 1 and kappa = 3 - n
+    fl::SparseGridGaussHermiteTransform<2> sparse_grid;
+    fl::UnscentedTransform ut(1., 0., 3. - 5.);
+
+    fl::Gaussian<Point> gaussian;
+    gaussian.mean(Point::Random());
+
+    fl::PointSet<Point> X;
+    fl::PointSet<Point> X_ut;
+    sparse_grid.forward(gaussian, X);
+    ut.forward(gaussian, X_ut);
+
+    // both sets consist of the same points in a different order
+    for (int i = 0; i < X.count_points(); ++i)
+    {
+        bool found = false;
+        for (int j = 0; j < X_ut.count_points(); ++j)
+        {
+            if (fl::are_similar(X.point(i), X_ut.point(j)))
+            {
+                EXPECT_NEAR(X.weights(i).w_mean,
+                            X_ut.weights(j).w_mean,
+                            1.e-9);
+                found = true;
+            }
+        }
+        EXPECT_TRUE(found);
+    }
+}
+
+TEST(SparseGridGaussHermiteTransformTest, fourth_moments_are_exact)
+{
+    fl::SparseGridGaussHermiteTransform<3> transform;
+
+    fl::Gaussian<Point> gaussian;
+    fl::PointSet<Point> point_set;
+    transform.forward(gaussian, point_set);
+
+    const auto& X = point_set.points();
+    const auto W = point_set.mean_weights_vector();
+
+    for (int i = 0; i < 5; ++i)
+    {
+        for (int j = 0; j < 5; ++j)
+        {
+            const fl::Real moment =
+                (X.row(i).array().square() * X.row(j).array().square())
+                    .matrix() * W;
+
+            // E[x_i^4] = 3 and E[x_i^2 x_j^2] = 1 for i != j
+            EXPECT_NEAR(moment, i == j ? 3. : 1., 1.e-9);
+        }
+
+        EXPECT_NEAR(X.row(i).array().pow(3).matrix() * W, 0., 1.e-9);
+    }
+
+    // the unscented transform of the same dimension misses the cross terms
+    EXPECT_GT(point_set.count_points(),
+              fl::UnscentedTransform::number_of_points(5));
+}
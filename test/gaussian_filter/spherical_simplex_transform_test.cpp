@@ -0,0 +1,68 @@
+/*
+ * This is part of the fl library, a C++ Bayesian filtering library
+ * (https://github.com/filtering-library)
+ *
+ * Copyright (c) 2015 Max Planck Society,
+ * 				 Autonomous Motion Department,
+ * 			     Institute for Intelligent Systems
+ *
+ * This Source Code Form is subject to the terms of the MIT License (MIT).
+ * A copy of the license can be found in the LICENSE file distributed with this
+ * source code.
+ */
+
+/**
+ * \file spherical_simplex_transform_test.cpp
+ * \date October 2026
+ * \author agent (agent@local)
+ */
+
+#include <gtest/gtest.h>
+
+#include <Eigen/Dense>
+
+#include <fl/filter/gaussian/transform/point_set.hpp>
+#include <fl/filter/gaussian/transform/spherical_simplex_transform.hpp>
+
+typedef Eigen::Matrix<fl::Real, 7, 1> Point;
+
+static fl::Gaussian<Point> random_gaussian()
+{
+    Eigen::Matrix<fl::Real, 7, 7> cov = Eigen::Matrix<fl::Real, 7, 7>::Random();
+
+    fl::Gaussian<Point> gaussian;
+    gaussian.mean(Point::Random());
+    gaussian.covariance(cov * cov.transpose());
+
+    return gaussian;
+}
+
+TEST(SphericalSimplexTransformTest, number_of_points)
+{
+    EXPECT_EQ(fl::SphericalSimplexTransform::number_of_points(7), 7 + 2);
+}
+
+TEST(SphericalSimplexTransformTest, center_weight)
+{
+    fl::SphericalSimplexTransform uniform;
+    EXPECT_DOUBLE_EQ(uniform.weight_0(7), uniform.weight_i(7));
+
+    fl::SphericalSimplexTransform transform(0.5);
+    EXPECT_DOUBLE_EQ(transform.weight_0(7), 0.5);
+    EXPECT_DOUBLE_EQ(transform.weight_0(7) + 8 * transform.weight_i(7), 1.);
+
+    fl::Gaussian<Point> gaussian = random_gaussian();
+    fl::PointSet<Point> point_set;
+    transform.forward(gaussian, point_set);
+
+    auto X_c = point_set.centered_points();
+    auto W = point_set.covariance_weights_vector();
+    Eigen::Matrix<fl::Real, 7, 7> point_cov =
+        X_c * W.asDiagonal() * X_c.transpose();
+
+    EXPECT_TRUE(fl::are_similar(point_set.points().col(0), gaussian.mean()));
+    EXPECT_TRUE(fl::are_similar(point_cov, gaussian.covariance()));
+
+    EXPECT_THROW(fl::SphericalSimplexTransform(1.), fl::Exception);
+    EXPECT_THROW(fl::SphericalSimplexTransform(-0.5), fl::Exception);
+}
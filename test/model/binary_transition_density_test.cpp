@@ -99,13 +99,66 @@ TEST(binary_transition_density, constant_system)
     EXPECT_TRUE(density.probability(1,0,large_dt) < epsilon);
 }
 
+TEST(binary_transition_density, array_matches_scalar)
+{
+    fl::BinaryTransitionDensity density(0.6, 0.3);
 
+    Eigen::Array<bool, Eigen::Dynamic, 1> states(4);
+    Eigen::Array<bool, Eigen::Dynamic, 1> next_states(4);
+    states << 0, 0, 1, 1;
+    next_states << 0, 1, 0, 1;
 
+    for (fl::Real dt = 0.; dt < 3.; dt += 0.7)
+    {
+        Eigen::Array<fl::Real, Eigen::Dynamic, 1> probs =
+            density.probabilities(next_states, states, dt);
+
+        for (int i = 0; i < 4; ++i)
+        {
+            EXPECT_NEAR(probs(i),
+                        density.probability(next_states(i), states(i), dt),
+                        epsilon);
+        }
+    }
+}
 
+TEST(binary_transition_density, propagate)
+{
+    fl::Real p_1to1 = 0.6;
+    fl::Real p_0to1 = 0.3;
+    fl::BinaryTransitionDensity density(p_1to1, p_0to1);
 
+    fl::Real dt = 0.25;
+    Eigen::Array<fl::Real, Eigen::Dynamic, Eigen::Dynamic> p_1 =
+        Eigen::Array<fl::Real, Eigen::Dynamic, Eigen::Dynamic>::Random(16, 8)
+            .abs();
+    Eigen::Array<fl::Real, Eigen::Dynamic, Eigen::Dynamic> initial_p_1 = p_1;
 
+    // advance one column through a block, the remaining ones in one go
+    density.propagate(p_1.col(0), dt);
+    density.propagate(p_1.rightCols(7), dt);
 
+    for (int i = 0; i < p_1.rows(); ++i)
+    {
+        for (int j = 0; j < p_1.cols(); ++j)
+        {
+            fl::Real expected =
+                density.probability(1, 1, dt) * initial_p_1(i, j)
+              + density.probability(1, 0, dt) * (1. - initial_p_1(i, j));
+
+            EXPECT_NEAR(p_1(i, j), expected, epsilon);
+        }
+    }
 
+    EXPECT_TRUE(density.probabilities(initial_p_1, dt).isApprox(p_1));
+}
 
+TEST(binary_transition_density, propagate_constant_system)
+{
+    fl::BinaryTransitionDensity density(1., 0.);
 
+    Eigen::Array<fl::Real, 3, 1> p_1(0., 0.4, 1.);
+    density.propagate(p_1, large_dt);
 
+    EXPECT_TRUE(p_1.isApprox(Eigen::Array<fl::Real, 3, 1>(0., 0.4, 1.)));
+}
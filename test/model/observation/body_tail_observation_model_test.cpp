@@ -139,6 +139,30 @@ public:
         }
     }
 
+    void observations()
+    {
+        const int count = 100;
+
+        auto states = Eigen::Matrix<fl::Real, StateSize, Eigen::Dynamic>
+                        ::Random(StateDim, count).eval();
+        auto noises = Eigen::Matrix<fl::Real, NoiseSize, Eigen::Dynamic>
+                        ::Random(NoiseDim, count).eval();
+
+        auto y = body_tail_model.observations(states, noises);
+
+        ASSERT_EQ(y.rows(), ObsrvDim);
+        ASSERT_EQ(y.cols(), count);
+
+        for (int i = 0; i < count; ++i)
+        {
+            State x = states.col(i);
+            Noise n = noises.col(i);
+
+            EXPECT_TRUE(fl::are_similar(y.col(i).eval(),
+                                        body_tail_model.observation(x, n)));
+        }
+    }
+
     void probability()
     {
         auto x = State::Random(StateDim).eval();
@@ -216,6 +240,11 @@ TYPED_TEST(BodyTailObservationModelTest, observation_select_randomly)
     }
 }
 
+TYPED_TEST(BodyTailObservationModelTest, observations_batch)
+{
+    TestFixture::observations();
+}
+
 TYPED_TEST(BodyTailObservationModelTest, probability)
 {
     for (int i = 0; i < 1000; ++i)
@@ -140,6 +140,43 @@ public:
         EXPECT_TRUE(fl::are_similar(model.observation(x, v), y));
     }
 
+    void observations_test()
+    {
+        const int count = 7;
+
+        auto H = model.create_sensor_matrix();
+        H.setRandom();
+        model.sensor_matrix(H);
+
+        auto states = typename LinearModel::States(model.state_dimension(),
+                                                   count);
+        auto noises = typename LinearModel::Noises(model.noise_dimension(),
+                                                   count);
+        states.setRandom();
+        noises.setRandom();
+
+        auto y = model.observations(states, noises);
+
+        ASSERT_EQ(y.rows(), model.obsrv_dimension());
+        ASSERT_EQ(y.cols(), count);
+
+        for (int i = 0; i < count; ++i)
+        {
+            State x = states.col(i);
+            Noise v = noises.col(i);
+
+            EXPECT_TRUE(fl::are_similar(y.col(i).eval(),
+                                        model.observation(x, v)));
+        }
+
+        // blocks of a point matrix are passed on without copies
+        auto y_tail = fl::batch_observations(model,
+                                             states.rightCols(3),
+                                             noises.rightCols(3));
+
+        EXPECT_TRUE(fl::are_similar(y_tail, y.rightCols(3).eval()));
+    }
+
 protected:
     LinearModel model;
 };
@@ -207,4 +244,46 @@ TYPED_TEST(LinearGaussianObservationModelTest, observation)
     TestFixture::observation_test();
 }
 
+TYPED_TEST(LinearGaussianObservationModelTest, observations)
+{
+    TestFixture::observations_test();
+}
+
 /// \todo missing probability and log_probability tests
+
+/**
+ * Observation function which only provides observation() and no batch
+ * version
+ */
+struct DuckTypedSensor
+{
+    typedef Eigen::Matrix<fl::Real, 2, 1> Obsrv;
+    typedef Eigen::Matrix<fl::Real, 3, 1> State;
+    typedef Eigen::Matrix<fl::Real, 2, 1> Noise;
+
+    Obsrv observation(const State& x, const Noise& w) const
+    {
+        return x.head(2) * x(2) + w;
+    }
+};
+
+TEST(BatchObservationsTests, model_without_batch_function)
+{
+    DuckTypedSensor model;
+
+    const Eigen::Matrix<fl::Real, 3, 5> states =
+        Eigen::Matrix<fl::Real, 3, 5>::Random();
+    const Eigen::Matrix<fl::Real, 2, 5> noises =
+        Eigen::Matrix<fl::Real, 2, 5>::Random();
+
+    auto y = fl::batch_observations(model, states, noises);
+
+    ASSERT_EQ(y.rows(), 2);
+    ASSERT_EQ(y.cols(), 5);
+
+    for (int i = 0; i < 5; ++i)
+    {
+        EXPECT_TRUE(fl::are_similar(
+            y.col(i).eval(), model.observation(states.col(i), noises.col(i))));
+    }
+}
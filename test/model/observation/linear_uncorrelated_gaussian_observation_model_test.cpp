@@ -219,6 +219,36 @@ public:
         EXPECT_TRUE(fl::are_similar(model.observation(x, v), y));
     }
 
+    void observations_test()
+    {
+        const int count = 7;
+
+        auto H = model.create_sensor_matrix();
+        H.setRandom();
+        model.sensor_matrix(H);
+
+        auto states = typename LinearModel::States(model.state_dimension(),
+                                                   count);
+        auto noises = typename LinearModel::Noises(model.noise_dimension(),
+                                                   count);
+        states.setRandom();
+        noises.setRandom();
+
+        auto y = model.observations(states, noises);
+
+        ASSERT_EQ(y.rows(), model.obsrv_dimension());
+        ASSERT_EQ(y.cols(), count);
+
+        for (int i = 0; i < count; ++i)
+        {
+            State x = states.col(i);
+            Noise v = noises.col(i);
+
+            EXPECT_TRUE(fl::are_similar(y.col(i).eval(),
+                                        model.observation(x, v)));
+        }
+    }
+
 protected:
     LinearModel model;
 };
@@ -293,4 +323,9 @@ TYPED_TEST(LinearUncorrelatedGaussianObservationModelTest, observation)
     TestFixture::observation_test();
 }
 
+TYPED_TEST(LinearUncorrelatedGaussianObservationModelTest, observations)
+{
+    TestFixture::observations_test();
+}
+
 /// \todo missing probability and log_probability tests
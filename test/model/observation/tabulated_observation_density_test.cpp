@@ -0,0 +1,178 @@
+/*
+ * This is part of the fl library, a C++ Bayesian filtering library
+ * (https://github.com/filtering-library)
+ *
+ * Copyright (c) 2015 Max Planck Society,
+ * 				 Autonomous Motion Department,
+ * 			     Institute for Intelligent Systems
+ *
+ * This Source Code Form is subject to the terms of the MIT License (MIT).
+ * A copy of the license can be found in the LICENSE file distributed with this
+ * source code.
+ */
+
+/**
+ * \file tabulated_observation_density_test.cpp
+ * \date October 2026
+ * \author agent (agent@local)
+ */
+
+#include <gtest/gtest.h>
+
+#include <Eigen/Dense>
+
+#include <cmath>
+
+#include <fl/util/types.hpp>
+#include <fl/exception/exception.hpp>
+#include <fl/model/observation/body_tail_observation_model.hpp>
+#include <fl/model/observation/uniform_observation_model.hpp>
+#include <fl/model/observation/linear_gaussian_observation_model.hpp>
+#include <fl/model/observation/tabulated_observation_density.hpp>
+
+class TabulatedObservationDensityTests
+    : public testing::Test
+{
+public:
+    typedef fl::Vector1d Obsrv;
+    typedef fl::Vector1d State;
+
+    typedef fl::LinearGaussianObservationModel<Obsrv, State> BodyModel;
+    typedef fl::UniformObservationModel<State> TailModel;
+    typedef fl::BodyTailObsrvModel<BodyModel, TailModel> PixelModel;
+    typedef fl::TabulatedObservationDensity<PixelModel> TabulatedModel;
+
+    TabulatedObservationDensityTests()
+        : pixel_model(create_body_model(), TailModel(0.0, 10.0), 0.1)
+    { }
+
+    static BodyModel create_body_model()
+    {
+        BodyModel model(1, 1);
+        model.noise_matrix(model.create_noise_matrix() * 0.1);
+        return model;
+    }
+
+    static Obsrv scalar(fl::Real value)
+    {
+        return Obsrv::Constant(1, value);
+    }
+
+    PixelModel pixel_model;
+};
+
+TEST_F(TabulatedObservationDensityTests, nodes_are_exact)
+{
+    TabulatedModel tabulated(pixel_model, 1.0, 5.0, 41, 1.0, 5.0, 41);
+
+    for (int i = 0; i < 41; i += 5)
+    {
+        for (int j = 0; j < 41; j += 4)
+        {
+            const fl::Real y = 1.0 + 0.1 * i;
+            const fl::Real x = 1.0 + 0.1 * j;
+
+            EXPECT_NEAR(tabulated.log_probability(scalar(y), scalar(x)),
+                        pixel_model.log_probability(scalar(y), scalar(x)),
+                        1.e-12);
+        }
+    }
+}
+
+TEST_F(TabulatedObservationDensityTests, error_estimate_holds)
+{
+    TabulatedModel tabulated(pixel_model, 1.0, 5.0, 401, 1.0, 5.0, 401);
+
+    EXPECT_GT(tabulated.estimated_max_error(), 0.0);
+    EXPECT_LT(tabulated.estimated_max_error(), 1.e-2);
+
+    // the quadratic interpolation error scales with the squared cell size
+    TabulatedModel coarse(pixel_model, 1.0, 5.0, 101, 1.0, 5.0, 101);
+    EXPECT_NEAR(coarse.estimated_max_error()
+                    / tabulated.estimated_max_error(),
+                16.0,
+                2.0);
+
+    fl::Real max_error = 0;
+    for (fl::Real y = 1.0; y < 5.0; y += 0.0137)
+    {
+        for (fl::Real x = 1.0; x < 5.0; x += 0.0291)
+        {
+            max_error = std::max(max_error, std::fabs(
+                tabulated.log_probability(scalar(y), scalar(x))
+                - pixel_model.log_probability(scalar(y), scalar(x))));
+        }
+    }
+
+    // the estimate is sampled at the cell centers, the smooth model peaks
+    // there up to higher order terms
+    EXPECT_LE(max_error, 1.01 * tabulated.estimated_max_error());
+}
+
+TEST_F(TabulatedObservationDensityTests, outside_falls_back_to_model)
+{
+    TabulatedModel tabulated(pixel_model, 1.0, 5.0, 11, 1.0, 5.0, 11);
+
+    EXPECT_DOUBLE_EQ(tabulated.log_probability(scalar(7.3), scalar(2.0)),
+                     pixel_model.log_probability(scalar(7.3), scalar(2.0)));
+    EXPECT_DOUBLE_EQ(tabulated.log_probability(scalar(2.0), scalar(0.5)),
+                     pixel_model.log_probability(scalar(2.0), scalar(0.5)));
+}
+
+TEST_F(TabulatedObservationDensityTests, outside_is_clamped_like_table)
+{
+    typedef fl::TabulatedObservationDensity<TailModel> TabulatedTail;
+
+    TabulatedTail tabulated(TailModel(0.0, 10.0), 1.0, 5.0, 11, 1.0, 5.0, 11);
+
+    // zero probability outside of the support of the tail
+    EXPECT_EQ(tabulated.log_probability(scalar(12.0), scalar(2.0)),
+              TabulatedTail::min_log_probability());
+    EXPECT_TRUE(std::isfinite(
+        tabulated.log_probability(scalar(-1.0), scalar(7.0))));
+}
+
+TEST_F(TabulatedObservationDensityTests, batch_matches_single)
+{
+    TabulatedModel tabulated(pixel_model, 1.0, 5.0, 201, 1.0, 5.0, 201);
+
+    Eigen::Array<fl::Real, Eigen::Dynamic, Eigen::Dynamic> obsrvs =
+        3.0 + 2.5 * Eigen::Array<fl::Real,
+                                 Eigen::Dynamic,
+                                 Eigen::Dynamic>::Random(12, 9);
+    Eigen::Array<fl::Real, Eigen::Dynamic, Eigen::Dynamic> predictions =
+        3.0 + 1.5 * Eigen::Array<fl::Real,
+                                 Eigen::Dynamic,
+                                 Eigen::Dynamic>::Random(12, 9);
+
+    auto log_probs = tabulated.log_probabilities(obsrvs, predictions);
+
+    TabulatedModel::StateArray states(9);
+    for (int j = 0; j < 9; ++j) states(j) = scalar(predictions(0, j));
+    auto state_log_probs = tabulated.log_probabilities(scalar(obsrvs(0, 0)),
+                                                       states);
+
+    for (int j = 0; j < 9; ++j)
+    {
+        for (int i = 0; i < 12; ++i)
+        {
+            EXPECT_DOUBLE_EQ(log_probs(i, j),
+                             tabulated.log_probability(
+                                 scalar(obsrvs(i, j)),
+                                 scalar(predictions(i, j))));
+        }
+
+        EXPECT_DOUBLE_EQ(state_log_probs(j),
+                         tabulated.log_probability(
+                             scalar(obsrvs(0, 0)),
+                             scalar(predictions(0, j))));
+    }
+}
+
+TEST_F(TabulatedObservationDensityTests, invalid_grid_throws)
+{
+    EXPECT_THROW(TabulatedModel(pixel_model, 5.0, 1.0, 11, 1.0, 5.0, 11),
+                 fl::Exception);
+    EXPECT_THROW(TabulatedModel(pixel_model, 1.0, 5.0, 1, 1.0, 5.0, 11),
+                 fl::Exception);
+}
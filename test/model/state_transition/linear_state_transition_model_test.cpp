@@ -137,6 +137,47 @@ public:
                 x + model.input_matrix() * u + w));
     }
 
+    void states_test()
+    {
+        const int count = 7;
+
+        auto A = model.create_dynamics_matrix();
+        A.setRandom();
+        model.dynamics_matrix(A);
+
+        auto u = Input(model.input_dimension());
+        u.setRandom();
+
+        auto prev_states = typename LinearModel::States(
+                               model.state_dimension(), count);
+        auto noises = typename LinearModel::Noises(
+                          model.noise_dimension(), count);
+        prev_states.setRandom();
+        noises.setRandom();
+
+        auto x = model.states(prev_states, noises, u);
+
+        ASSERT_EQ(x.rows(), model.state_dimension());
+        ASSERT_EQ(x.cols(), count);
+
+        for (int i = 0; i < count; ++i)
+        {
+            State x_i = prev_states.col(i);
+            Noise w_i = noises.col(i);
+
+            EXPECT_TRUE(fl::are_similar(x.col(i).eval(),
+                                        model.state(x_i, w_i, u)));
+        }
+
+        // blocks of a point matrix are passed on without copies
+        auto x_tail = fl::batch_states(model,
+                                       prev_states.rightCols(3),
+                                       noises.rightCols(3),
+                                       u);
+
+        EXPECT_TRUE(fl::are_similar(x_tail, x.rightCols(3).eval()));
+    }
+
 protected:
     LinearModel model;
 };
@@ -211,5 +252,47 @@ TYPED_TEST(LinearStateTransitionModelTest, state)
     TestFixture::state_test();
 }
 
+TYPED_TEST(LinearStateTransitionModelTest, states)
+{
+    TestFixture::states_test();
+}
+
 
 /// \todo missing probability and log_probability tests
+
+/**
+ * State transition which only provides state() and no batch version
+ */
+struct DuckTypedTransition
+{
+    typedef Eigen::Matrix<fl::Real, 3, 1> State;
+    typedef Eigen::Matrix<fl::Real, 3, 1> Noise;
+    typedef Eigen::Matrix<fl::Real, 1, 1> Input;
+
+    State state(const State& x, const Noise& w, const Input& u) const
+    {
+        return 2. * x + w + State::Constant(u(0));
+    }
+};
+
+TEST(BatchStatesTests, model_without_batch_function)
+{
+    DuckTypedTransition model;
+
+    const Eigen::Matrix<fl::Real, 3, 5> prev_states =
+        Eigen::Matrix<fl::Real, 3, 5>::Random();
+    const Eigen::Matrix<fl::Real, 3, 5> noises =
+        Eigen::Matrix<fl::Real, 3, 5>::Random();
+    const DuckTypedTransition::Input u = DuckTypedTransition::Input::Random();
+
+    auto x = fl::batch_states(model, prev_states, noises, u);
+
+    ASSERT_EQ(x.cols(), 5);
+
+    for (int i = 0; i < 5; ++i)
+    {
+        EXPECT_TRUE(fl::are_similar(
+            x.col(i).eval(),
+            model.state(prev_states.col(i), noises.col(i), u)));
+    }
+}
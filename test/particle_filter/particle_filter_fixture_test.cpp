@@ -201,3 +201,48 @@ TEST_F(ParticleFilterTest, predict_and_update)
     // make sure that the estimate of the pf is within one std dev
     EXPECT_TRUE(std::sqrt(mh_distance) <= 1.0);
 }
+
+TEST_F(ParticleFilterTest, predict_with_latin_hypercube_noise)
+{
+    typedef fl::ParticleFilter<
+                ProcessModel,
+                ObservationModel,
+                fl::LatinHypercubeSamplingPolicy
+            > LhsParticleFilter;
+
+    LhsParticleFilter lhs_particle_filter(process_model, observation_model);
+
+    for(size_t i = 0; i < N_steps; i++)
+    {
+        lhs_particle_filter.predict(
+            particle_belief, Input::Zero(), particle_belief);
+        gaussian_filter.predict(gaussian_belief, Input::Zero(), gaussian_belief);
+
+        EXPECT_TRUE(moments_are_similar(
+                        particle_belief.mean(), particle_belief.covariance(),
+                        gaussian_belief.mean(), gaussian_belief.covariance()));
+    }
+}
+
+TEST_F(ParticleFilterTest, predict_with_antithetic_noise)
+{
+    typedef fl::ParticleFilter<
+                ProcessModel,
+                ObservationModel,
+                fl::AntitheticSamplingPolicy
+            > AntitheticParticleFilter;
+
+    AntitheticParticleFilter antithetic_particle_filter(
+        process_model, observation_model);
+
+    for(size_t i = 0; i < N_steps; i++)
+    {
+        antithetic_particle_filter.predict(
+            particle_belief, Input::Zero(), particle_belief);
+        gaussian_filter.predict(gaussian_belief, Input::Zero(), gaussian_belief);
+
+        EXPECT_TRUE(moments_are_similar(
+                        particle_belief.mean(), particle_belief.covariance(),
+                        gaussian_belief.mean(), gaussian_belief.covariance()));
+    }
+}
@@ -0,0 +1,151 @@
+/*
+ * This is part of the fl library, a C++ Bayesian filtering library
+ * (https://github.com/filtering-library)
+ *
+ * Copyright (c) 2015 Max Planck Society,
+ * 				 Autonomous Motion Department,
+ * 			     Institute for Intelligent Systems
+ *
+ * This Source Code Form is subject to the terms of the MIT License (MIT).
+ * A copy of the license can be found in the LICENSE file distributed with this
+ * source code.
+ */
+
+/**
+ * \file dual_test.cpp
+ * \date October 2026
+ * \author agent (agent@local)
+ */
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+
+#include <Eigen/Dense>
+
+#include <fl/util/types.hpp>
+#include <fl/util/math/linear_algebra.hpp>
+#include <fl/util/math/dual.hpp>
+
+using fl::Real;
+
+typedef fl::Dual<Real, 2> Dual2;
+typedef fl::Dual<Real> DynamicDual;
+
+/**
+ * f(x, y) = x y + sin(x) / y - exp(y) + sqrt(x) * atan2(y, x)
+ */
+template <typename S>
+S function(const S& x, const S& y)
+{
+    using std::sin; using std::exp; using std::sqrt; using std::atan2;
+
+    return x * y + sin(x) / y - exp(y) + sqrt(x) * atan2(y, x);
+}
+
+TEST(Dual, gradient)
+{
+    const Real x = 0.7;
+    const Real y = 1.3;
+
+    Dual2 dual_x, dual_y;
+    dual_x.variable(x, 0, 2);
+    dual_y.variable(y, 1, 2);
+
+    const Dual2 f = function(dual_x, dual_y);
+
+    const Real r2 = x * x + y * y;
+    const Real df_dx = y + std::cos(x) / y
+                       + std::atan2(y, x) / (2 * std::sqrt(x))
+                       - std::sqrt(x) * y / r2;
+    const Real df_dy = x - std::sin(x) / (y * y) - std::exp(y)
+                       + std::sqrt(x) * x / r2;
+
+    EXPECT_DOUBLE_EQ(function(x, y), f.value());
+    EXPECT_NEAR(df_dx, f.derivatives()(0), 1.e-12);
+    EXPECT_NEAR(df_dy, f.derivatives()(1), 1.e-12);
+}
+
+TEST(Dual, elementary_functions)
+{
+    const Real x = 0.3;
+    const Real h = 1.e-6;
+
+    DynamicDual a;
+    a.variable(x, 0, 1);
+
+    auto expect_derivative = [&](Real (*f)(Real), const DynamicDual& fa)
+    {
+        EXPECT_DOUBLE_EQ(f(x), fa.value());
+        EXPECT_NEAR((f(x + h) - f(x - h)) / (2 * h), fa.derivatives()(0),
+                    1.e-8);
+    };
+
+    expect_derivative([](Real v) { return std::abs(v); }, abs(-a));
+    expect_derivative([](Real v) { return std::sqrt(v); }, sqrt(a));
+    expect_derivative([](Real v) { return std::exp(v); }, exp(a));
+    expect_derivative([](Real v) { return std::log(v); }, log(a));
+    expect_derivative([](Real v) { return std::sin(v); }, sin(a));
+    expect_derivative([](Real v) { return std::cos(v); }, cos(a));
+    expect_derivative([](Real v) { return std::tan(v); }, tan(a));
+    expect_derivative([](Real v) { return std::asin(v); }, asin(a));
+    expect_derivative([](Real v) { return std::acos(v); }, acos(a));
+    expect_derivative([](Real v) { return std::atan(v); }, atan(a));
+    expect_derivative([](Real v) { return std::sinh(v); }, sinh(a));
+    expect_derivative([](Real v) { return std::cosh(v); }, cosh(a));
+    expect_derivative([](Real v) { return std::tanh(v); }, tanh(a));
+    expect_derivative([](Real v) { return std::pow(v, 2.5); }, pow(a, 2.5));
+    expect_derivative([](Real v) { return 2 / v - 1; }, 2.0 / a - 1);
+}
+
+TEST(Dual, dynamic_constants_have_no_derivatives)
+{
+    const DynamicDual c = 2.0;
+    DynamicDual a;
+    a.variable(3.0, 1, 2);
+
+    EXPECT_EQ(0, c.derivatives().size());
+    EXPECT_EQ(0, (c * c + 1.0).derivatives().size());
+
+    const DynamicDual b = c * a - c;
+    EXPECT_DOUBLE_EQ(4.0, b.value());
+    EXPECT_TRUE(fl::are_similar(Eigen::Vector2d(0.0, 2.0), b.derivatives()));
+}
+
+TEST(Dual, jacobian_of_mixed_matrix_expressions)
+{
+    typedef Eigen::Matrix<Real, 3, 3> Matrix;
+    typedef Eigen::Matrix<Real, 3, 1> Vector;
+    typedef Eigen::Matrix<DynamicDual, Eigen::Dynamic, 1> DualVector;
+
+    const Matrix A = Matrix::Random();
+    const Vector x = Vector::Random();
+
+    DualVector dual_x;
+    fl::dual_variables(x, 0, 3, dual_x);
+
+    // y = A x + [x_1^2, 1, 0]
+    DualVector dual_y = A * dual_x;
+    dual_y(0) += dual_x(0) * dual_x(0);
+    dual_y(1) += 1.0;
+
+    Vector y;
+    Matrix J;
+    fl::dual_value(dual_y, y);
+    fl::dual_jacobian(dual_y, 0, 3, J);
+
+    Vector expected_y = A * x;
+    expected_y(0) += x(0) * x(0);
+    expected_y(1) += 1.0;
+
+    Matrix expected_J = A;
+    expected_J(0, 0) += 2 * x(0);
+
+    EXPECT_TRUE(fl::are_similar(expected_y, y));
+    EXPECT_TRUE(fl::are_similar(expected_J, J));
+
+    // Jacobian with respect to a subset of the variables
+    Eigen::Matrix<Real, 3, Eigen::Dynamic> J_tail;
+    fl::dual_jacobian(dual_y, 1, 2, J_tail);
+    EXPECT_TRUE(fl::are_similar(expected_J.rightCols(2), J_tail));
+}
@@ -0,0 +1,77 @@
+/*
+ * This is part of the fl library, a C++ Bayesian filtering library
+ * (https://github.com/filtering-library)
+ *
+ * Copyright (c) 2015 Max Planck Society,
+ * 				 Autonomous Motion Department,
+ * 			     Institute for Intelligent Systems
+ *
+ * This Source Code Form is subject to the terms of the MIT License (MIT).
+ * A copy of the license can be found in the LICENSE file distributed with this
+ * source code.
+ */
+
+/**
+ * \file linear_algebra_symmetric_factorization_test.cpp
+ * \date October 2026
+ * \author agent (agent@local)
+ */
+
+#include <gtest/gtest.h>
+
+#include <fl/util/types.hpp>
+#include <fl/util/math/linear_algebra.hpp>
+
+static constexpr int N = 20;
+
+typedef Eigen::Matrix<fl::Real, Eigen::Dynamic, Eigen::Dynamic> DynamicMatrix;
+
+TEST(LinearAlgebra, symmetric_factorization_positive_definite)
+{
+    DynamicMatrix M = DynamicMatrix::Random(N, N);
+    M = M * M.transpose() + DynamicMatrix::Identity(N, N);
+
+    DynamicMatrix B = DynamicMatrix::Random(N, 3);
+    DynamicMatrix X = B;
+
+    fl::SymmetricFactorization<DynamicMatrix> factorization;
+    factorization.compute(M);
+    factorization.solve_in_place(X);
+
+    EXPECT_TRUE(factorization.positive_definite());
+    EXPECT_TRUE(fl::are_similar(M * X, B));
+}
+
+TEST(LinearAlgebra, symmetric_factorization_indefinite)
+{
+    DynamicMatrix M = DynamicMatrix::Random(N, N);
+    M = (M + M.transpose()).eval();
+
+    DynamicMatrix B = DynamicMatrix::Random(N, 3);
+    DynamicMatrix X = B;
+
+    fl::SymmetricFactorization<DynamicMatrix> factorization;
+    factorization.compute(M);
+    factorization.solve_in_place(X);
+
+    EXPECT_FALSE(factorization.positive_definite());
+    EXPECT_TRUE(fl::are_similar(M * X, B));
+}
+
+TEST(LinearAlgebra, symmetric_factorization_fixed_size_vector)
+{
+    typedef Eigen::Matrix<fl::Real, 4, 4> Matrix;
+    typedef Eigen::Matrix<fl::Real, 4, 1> Vector;
+
+    Matrix M = Matrix::Random();
+    M = M * M.transpose() + Matrix::Identity();
+
+    Vector b = Vector::Random();
+    Vector x = b;
+
+    fl::SymmetricFactorization<Matrix> factorization;
+    factorization.compute(M);
+    factorization.solve_in_place(x);
+
+    EXPECT_TRUE(fl::are_similar(M * x, b));
+}
@@ -0,0 +1,233 @@
+/*
+ * This is part of the fl library, a C++ Bayesian filtering library
+ * (https://github.com/filtering-library)
+ *
+ * Copyright (c) 2015 Max Planck Society,
+ * 				 Autonomous Motion Department,
+ * 			     Institute for Intelligent Systems
+ *
+ * This Source Code Form is subject to the terms of the MIT License (MIT).
+ * A copy of the license can be found in the LICENSE file distributed with this
+ * source code.
+ */
+
+/**
+ * \file random_test.cpp
+ * \date October 2026
+ * \author agent (agent@local)
+ */
+
+#include <gtest/gtest.h>
+
+#include <thread>
+#include <vector>
+
+#include <fl/util/random.hpp>
+#include <fl/exception/exception.hpp>
+#include <fl/distribution/gaussian.hpp>
+#include <fl/distribution/standard_gaussian.hpp>
+
+TEST(Philox4x32Tests, known_answers)
+{
+    struct Vector
+    {
+        std::uint32_t counter[4];
+        std::uint32_t key[2];
+        std::uint32_t expected[4];
+    };
+
+    // Random123 known-answer vectors of philox4x32-10
+    const Vector vectors[] =
+    {
+        { { 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+          { 0x00000000, 0x00000000 },
+          { 0x6627e8d5, 0xe169c58d, 0xbc57ac4c, 0x9b00dbd8 } },
+        { { 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff },
+          { 0xffffffff, 0xffffffff },
+          { 0x408f276d, 0x41c83b0e, 0xa20bc7c6, 0x6d5451fd } },
+        { { 0x243f6a88, 0x85a308d3, 0x13198a2e, 0x03707344 },
+          { 0xa4093822, 0x299f31d0 },
+          { 0xd16cfe09, 0x94fdcceb, 0x5001e420, 0x24126ea1 } }
+    };
+
+    for (const Vector& v: vectors)
+    {
+        std::uint32_t output[4];
+        fl::Philox4x32::philox(v.counter, v.key, output);
+
+        for (int i = 0; i < 4; ++i)
+        {
+            EXPECT_EQ(output[i], v.expected[i]);
+        }
+    }
+}
+
+TEST(Philox4x32Tests, streams_are_reproducible)
+{
+    fl::Philox4x32 a(42, 7);
+    fl::Philox4x32 b(42, 7);
+    fl::Philox4x32 other_stream(42, 8);
+    fl::Philox4x32 other_seed(43, 7);
+
+    int equal_other_stream = 0;
+    int equal_other_seed = 0;
+
+    for (int i = 0; i < 1000; ++i)
+    {
+        const std::uint32_t x = a();
+
+        EXPECT_EQ(x, b());
+        equal_other_stream += (x == other_stream());
+        equal_other_seed += (x == other_seed());
+    }
+
+    EXPECT_LE(equal_other_stream, 1);
+    EXPECT_LE(equal_other_seed, 1);
+}
+
+TEST(Philox4x32Tests, discard)
+{
+    for (unsigned long long n: { 0ull, 1ull, 3ull, 4ull, 5ull, 11ull, 1001ull })
+    {
+        fl::Philox4x32 a(5, 3);
+        fl::Philox4x32 b(5, 3);
+
+        // discard from an arbitrary position within a block
+        a();
+        b();
+
+        for (unsigned long long i = 0; i < n; ++i) a();
+        b.discard(n);
+
+        EXPECT_TRUE(a == b);
+        EXPECT_EQ(a(), b());
+    }
+}
+
+TEST(Philox4x32Tests, reserved_stream_bits_throw)
+{
+    const std::uint64_t max_id = fl::Philox4x32::max_stream_id();
+
+    EXPECT_NO_THROW(fl::Philox4x32(1, max_id));
+    EXPECT_THROW(fl::Philox4x32(1, max_id + 1), fl::Exception);
+    EXPECT_THROW(fl::Philox4x32(1, std::uint64_t(1) << 63), fl::Exception);
+    EXPECT_THROW(fl::Philox4x32(1, 0, fl::Philox4x32::SubstreamCount),
+                 fl::Exception);
+    EXPECT_THROW(fl::Philox4x32(1, 0, -1), fl::Exception);
+}
+
+TEST(Philox4x32Tests, substreams_are_distinct)
+{
+    const std::uint64_t max_id = fl::Philox4x32::max_stream_id();
+
+    for (int substream = 1; substream < fl::Philox4x32::SubstreamCount;
+         ++substream)
+    {
+        fl::Philox4x32 base(3, max_id);
+        fl::Philox4x32 sub(3, max_id, substream);
+
+        int equal = 0;
+        for (int i = 0; i < 1000; ++i)
+        {
+            equal += (base() == sub());
+        }
+
+        EXPECT_LE(equal, 1);
+        EXPECT_TRUE(base != sub);
+    }
+}
+
+TEST(RandomStreamTests, seeded_samplers_are_deterministic)
+{
+    typedef Eigen::Matrix<fl::Real, Eigen::Dynamic, 1> Vector;
+
+    fl::StandardGaussian<Vector> a(5);
+    fl::StandardGaussian<Vector> b(5);
+
+    a.seed(1234, 9);
+    b.seed(1234, 9);
+
+    for (int i = 0; i < 100; ++i)
+    {
+        EXPECT_TRUE(a.sample() == b.sample());
+    }
+}
+
+TEST(RandomStreamTests, parallel_samplers_do_not_depend_on_scheduling)
+{
+    typedef Eigen::Matrix<fl::Real, 3, 1> Vector;
+
+    const int streams = 4;
+    const int samples = 1000;
+
+    auto run = [&](bool threaded)
+    {
+        std::vector<std::vector<Vector>> results(streams);
+        std::vector<std::thread> threads;
+
+        auto draw = [&](int stream)
+        {
+            fl::Gaussian<Vector> gaussian;
+            gaussian.seed(77, stream);
+
+            for (int i = 0; i < samples; ++i)
+            {
+                results[stream].push_back(gaussian.sample());
+            }
+        };
+
+        for (int stream = 0; stream < streams; ++stream)
+        {
+            if (threaded) threads.push_back(std::thread(draw, stream));
+            else draw(stream);
+        }
+
+        for (auto& thread: threads) thread.join();
+
+        return results;
+    };
+
+    auto sequential = run(false);
+    auto parallel = run(true);
+
+    for (int stream = 0; stream < streams; ++stream)
+    {
+        for (int i = 0; i < samples; ++i)
+        {
+            EXPECT_TRUE(sequential[stream][i] == parallel[stream][i]);
+        }
+    }
+
+    EXPECT_FALSE(sequential[0][0] == sequential[1][0]);
+}
+
+TEST(StandardGammaDistributionTests, moments)
+{
+    fl::RandomEngine generator(1, 0);
+
+    for (fl::Real shape: { 0.3, 1.0, 2.5, 20.0 })
+    {
+        fl::StandardGammaDistribution gamma(shape);
+
+        const int n = 200000;
+        fl::Real sum = 0;
+        fl::Real sum_of_squares = 0;
+
+        for (int i = 0; i < n; ++i)
+        {
+            const fl::Real x = gamma(generator);
+
+            ASSERT_GT(x, 0.0);
+
+            sum += x;
+            sum_of_squares += x * x;
+        }
+
+        const fl::Real mean = sum / n;
+        const fl::Real variance = sum_of_squares / n - mean * mean;
+
+        // mean and variance of Gamma(shape, 1) are both equal to shape
+        EXPECT_NEAR(mean, shape, 5.0 * std::sqrt(shape / n));
+        EXPECT_NEAR(variance, shape, 0.03 * shape);
+    }
+}
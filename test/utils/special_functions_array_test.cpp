@@ -0,0 +1,164 @@
+/*
+ * This is part of the fl library, a C++ Bayesian filtering library
+ * (https://github.com/filtering-library)
+ *
+ * Copyright (c) 2015 Max Planck Society,
+ * 				 Autonomous Motion Department,
+ * 			     Institute for Intelligent Systems
+ *
+ * This Source Code Form is subject to the terms of the MIT License (MIT).
+ * A copy of the license can be found in the LICENSE file distributed with this
+ * source code.
+ */
+
+/**
+ * \file special_functions_array_test.cpp
+ * \date October 2026
+ * \author agent (agent@local)
+ */
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <algorithm>
+
+#include <fl/util/math/general_functions.hpp>
+#include <fl/util/math/special_functions.hpp>
+#include <fl/distribution/truncated_gaussian.hpp>
+#include <fl/distribution/exponential_distribution.hpp>
+
+typedef Eigen::Array<fl::Real, Eigen::Dynamic, 1> Array;
+
+static Array linspace(int size, fl::Real low, fl::Real high)
+{
+    return Array::LinSpaced(size, low, high);
+}
+
+static fl::Real max_relative_error(const Array& value, const Array& expected)
+{
+    return ((value - expected) / expected).abs().maxCoeff();
+}
+
+TEST(SpecialFunctionsArray, erf)
+{
+    // the size is no multiple of the block size to cover the padded block
+    Array x = linspace(100003, -6.0, 6.0);
+    Array expected = x.unaryExpr([](fl::Real v) { return std::erf(v); });
+
+    Array y = fl::erf(x);
+
+    // ignore the exact zero of the grid
+    y = (x == 0).select(1.0, y);
+    expected = (x == 0).select(1.0, expected);
+
+    EXPECT_LT(max_relative_error(y, expected), 2.e-15);
+}
+
+TEST(SpecialFunctionsArray, erfc)
+{
+    Array x = linspace(100003, -6.0, 26.0);
+    Array expected = x.unaryExpr([](fl::Real v) { return std::erfc(v); });
+
+    Array y = fl::erfc(x);
+
+    // accumulates the rounding error of z^2, see fl::erfc
+    Array tolerance = 2.e-15 + 1.e-15 * x.square() / 4.0;
+
+    EXPECT_TRUE((((y - expected) / expected).abs() < tolerance).all());
+}
+
+TEST(SpecialFunctionsArray, erfinv)
+{
+    Array x = linspace(100003, -0.9999999, 0.9999999);
+
+    Array y = fl::erfinv(x);
+
+    for (int i = 0; i < x.size(); ++i)
+    {
+        ASSERT_DOUBLE_EQ(y(i), fl::erfinv(x(i)));
+    }
+}
+
+TEST(SpecialFunctionsArray, erfinv_round_trip)
+{
+    Array x = linspace(1003, -0.999, 0.999);
+
+    EXPECT_TRUE(fl::erf(fl::erfinv(x)).isApprox(x, 1.e-14));
+}
+
+TEST(SpecialFunctionsArray, normal_to_uniform)
+{
+    Array x = linspace(10003, -8.0, 8.0);
+
+    Array u = fl::normal_to_uniform(x);
+
+    for (int i = 0; i < x.size(); ++i)
+    {
+        EXPECT_NEAR(u(i), fl::normal_to_uniform(x(i)), 1.e-15);
+    }
+
+    // the lower tail keeps its relative accuracy
+    Array tail = fl::normal_to_uniform(Array::Constant(1, -30.0));
+    EXPECT_NEAR(tail(0) / 4.906713927148187e-198, 1.0, 1.e-12);
+}
+
+TEST(SpecialFunctionsArray, uniform_to_normal)
+{
+    Array u = linspace(10003, 1.e-6, 1.0 - 1.e-6);
+
+    Array x = fl::uniform_to_normal(u);
+
+    for (int i = 0; i < u.size(); ++i)
+    {
+        EXPECT_NEAR(x(i), fl::uniform_to_normal(u(i)), 1.e-9);
+    }
+
+    EXPECT_TRUE(fl::normal_to_uniform(x).isApprox(u, 1.e-13));
+}
+
+TEST(SpecialFunctionsArray, uniform_to_normal_tail)
+{
+    // 1 - u is not representable for these u, yet the round trip holds
+    Array u(4);
+    u << 1.e-16, 1.e-14, 1.e-12, 1.e-10;
+
+    Array x = fl::uniform_to_normal(u);
+    Array v = fl::normal_to_uniform(x);
+
+    EXPECT_LT(max_relative_error(v, u), 1.e-13);
+}
+
+TEST(SpecialFunctionsArray, truncated_gaussian_batch)
+{
+    fl::TruncatedGaussian truncated_gaussian(1.0, 2.0, -1.0, 4.0);
+
+    Array gaussian_samples = 3.0 * Array::Random(1000);
+
+    Array samples = truncated_gaussian.map_standard_normal(gaussian_samples);
+
+    for (int i = 0; i < samples.size(); ++i)
+    {
+        EXPECT_NEAR(samples(i),
+                    truncated_gaussian.map_standard_normal(gaussian_samples(i)),
+                    1.e-9);
+    }
+
+    EXPECT_GE(samples.minCoeff(), -1.0);
+    EXPECT_LE(samples.maxCoeff(), 4.0);
+}
+
+TEST(SpecialFunctionsArray, exponential_distribution_batch)
+{
+    fl::ExponentialDistribution exponential(2.0, 0.5, 3.0);
+
+    Array gaussian_samples = 3.0 * Array::Random(1000);
+
+    Array samples = exponential.map_standard_normal(gaussian_samples);
+
+    for (int i = 0; i < samples.size(); ++i)
+    {
+        EXPECT_NEAR(samples(i),
+                    exponential.map_standard_normal(gaussian_samples(i)),
+                    1.e-12);
+    }
+}